@@ -45,13 +45,22 @@
 #include "bsp.h"
 
 #include "chrono.h"
+#include "chrono_scheduler.h"
+#include "chrono_stat.h"
 #include "faraabin.h"
+#include "add_on/chrono_stat/faraabin_chrono_stat.h"
+#include "add_on/runtime_scaler/runtime_dispatcher.h"
 
 /* Private define ------------------------------------------------------------*/
 /**
  * @brief Period of the application's execution in microseconds.
  */
 #define RUNTIME_PERIOD_US (1000)
+#define TICKLESS_IDLE     (0)     /* Set to 1 to sleep between application steps, e.g. on battery-powered boards. */
+#define LATENESS_BIN_US   (10)    /* Width of each bin of the lateness histogram of the application in microseconds. */
+#define LATENESS_BIN_QTY  (8)     /* Number of bins of the lateness histogram of the application. */
+#define CYCLE_DOMAIN      (1U)    /* Chrono clock domain of the cycle counter, used for measuring the execution time. */
+#define MONITOR_PERIOD_MS (100U)  /* Period of reporting the changes of the signal generator inputs in milliseconds. */
 
 /* Private macro -------------------------------------------------------------*/
 /* Private typedef -----------------------------------------------------------*/
@@ -64,8 +73,16 @@ static float64_t Output;    /*!< Output Output of the signal generator */
 
 static uint32_t Execution;  /*!< Execution Holds the execution time of the application in microseconds */
 static uint32_t Interval;   /*!< Interval Holds the interval of the running application in microseconds */
+static uint32_t Jitter;     /*!< Jitter Holds the jitter of the application's start time in microseconds */
+static uint32_t Missed;     /*!< Missed Holds the number of application periods that were missed because the main loop was late */
+static uint32_t Lateness[LATENESS_BIN_QTY]; /*!< Lateness Histogram of the lateness of the application's start time in LATENESS_BIN_US bins */
+static sChronoStat IntervalStat;  /*!< IntervalStat Statistics and log2 histogram of the interval of the running application */
+static sChronoStat ExecutionStat; /*!< ExecutionStat Statistics and log2 histogram of the execution time of the application */
+static sChrono ExecutionChrono;   /*!< ExecutionChrono Chrono object in the cycle clock domain that measures the execution time of the application */
 
-static sChrono Chrono;      /*!< Chrono Chrono object used for controlling the application's execution based on RUNTIME_PERIOD_US */
+static sChronoScheduler Scheduler;    /*!< Scheduler Chrono scheduler that runs the periodic tasks of the main loop */
+static sChronoTask *SchedulerHeap[1]; /*!< SchedulerHeap Deadline heap of the scheduler, one entry per periodic task */
+static sChronoTask AppTask;           /*!< AppTask Periodic task that runs the application every RUNTIME_PERIOD_US */
 
 FARAABIN_CONTAINER_DEF_STATIC_(Container);        /*!< Container Faraabin container for introducing user variables to Faraabin */
 FARAABIN_DATABUS_DEF_STATIC_(Databus);            /*!< Databus Faraabin databus for creating a data stream between MCU and PC to send data periodically */
@@ -76,6 +93,7 @@ FARAABIN_VAR_TYPE_DEF_STATIC_(eWaveType);         /*!< eWaveType Faraabin variab
 
 /* Private function prototypes -----------------------------------------------*/
 static void FaraabinReceiveFrameHandler(uint8_t *data, uint16_t size);
+static void AppRun(void *arg);
 
 /* Variables -----------------------------------------------------------------*/
 
@@ -98,8 +116,14 @@ int main(void) {
   if (fChrono_Init(fBsp_GetTick) != CHRONO_OK) {
     Error_Handler();
   }
+  /* Let chrono account for a tick overflow that is not handled yet. */
+  fChrono_SetTickOverflowPendingCallback(fBsp_IsTickOverflowPending);
   /* Initialize board peripherals. */
   fBsp_Init();
+  /* The cycle counter is a second clock domain of chrono, so that short execution times are measured with core clock resolution. */
+  if (fChrono_DomainInit(CYCLE_DOMAIN, fBsp_GetCycle, 0xFFFFFFFFU, fBsp_GetCycleFrequency(), TICK_COUNTERMODE_UP) != CHRONO_OK) {
+    Error_Handler();
+  }
   
   /* Faraabin Initialization --------------------------------------------------*/
   /* Register USB receive callback to a function that handles Faraabin frames. */
@@ -114,6 +138,10 @@ int main(void) {
   FARAABIN_Container_Init_(&Container);
   /* Initialize eWaveType variable type object. Faraabin needs this information to know the type of eWaveType. */
   FARAABIN_VAR_TYPE_ENUM_INIT_(eWaveType);
+  /* Initialize sChronoStat variable type object, so that the statistics of the application times are shown with their histograms. */
+  fFaraabinChronoStat_Init();
+  /* Initialize sRunEvery variable type object, so that the registered RUN_EVERY blocks are shown with their run times. */
+  fRuntimeDispatcher_Init();
 
   /* Initialize Faraabin databus with 5 channels and a division factor of 5. */
   /* The databus will start in stream mode while the 'Output' variable is already attached to it. */
@@ -138,64 +166,33 @@ int main(void) {
   Frequency = 1.0;
   Amplitude = 1.0;
   
-  fChrono_StartTimeoutUs(&Chrono, RUNTIME_PERIOD_US);
+  /* The application runs as a periodic task of the chrono scheduler. */
+  /* The scheduler reads the tick once per loop and runs the tasks that are due, so adding tasks doesn't add polling. */
+  fChronoScheduler_Init(&Scheduler, SchedulerHeap, 1);
+  fChronoScheduler_AddTaskUs(&Scheduler, &AppTask, AppRun, NULL, RUNTIME_PERIOD_US);
+  /* The lateness histogram is introduced to Faraabin as an array, and its last bin counts all the later runs. */
+  fChronoScheduler_SetTaskHistogram(&AppTask, Lateness, LATENESS_BIN_QTY, LATENESS_BIN_US);
+  /* The statistics of the interval and execution times start empty. */
+  fChronoStat_Reset(&IntervalStat);
+  fChronoStat_Reset(&ExecutionStat);
   
   /* Infinite loop ------------------------------------------------------------*/
   while (1) {
     /* This is the runtime in which the application runs periodically. */
-    /* fChrono_StartTimeoutUs() is called immediately after fChrono_IsTimeout() to set the chrono for the next step of the application's execution. */
-    if (fChrono_IsTimeout(&Chrono)) {
-      fChrono_StartTimeoutUs(&Chrono, RUNTIME_PERIOD_US);
-      
-      /* lastTickBegin and tickBegin variables are used for execution and interval time measurements. */
-      /* They store the last execution and current execution time tags. */
-      static uint32_t lastTickBegin = 0;
-      uint32_t tickBegin = fChrono_GetTick();
-
-      /* Run signal generator with given inputs. Result is written onto Output. */
-      Output = fAppSignalGenerator_Run(Enable, WaveType, Frequency, Amplitude);
-
-      /* This part detects any change in the 'WaveType' variable value. If a change is detected, a message is sent to Faraabin. */
-      static eWaveType OldType = eWAVE_TYPE_NONE;
-      if (OldType != WaveType) {
-        
-        FARAABIN_PrintfWarningTo_(&TypeEventGroup, "Wave type changed from %s to %s", WaveTypeString[OldType], WaveTypeString[WaveType]);
-        OldType = WaveType;
-
-      }
-
-      /* This part detects any change in the 'Amplitude' variable value. If a change is detected, a message is sent to Faraabin. */
-      static float64_t OldAmp = 0.0;
-      if (OldAmp != Amplitude) {
-        
-        FARAABIN_PrintfWarningTo_(&AmplEventGroup, "Amplitude changed from %lf to %lf", OldAmp, Amplitude);
-        OldAmp = Amplitude;
-
-      }
-
-      /* This part detects any change in the 'Frequency' variable value. If a change is detected, a message is sent to Faraabin. */
-      static float64_t OldFreq = 0.0;
-      if (OldFreq != Frequency) {
-        
-        FARAABIN_PrintfWarningTo_(&FreqEventGroup, "Frequency changed from %lf to %lf", OldFreq, Frequency);
-        OldFreq = Frequency;
-
-      }
-      
-      /* Faraabin databus is running in the same runtime as the application. */
-      /* Users can obtain 'Output' data with this runtime frequency divided by the 'Databus.StreamDivideBy' value. */
-      FARAABIN_DataBus_Run_(&Databus);
-      
-      /* At the end of each step, Interval and Execution times are calculated to evaluate algorithm times. */
-      Interval = fChrono_TimeSpanUs(lastTickBegin, tickBegin);
-      Execution = fChrono_TimeSpanUs(tickBegin, fChrono_GetTick());
-      
-      lastTickBegin = tickBegin;
-
-    }
+    fChronoScheduler_Run(&Scheduler);
+    /* The registered RUN_EVERY blocks are not time critical. They run after the tasks of the scheduler. */
+    timeUs_t dispatcherNextUs = fRuntimeDispatcher_Run();
     
     /* fFaraabin_Run() function is executed in a low priority part of the main loop. Whenever the CPU has time, it will execute this part. */
     fFaraabin_Run();
+    
+#if (TICKLESS_IDLE == 1)
+    /* Sleep until the next deadline of the scheduler or the dispatcher. USB interrupts wake the MCU earlier for Faraabin. */
+    timeUs_t schedulerNextUs = fChronoScheduler_NextDeadlineUs(&Scheduler);
+    fBsp_Sleep((schedulerNextUs < dispatcherNextUs) ? schedulerNextUs : dispatcherNextUs);
+#else
+    (void)dispatcherNextUs;
+#endif
 
   }
 }
@@ -206,6 +203,78 @@ int main(void) {
 ╚══════════════════════════════════════════════════════════════════════════════════╝
 */
 
+/**
+ * @brief Runs one step of the application. It is called by the scheduler every RUNTIME_PERIOD_US.
+ * 
+ * @param arg Not used
+ */
+static void AppRun(void *arg) {
+
+  (void)arg;
+
+  /* lastTickBegin and tickBegin variables are used for execution and interval time measurements. */
+  /* They store the last execution and current execution time tags. */
+  static uint32_t lastTickBegin = 0;
+  uint32_t tickBegin = fChrono_GetTick();
+  fChrono_StartIn(&ExecutionChrono, CYCLE_DOMAIN);
+
+  /* Run signal generator with given inputs. Result is written onto Output. */
+  Output = fAppSignalGenerator_Run(Enable, WaveType, Frequency, Amplitude);
+
+  /* Faraabin databus is running in the same runtime as the application. */
+  /* Users can obtain 'Output' data with this runtime frequency divided by the 'Databus.StreamDivideBy' value. */
+  FARAABIN_DataBus_Run_(&Databus);
+  
+  /* At the end of each step, Interval and Execution times are calculated to evaluate algorithm times. */
+  Interval = fChrono_TimeSpanUs(lastTickBegin, tickBegin);
+  Execution = fChrono_ElapsedUs(&ExecutionChrono);
+  Jitter = fChronoScheduler_GetTaskJitterUs(&AppTask);
+  Missed = fChronoScheduler_GetTaskMissedQty(&AppTask);
+  
+  /* The statistics keep the distribution of the times. The first step has no interval. */
+  if (fChronoScheduler_GetTaskRunQty(&AppTask) > 1U) {
+    fChronoStat_AddSampleUs(&IntervalStat, Interval);
+  }
+  fChronoStat_AddSampleUs(&ExecutionStat, Execution);
+  
+  lastTickBegin = tickBegin;
+}
+
+/**
+ * @brief Reports the changes of the signal generator inputs to Faraabin every MONITOR_PERIOD_MS.
+ * 
+ * @note It is a registered RUN_EVERY block, run by fRuntimeDispatcher_Run(). Its interval can be changed in Faraabin.
+ */
+RUN_EVERY_REGISTER_MS_(InputMonitor, MONITOR_PERIOD_MS) {
+
+  /* This part detects any change in the 'WaveType' variable value. If a change is detected, a message is sent to Faraabin. */
+  static eWaveType OldType = eWAVE_TYPE_NONE;
+  if (OldType != WaveType) {
+    
+    FARAABIN_PrintfWarningTo_(&TypeEventGroup, "Wave type changed from %s to %s", WaveTypeString[OldType], WaveTypeString[WaveType]);
+    OldType = WaveType;
+
+  }
+
+  /* This part detects any change in the 'Amplitude' variable value. If a change is detected, a message is sent to Faraabin. */
+  static float64_t OldAmp = 0.0;
+  if (OldAmp != Amplitude) {
+    
+    FARAABIN_PrintfWarningTo_(&AmplEventGroup, "Amplitude changed from %lf to %lf", OldAmp, Amplitude);
+    OldAmp = Amplitude;
+
+  }
+
+  /* This part detects any change in the 'Frequency' variable value. If a change is detected, a message is sent to Faraabin. */
+  static float64_t OldFreq = 0.0;
+  if (OldFreq != Frequency) {
+    
+    FARAABIN_PrintfWarningTo_(&FreqEventGroup, "Frequency changed from %lf to %lf", OldFreq, Frequency);
+    OldFreq = Frequency;
+
+  }
+}
+
 /**
  * @brief This function is used to define eWaveType fields to faraabin.
  * 
@@ -237,6 +306,12 @@ FARAABIN_CONTAINER_FUNC_(Container) {
 
   FARAABIN_VAR_U32_(Execution);
   FARAABIN_VAR_U32_(Interval);
+  FARAABIN_VAR_U32_(Jitter);
+  FARAABIN_VAR_U32_(Missed);
+  FARAABIN_VAR_U32_ARRAY_(Lateness);
+  FARAABIN_VAR_CHRONO_STAT_(IntervalStat);
+  FARAABIN_VAR_CHRONO_STAT_(ExecutionStat);
+  FARAABIN_VAR_RUN_EVERY_(InputMonitor);
 
   FARAABIN_FUNCTION_GROUP_DICT_(LedFunction);
 
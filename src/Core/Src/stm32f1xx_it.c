@@ -20,6 +20,8 @@
 #include "stm32f1xx_it.h"
 
 /* Private includes ----------------------------------------------------------*/
+#include "chrono.h"
+
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
 /* Private macro -------------------------------------------------------------*/
@@ -134,3 +136,20 @@ void USB_LP_CAN1_RX0_IRQHandler(void)
 {
   HAL_PCD_IRQHandler(&hpcd_USB_FS);
 }
+
+/**
+  * @brief This function handles TIM2 global interrupt, the wake-up timer of fBsp_Sleep().
+  */
+void TIM2_IRQHandler(void)
+{
+  TIM2->SR = (uint32_t)~TIM_SR_UIF;
+}
+
+/**
+  * @brief This function handles TIM4 global interrupt, the overflow of the chrono tick.
+  */
+void TIM4_IRQHandler(void)
+{
+  TIM4->SR = (uint32_t)~TIM_SR_UIF;
+  fChrono_TickOverflowHandler();
+}
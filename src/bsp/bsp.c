@@ -31,6 +31,10 @@
 #include <stdbool.h>
 
 /* Private define ------------------------------------------------------------*/
+#define BSP_SLEEP_MIN_US  (20U)     /*!< Shorter sleeps are skipped, since entering and leaving sleep costs about as much. */
+#define BSP_SLEEP_MAX_US  (0xFFFFU) /*!< Longest sleep that the 16-bit wake-up timer can count. */
+#define BSP_TICK_FREQ_HZ  (1000000U) /*!< Frequency of the chrono tick. It must match CHRONO_TICK_TO_NANOSECOND_COEF in chrono_config.h. */
+
 /* Private macro -------------------------------------------------------------*/
 /* Private typedef -----------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
@@ -39,6 +43,8 @@ static bool Init;
 /* Private function prototypes -----------------------------------------------*/
 static void SystemClock_Config(void);
 static uint8_t fBspInitLed(void);
+static void fBspInitCycleCounter(void);
+static uint32_t fBspGetTimerClock(void);
 
 /* Variables -----------------------------------------------------------------*/
 
@@ -61,6 +67,8 @@ uint8_t fBsp_Init(void) {
   HAL_Init();
   /* Configure the system clock. */
   SystemClock_Config();
+  /* Start the cycle counter of the core. */
+  fBspInitCycleCounter();
   /* Initialize all configured peripherals. */
   fBspInitLed();
   MX_USB_DEVICE_Init();
@@ -70,21 +78,129 @@ uint8_t fBsp_Init(void) {
 }
 
 /**
- * @brief 
+ * @brief Starts the tick of chrono, a 32-bit up counter at 1MHz.
  * 
- * @return uint8_t 
+ * @note TIM3 is prescaled to 1MHz and its update event clocks TIM4, which holds the upper half of the tick.
+ *       The update interrupt of TIM4 is the overflow interrupt of the tick. It is started with the reset clock,
+ *       and HAL_InitTick() keeps the prescaler in step with the system clock after that.
+ * 
+ * @return initStatus One of the Bsp function return types.
  */
 uint8_t fBsp_TickInit(void) {
-  return 0;
+
+  __HAL_RCC_TIM3_CLK_ENABLE();
+  __HAL_RCC_TIM4_CLK_ENABLE();
+
+  TIM3->CR1 = 0U;
+  TIM4->CR1 = 0U;
+
+  /* Update event of TIM3 is its trigger output. */
+  TIM3->CR2 = TIM_CR2_MMS_1;
+  TIM3->PSC = (fBspGetTimerClock() / BSP_TICK_FREQ_HZ) - 1U;
+  TIM3->ARR = 0xFFFFU;
+  TIM3->CNT = 0U;
+  TIM3->EGR = TIM_EGR_UG;
+
+  /* TIM4 counts the trigger output of TIM3 (ITR2) in external clock mode 1. */
+  TIM4->SMCR = TIM_SMCR_TS_1 | TIM_SMCR_SMS;
+  TIM4->ARR = 0xFFFFU;
+  TIM4->CNT = 0U;
+  TIM4->SR = 0U;
+  TIM4->DIER = TIM_DIER_UIE;
+  NVIC_EnableIRQ(TIM4_IRQn);
+
+  TIM4->CR1 = TIM_CR1_CEN;
+  TIM3->CR1 = TIM_CR1_CEN;
+
+  return BSP_OK;
 }
 
 /**
- * @brief 
+ * @brief Returns the tick of chrono.
+ * 
+ * @note The upper half is read again after the lower half, so a carry from TIM3 to TIM4 between the two reads is not missed.
  * 
- * @return uint32_t 
+ * @return tick Current value of the 32-bit tick.
  */
 uint32_t fBsp_GetTick(void) {
-  return SysTick->VAL;
+
+  uint32_t high;
+  uint32_t low;
+
+  do {
+    high = TIM4->CNT;
+    low = TIM3->CNT;
+  } while(high != TIM4->CNT);
+
+  return (high << 16U) | low;
+}
+
+/**
+ * @brief Returns the cycle counter of the core, which counts up at the core clock and wraps at 0xFFFFFFFF.
+ * 
+ * @note It is the tick of the cycle clock domain of chrono, used for measurements shorter than a microsecond.
+ * 
+ * @return cycle Current value of DWT->CYCCNT.
+ */
+uint32_t fBsp_GetCycle(void) {
+  return DWT->CYCCNT;
+}
+
+/**
+ * @brief Returns the frequency of the cycle counter, which is the core clock.
+ * 
+ * @return frequency Cycle counter frequency in Hz.
+ */
+uint32_t fBsp_GetCycleFrequency(void) {
+  return SystemCoreClock;
+}
+
+/**
+ * @brief Returns the pending state of the TIM4 update interrupt, which is the overflow interrupt of the tick.
+ * 
+ * @return isPending True if the tick has wrapped and its interrupt is not handled yet.
+ */
+bool fBsp_IsTickOverflowPending(void) {
+  return ((TIM4->SR & TIM_SR_UIF) != 0U);
+}
+
+/**
+ * @brief Puts the MCU in sleep mode until a wake-up timer expires or any interrupt occurs.
+ * 
+ * @note TIM2 is used as a one-pulse wake-up timer with 1us resolution. The tick timers keep counting in sleep mode,
+ *       so chrono time stays accurate. USB interrupts wake the MCU before the timer expires.
+ * 
+ * @param durationUs Maximum sleep time in microseconds. It is limited to BSP_SLEEP_MAX_US and values below
+ *                   BSP_SLEEP_MIN_US return immediately.
+ */
+void fBsp_Sleep(uint32_t durationUs) {
+
+  if(durationUs < BSP_SLEEP_MIN_US) {
+    return;
+  }
+
+  if(durationUs > BSP_SLEEP_MAX_US) {
+    durationUs = BSP_SLEEP_MAX_US;
+  }
+
+  __HAL_RCC_TIM2_CLK_ENABLE();
+
+  TIM2->CR1 = TIM_CR1_URS;
+  TIM2->PSC = (fBspGetTimerClock() / 1000000U) - 1U;
+  TIM2->ARR = durationUs - 1U;
+  TIM2->CNT = 0U;
+  TIM2->EGR = TIM_EGR_UG;
+  TIM2->SR = 0U;
+  TIM2->DIER = TIM_DIER_UIE;
+  NVIC_EnableIRQ(TIM2_IRQn);
+
+  TIM2->CR1 = TIM_CR1_URS | TIM_CR1_OPM | TIM_CR1_CEN;
+  __WFI();
+
+  TIM2->CR1 = 0U;
+  TIM2->DIER = 0U;
+  TIM2->SR = 0U;
+  NVIC_ClearPendingIRQ(TIM2_IRQn);
 }
 
 /**
@@ -261,17 +377,47 @@ static uint8_t fBspInitLed(void) {
 }
 
 /**
- * @brief this function is defined here to prevent enabling systick timer.
+ * @brief Enables the DWT cycle counter.
+ * 
+ */
+static void fBspInitCycleCounter(void) {
+
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0U;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/**
+ * @brief Returns the clock of the timers on APB1 bus.
+ * 
+ * @return timerClock Clock of TIM2 to TIM4 in Hz. It is twice the APB1 clock when APB1 is divided.
+ */
+static uint32_t fBspGetTimerClock(void) {
+
+  uint32_t timerClock = HAL_RCC_GetPCLK1Freq();
+  if((RCC->CFGR & RCC_CFGR_PPRE1) != RCC_CFGR_PPRE1_DIV1) {
+    timerClock *= 2U;
+  }
+
+  return timerClock;
+}
+
+/**
+ * @brief Keeps the tick of chrono at 1MHz when the system clock changes. It replaces the SysTick time base of HAL,
+ *        so SysTick is not enabled. HAL calls it in HAL_Init() and HAL_RCC_ClockConfig().
+ * 
+ * @note The prescaler is loaded at the next update of TIM3. Resetting TIM3 to load it at once would lose ticks,
+ *       so up to 65536 ticks after a clock change are counted at the old rate. This only happens while booting.
  * 
- * @param TickPriority 
- * @return HAL_StatusTypeDef 
+ * @param TickPriority Not used. The tick interrupt only counts overflows and keeps its default priority.
+ * @return HAL_StatusTypeDef HAL_OK
  */
 HAL_StatusTypeDef HAL_InitTick(uint32_t TickPriority) {
 
-  SysTick->LOAD  = (uint32_t)(0xFFFFFF - 1UL);                      /* set reload register */
-  SysTick->VAL   = 0UL;                                             /* Load the SysTick Counter Value */
-  SysTick->CTRL  = SysTick_CTRL_CLKSOURCE_Msk |
-                   SysTick_CTRL_TICKINT_Msk;                        /* Enable SysTick IRQ and SysTick Timer */
+  (void)TickPriority;
+
+  TIM3->PSC = (fBspGetTimerClock() / BSP_TICK_FREQ_HZ) - 1U;
+
   return HAL_OK;
 }
 
@@ -29,6 +29,7 @@ extern "C" {
 
 /* Includes ------------------------------------------------------------------*/
 #include <stdint.h>
+#include <stdbool.h>
 
 /* Exported defines ----------------------------------------------------------*/
 /**
@@ -48,6 +49,11 @@ uint8_t fBsp_Init(void);
 
 uint8_t fBsp_TickInit(void);
 uint32_t fBsp_GetTick(void);
+uint32_t fBsp_GetCycle(void);
+uint32_t fBsp_GetCycleFrequency(void);
+bool fBsp_IsTickOverflowPending(void);
+
+void fBsp_Sleep(uint32_t durationUs);
 
 uint8_t fBsp_Led_On(void);
 uint8_t fBsp_Led_Off(void);
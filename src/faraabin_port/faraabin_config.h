@@ -65,6 +65,8 @@ extern "C" {
 #define FB_FEATURE_FLAG_MCU_CLI                /*!< This feature ebables you to create FunctionGroups and run your functions in faraabin UI. */
 #define FB_FEATURE_FLAG_BUFFER_OVF             /*!< This features enables the buffer overflow notification. Activating this feature can be time consuming. */
 //#define FB_FEATURE_FLAG_ALLOW_SEND_DICT_BLOCKING /*!< This features enables that dictionary send by blocking fFaraabin_Run() function. */
+//#define FB_FEATURE_FLAG_SECTION_DICT            /*!< This feature enables registering container variables as constant descriptors in "faraabin_dict" linker section. */
+//#define FB_FEATURE_FLAG_DICT_STRING_TABLE       /*!< This feature sends each path and filename of dictionaries once and refers to it by an ID afterwards. */
 
 /** @} */ //End of FB_FEATURE_FLAG
 
@@ -121,14 +123,55 @@ extern "C" {
  * @brief Determines maximum number of concurrent functions that faraabin engine can run.
  * 
  */
-#define FB_MAX_CONCURRENT_FUNCTION	    (2U)
+#define FB_MAX_CONCURRENT_FUNCTION	    (8U)
 
 /**
- * @brief Determines the buffer size dedicated to each function to save their parameters.
+ * @brief Determines the maximum size of the parameters of a single function including the null terminator.
+ *        Larger parameters are rejected when the function is started.
  * 
  */
 #define FB_FUNCTION_PARAM_BUFFER_SIZE   (200U)
 
+/**
+ * @brief Size of each block in the function parameters pool. Parameters of a function occupy contiguous blocks.
+ * 
+ */
+#define FB_FUNCTION_ARG_POOL_BLOCK_SIZE (16U)
+
+/**
+ * @brief Number of blocks in the function parameters pool shared between all concurrent functions.
+ * 
+ */
+#define FB_FUNCTION_ARG_POOL_BLOCK_QTY  (32U)
+
+/**
+ * @brief Maximum time in micro-seconds that function engine can spend on running functions in each pass of fFaraabin_Run().
+ * 
+ * @note Keep it below the period of the loop that calls fFaraabin_Run(), otherwise functions can take the whole loop.
+ * 
+ */
+#define FB_FUNCTION_ENGINE_PASS_BUDGET_US (500U)
+
+/**
+ * @brief Default budget in micro-seconds of each function slice. Slices taking longer are counted as overrun.
+ * 
+ */
+#define FB_FUNCTION_SLICE_BUDGET_US     (500U)
+
+/**
+ * @brief Number of distinct strings that can be interned in dictionary string table. Each entry takes 6 bytes of RAM.
+ * 
+ */
+#define FB_DICT_STRING_TABLE_QTY        (32U)
+
+/**
+ * @brief Percentage of the TX buffer that non-blocking dictionary sending fills. The rest is left for live traffic.
+ * 
+ * @note The rest must be larger than the biggest dictionary frame.
+ * 
+ */
+#define FB_DICT_TX_WATERMARK_PERCENT    (50U)
+
 /**
  * @brief Buffer size allocated to the text events in Faraabin.
  * 
@@ -149,17 +192,20 @@ extern "C" {
  * 
  * @note To overcome mixing of the faraabin data that is being generated in different processes(IRQ or Task), faraabin often needs 
  *       to disable all interrupts and reenable them after generating the frame.
+ * @note Memory barrier is used by lock-free queues that are filled in an IRQ, so that data is stored before the index that publishes it.
  * 
  */
 #if   defined ( __CC_ARM )
 
 #define FB_PORT_DISABLE_IRQ		__disable_irq()   /*!< Disables all interrupts in embedded software. */
 #define FB_PORT_ENABLE_IRQ		__enable_irq()    /*!< Eanbles configured interrupts in embedded software. */
+#define FB_PORT_MEMORY_BARRIER	__dmb(0xF)        /*!< Completes all memory accesses before the next one. */
 
 #elif defined ( __ARMCC_VERSION ) && ( __ARMCC_VERSION >= 6010050 )
 
 #define FB_PORT_DISABLE_IRQ
 #define FB_PORT_ENABLE_IRQ
+#define FB_PORT_MEMORY_BARRIER	__asm volatile ("dmb 0xF" ::: "memory")
 
 #elif defined ( __GNUC__ )
 
@@ -167,6 +213,7 @@ extern "C" {
 
 #define FB_PORT_DISABLE_IRQ		__disable_irq()   /*!< Disables all interrupts in embedded software. */
 #define FB_PORT_ENABLE_IRQ		__enable_irq()    /*!< Eanbles configured interrupts in embedded software. */
+#define FB_PORT_MEMORY_BARRIER	__DMB()           /*!< Completes all memory accesses before the next one. */
 
 #elif defined ( __ICCARM__ )
 
@@ -174,21 +221,25 @@ extern "C" {
 
 #define FB_PORT_DISABLE_IRQ		__disable_interrupt()   /*!< Disables all interrupts in embedded software. */
 #define FB_PORT_ENABLE_IRQ		__enable_interrupt()    /*!< Eanbles configured interrupts in embedded software. */
+#define FB_PORT_MEMORY_BARRIER	__DMB()                 /*!< Completes all memory accesses before the next one. */
 
 #elif defined ( __TI_ARM__ )
 
 #define FB_PORT_DISABLE_IRQ
 #define FB_PORT_ENABLE_IRQ
+#define FB_PORT_MEMORY_BARRIER
 
 #elif defined ( __CSMC__ )
 
 #define FB_PORT_DISABLE_IRQ
 #define FB_PORT_ENABLE_IRQ
+#define FB_PORT_MEMORY_BARRIER
 
 #elif defined ( __TASKING__ )
 
 #define FB_PORT_DISABLE_IRQ
 #define FB_PORT_ENABLE_IRQ
+#define FB_PORT_MEMORY_BARRIER
 
 #else
   #error Unknown compiler
@@ -64,7 +64,7 @@
     - The following methods need an instantiated sChrono object:
       - fChrono_Start(), fChrono_Stop(), fChrono_ElapsedS(), fChrono_ElapsedMs(), fChrono_ElapsedUs(), fChrono_LeftS(),
         fChrono_LeftMs(), fChrono_LeftUs(), fChrono_StartTimeoutS(), fChrono_StartTimeoutMs(), fChrono_StartTimeoutUs(),
-        fChrono_IsTimeout(), fChrono_IntervalS(), fChrono_IntervalMs() and fChrono_IntervalUs().
+        fChrono_RestartTimeoutS(), fChrono_RestartTimeoutMs(), fChrono_RestartTimeoutUs(), fChrono_IsTimeout(), fChrono_IntervalS(), fChrono_IntervalMs() and fChrono_IntervalUs().
     - These methods are primarily used for creating time stamps and measuring time intervals. They require a variable of type sChrono to perform their tasks.
   
   2- Functions that Do Not Require a Chrono Object:
@@ -93,6 +93,8 @@
   - Query whether the chrono is timed out or not using fChrono_IsTimeout().
   - To stop the chrono object, call fChrono_Stop(). This action puts the object in the stop state, and checking its timeout state will return FALSE.
   - To determine the remaining time until the chrono times out, use fChrono_LeftS(), fChrono_LeftMs(), or fChrono_LeftUs().
+  - For a periodic timeout, restart it with fChrono_RestartTimeoutS(), fChrono_RestartTimeoutMs() or fChrono_RestartTimeoutUs()
+    after it times out. The next period starts at the deadline of the last one, so the lateness of the loop doesn't add up to drift.
 
   ### Generating time delay
   For creating time delays, there is no need to instantiate a chrono object. Simply call one of the following functions:
@@ -119,6 +121,31 @@
   - If the tick generator experiences an overflow (just once), these functions will handle it and return the correct result.
   - However, if the tick generator has overflowed more than once, the time span measurement is no longer valid.
 
+  ### 64-bit monotonic tick
+  To measure time lengths longer than one overflow of the tick generator:
+  - In chrono_config.h file, set CHRONO_TICK_EXTENSION to TICK_EXTENSION_ENABLED.
+  - Call fChrono_TickOverflowHandler() in the overflow interrupt of the tick generator.
+  - Optionally, call fChrono_SetTickOverflowPendingCallback() with a function that returns the pending state of this interrupt.
+  - fChrono_GetTick64() returns the number of ticks since fChrono_Init() and fChrono_GetContinuousTickUs(), fChrono_GetContinuousTickMs()
+    and fChrono_GetContinuousTickS() are derived from it, so they stay valid without being called once per overflow.
+
+  ### Inline fast path
+  For tight loops, chrono_inline.h provides fChrono_GetTickInline(), fChrono_IsTimeoutInline() and fChrono_ElapsedUsInline():
+  - In chrono_config.h file, set CHRONO_INLINE to INLINE_ENABLED and define CHRONO_INLINE_TICK_() to read the tick generator directly.
+  - Optionally, set CHRONO_INLINE_ASSERT to INLINE_ASSERT_DISABLED in release builds to remove their null pointer checks.
+  - Include chrono_inline.h where the inline functions are used. They work on the same sChrono objects as this file.
+
+  ### Clock domains
+  To measure time with more than one tick generator, e.g. a cycle counter for profiling and a slow wide timer for long timeouts:
+  - In chrono_config.h file, set CHRONO_DOMAIN_QTY to the number of tick generators. The one of fChrono_Init() is CHRONO_DOMAIN_DEFAULT.
+  - After fChrono_Init(), call fChrono_DomainInit() for each additional domain with its tick, top value, frequency and counter mode.
+  - Start a chrono object in a domain with fChrono_StartIn() or fChrono_StartTimeoutSIn(), fChrono_StartTimeoutMsIn() and
+    fChrono_StartTimeoutUsIn(). The objective API then uses the ticks and the conversion coefficients of that domain until
+    the object is started again. fChrono_Start() and fChrono_StartTimeoutX() always start in the default domain, so objects,
+    including uninitialized automatic ones, never measure in another domain unless they are started there.
+  - The functional API, the continuous ticks and the 64-bit tick always use the default domain. fChrono_GetDomainTick() reads
+    the tick of another domain.
+
   ******************************************************************************
   Below is an example of how you can use the chrono module API for a generic application.
 
@@ -186,19 +213,63 @@
 /* Private define ------------------------------------------------------------*/
 /* Private macro -------------------------------------------------------------*/
 /**
- * @brief Returns the time length between "a" and "b".
+ * @brief Returns the time length between "a" and "b" for a tick generator that counts up or down to "top".
  * 
  * @note Chronologically, "a" must be a time tick after "b", but the value of "a" could be less than "b" i.e., when tick overflows.
  * 
  */
-#if(CHRONO_TICK_COUNTERMODE == TICK_COUNTERMODE_UP)
-#define ELAPSED_(a, b)  (((a) >= (b)) ? ((a) - (b)) : ((_chrono.TickTopValue) - ((b) - (a))))
-#elif(CHRONO_TICK_COUNTERMODE == TICK_COUNTERMODE_DOWN)
-#define ELAPSED_(a, b)  (((a) <= (b)) ? ((b) - (a)) : ((_chrono.TickTopValue) - ((a) - (b))))
-#else
+#define ELAPSED_UP_(top, a, b)    (((a) >= (b)) ? ((a) - (b)) : ((top) - ((b) - (a))))
+#define ELAPSED_DOWN_(top, a, b)  (((a) <= (b)) ? ((b) - (a)) : ((top) - ((a) - (b))))
+
+/**
+ * @brief Returns the tick that is "n" ticks after "a" for a tick generator that counts up or down to "top".
+ * 
+ * @note It is the inverse of ELAPSED_, i.e. ELAPSED_(d, ADVANCE_(d, a, n), a) is equal to "n".
+ * 
+ */
+#define ADVANCE_UP_(top, a, n)    ((((top) - (a)) >= (n)) ? ((a) + (n)) : ((n) - ((top) - (a))))
+#define ADVANCE_DOWN_(top, a, n)  (((a) >= (n)) ? ((a) - (n)) : ((top) - ((n) - (a))))
+
+#if((CHRONO_TICK_COUNTERMODE != TICK_COUNTERMODE_UP) && (CHRONO_TICK_COUNTERMODE != TICK_COUNTERMODE_DOWN))
 #error "CHRONO_TICK_COUNTERMODE should be either TICK_COUNTERMODE_UP or TICK_COUNTERMODE_DOWN in chrono_config.h file."
 #endif
 
+/**
+ * @brief Returns the time length between "a" and "b", and the tick that is "n" ticks after "a", in the clock domain "d".
+ * 
+ * @note With a single clock domain, the counter mode is the one of chrono_config.h and is resolved at compile time.
+ *       Otherwise, each domain has its own counter mode.
+ * 
+ */
+#if (CHRONO_DOMAIN_QTY > 1U)
+#define ELAPSED_(d, a, b)  (((d)->CounterMode == TICK_COUNTERMODE_UP) ? ELAPSED_UP_((d)->TickTopValue, a, b) : ELAPSED_DOWN_((d)->TickTopValue, a, b))
+#define ADVANCE_(d, a, n)  (((d)->CounterMode == TICK_COUNTERMODE_UP) ? ADVANCE_UP_((d)->TickTopValue, a, n) : ADVANCE_DOWN_((d)->TickTopValue, a, n))
+#elif(CHRONO_TICK_COUNTERMODE == TICK_COUNTERMODE_UP)
+#define ELAPSED_(d, a, b)  ELAPSED_UP_((d)->TickTopValue, a, b)
+#define ADVANCE_(d, a, n)  ADVANCE_UP_((d)->TickTopValue, a, n)
+#else
+#define ELAPSED_(d, a, b)  ELAPSED_DOWN_((d)->TickTopValue, a, b)
+#define ADVANCE_(d, a, n)  ADVANCE_DOWN_((d)->TickTopValue, a, n)
+#endif
+
+/**
+ * @brief Returns the clock domain of the tick generator that is given to fChrono_Init().
+ * 
+ */
+#define DOMAIN_DEFAULT_ (&_chrono.Domains[CHRONO_DOMAIN_DEFAULT])
+
+/**
+ * @brief Returns the clock domain that the chrono object is bound to.
+ * 
+ * @note Invalid domains, e.g. of a chrono object on the stack that is not bound, fall back to the default domain.
+ * 
+ */
+#if (CHRONO_DOMAIN_QTY > 1U)
+#define DOMAIN_(me_)  (((me_)->_domain < CHRONO_DOMAIN_QTY) ? &_chrono.Domains[(me_)->_domain] : DOMAIN_DEFAULT_)
+#else
+#define DOMAIN_(me_)  DOMAIN_DEFAULT_
+#endif
+
 /**
  * @brief Checks whether the chrono object is in the run state or not.
  * 
@@ -213,10 +284,21 @@
  * @note If the chrono object is not initialized, this macro forces the API to return the values specified by "ret".
  * 
  */
-#define CHECK_INIT_RET_(ret)      if(!_chrono.Init){return (ret);}
-#define CHECK_INIT_US_RET_(ret)   if(!_chrono.InitUs){return (ret);}
-#define CHECK_INIT_MS_RET_(ret)   if(!_chrono.InitMs){return (ret);}
-#define CHECK_INIT_SEC_RET_(ret)  if(!_chrono.InitSec){return (ret);}
+#define CHECK_INIT_RET_(ret)      if(!DOMAIN_DEFAULT_->Init){return (ret);}
+#define CHECK_INIT_US_RET_(ret)   if(!DOMAIN_DEFAULT_->InitUs){return (ret);}
+#define CHECK_INIT_MS_RET_(ret)   if(!DOMAIN_DEFAULT_->InitMs){return (ret);}
+#define CHECK_INIT_SEC_RET_(ret)  if(!DOMAIN_DEFAULT_->InitSec){return (ret);}
+
+/**
+ * @brief Checks whether the clock domain "d" is initialized or not.
+ * 
+ * @note If the domain is not initialized, this macro forces the API to return the values specified by "ret".
+ * 
+ */
+#define CHECK_DOMAIN_INIT_RET_(d, ret)      if(!(d)->Init){return (ret);}
+#define CHECK_DOMAIN_INIT_US_RET_(d, ret)   if(!(d)->InitUs){return (ret);}
+#define CHECK_DOMAIN_INIT_MS_RET_(d, ret)   if(!(d)->InitMs){return (ret);}
+#define CHECK_DOMAIN_INIT_SEC_RET_(d, ret)  if(!(d)->InitSec){return (ret);}
 
 /**
  * @brief Asserts whether the object is null or not.
@@ -233,21 +315,65 @@
  * @note If the chrono object is not initialized, this macro forces the API to return.
  * 
  */
-#define CHECK_INIT_()     if(!_chrono.Init){return;}
-#define CHECK_INIT_US_()  if(!_chrono.InitUs){return;}
-#define CHECK_INIT_MS_()  if(!_chrono.InitMs){return;}
-#define CHECK_INIT_SEC_() if(!_chrono.InitSec){return;}
+#define CHECK_INIT_()     if(!DOMAIN_DEFAULT_->Init){return;}
+#define CHECK_INIT_US_()  if(!DOMAIN_DEFAULT_->InitUs){return;}
+#define CHECK_INIT_MS_()  if(!DOMAIN_DEFAULT_->InitMs){return;}
+#define CHECK_INIT_SEC_() if(!DOMAIN_DEFAULT_->InitSec){return;}
+
+/**
+ * @brief Checks whether the clock domain "d" is initialized or not.
+ * 
+ * @note If the domain is not initialized, this macro forces the API to return.
+ * 
+ */
+#define CHECK_DOMAIN_INIT_US_(d)  if(!(d)->InitUs){return;}
+#define CHECK_DOMAIN_INIT_MS_(d)  if(!(d)->InitMs){return;}
+#define CHECK_DOMAIN_INIT_SEC_(d) if(!(d)->InitSec){return;}
+
+/**
+ * @brief Converts a number of ticks of the clock domain "d" to seconds, milliseconds & microseconds.
+ * 
+ * @note The conversion is a multiply-shift by the reciprocals precomputed when the domain is initialized and it is
+ *       bit-exact with dividing by SecToTickCoef, MsToTickCoef & UsToTickCoef.
+ * 
+ */
+#define TICK_TO_S_(d, tick_)   fTickDivide(&(d)->SecReciprocal, (d)->SecToTickCoef, (tick_t)(tick_))
+#define TICK_TO_MS_(d, tick_)  fTickDivide(&(d)->MsReciprocal, (d)->MsToTickCoef, (tick_t)(tick_))
+#define TICK_TO_US_(d, tick_)  fTickDivide(&(d)->UsReciprocal, (d)->UsToTickCoef, (tick_t)(tick_))
 
 /* Private typedef -----------------------------------------------------------*/
+/**
+ * @brief Fixed-point reciprocal of a 32-bit divisor.
+ * 
+ * @note n / d == (t + ((n - t) >> 1)) >> Shift, where t is the high word of (Magic * n).
+ *       For power of two divisors the result is n >> Shift.
+ * 
+ */
+typedef struct {
+
+	uint32_t Magic; // Low 32 bits of the 33-bit multiplier.
+
+	uint8_t Shift; // Post shift of the multiply-shift division.
+
+	bool_t IsPowerOfTwo; // Division is a single shift.
+
+}sChronoReciprocal;
+
+/**
+ * @brief Clock domain, i.e. a tick generator and the coefficients that convert its ticks to time.
+ * 
+ */
 typedef struct {
 
-	bool_t Init;
+	bool_t Init; // Holds whether the domain is initialized.
 	
-	bool_t InitUs;
+	bool_t InitUs; // Holds whether the ticks of the domain can be converted to microseconds.
 	
-	bool_t InitMs;
+	bool_t InitMs; // Holds whether the ticks of the domain can be converted to milliseconds.
 	
-	bool_t InitSec;
+	bool_t InitSec; // Holds whether the ticks of the domain can be converted to seconds.
+
+	uint8_t CounterMode; // Counting mode of the tick generator, TICK_COUNTERMODE_UP or TICK_COUNTERMODE_DOWN.
 
 	uint32_t TickToNsCoef; // Multiplier that converts ticks to nanosecond.
 
@@ -257,7 +383,29 @@ typedef struct {
 
 	uint32_t SecToTickCoef; // Multiplier that converts seconds to ticks.
 
-	tick_t TickTopValue; // The tick top value. This private value is set by calling fChrono_Init().
+	sChronoReciprocal UsReciprocal; // Reciprocal of UsToTickCoef for converting ticks to microseconds without division.
+
+	sChronoReciprocal MsReciprocal; // Reciprocal of MsToTickCoef for converting ticks to milliseconds without division.
+
+	sChronoReciprocal SecReciprocal; // Reciprocal of SecToTickCoef for converting ticks to seconds without division.
+
+	tick_t TickTopValue; // The tick top value of the tick generator.
+
+#if (CHRONO_TICK_TYPE == TICK_TYPE_VARIABLE)
+
+	volatile tick_t *pTickValue; // Pointer to an unsigned integer that hold current value of the tick.
+
+#elif (CHRONO_TICK_TYPE == TICK_TYPE_FUNCTION)
+
+	tick_t(*GetTickValue)(void); // Function pointer to a function that returns current value of the tick.
+
+#endif
+
+}sChronoDomain;
+
+typedef struct {
+
+	sChronoDomain Domains[CHRONO_DOMAIN_QTY]; // Clock domains. The default domain is set by calling fChrono_Init() and the others by fChrono_DomainInit().
 
 	tick_t TickInitValue; // The tick init value. This private value is tick value when calling fChrono_Init().
 
@@ -273,13 +421,13 @@ typedef struct {
 
 	uint64_t ContinuousTickS; // Time length in seconds since initializing the chrono module.
 
-#if (CHRONO_TICK_TYPE == TICK_TYPE_VARIABLE)
+#if (CHRONO_TICK_EXTENSION == TICK_EXTENSION_ENABLED)
 
-	volatile tick_t *pTickValue; // Pointer to an unsigned integer that hold current value of the tick.
+	volatile uint32_t TickEpoch; // Number of tick generator overflows since fChrono_Init(). It is only written by fChrono_TickOverflowHandler().
 
-#elif (CHRONO_TICK_TYPE == TICK_TYPE_FUNCTION)
+	uint64_t Tick64InitValue; // The 64-bit tick when calling fChrono_Init().
 
-	tick_t(*GetTickValue)(void); // Function pointer to a function that returns current value of the tick.
+	bool_t(*IsTickOverflowPending)(void); // Function pointer to a function that returns TRUE if the overflow interrupt of the tick generator is pending.
 
 #endif
 
@@ -288,22 +436,41 @@ typedef struct {
 /* Private variables ---------------------------------------------------------*/
 static sChronoInternal _chrono = {
 	
-	.Init = FALSE,
-	.InitUs = FALSE,
-	.InitMs = FALSE,
-	.InitSec = FALSE,
-	.TickToNsCoef = 1U,
-	.UsToTickCoef = 1U,
-	.MsToTickCoef = 1U,
-	.SecToTickCoef = 1U,
+	.Domains[CHRONO_DOMAIN_DEFAULT] = {
+		.Init = FALSE,
+		.InitUs = FALSE,
+		.InitMs = FALSE,
+		.InitSec = FALSE,
+		.TickToNsCoef = 1U,
+		.UsToTickCoef = 1U,
+		.MsToTickCoef = 1U,
+		.SecToTickCoef = 1U,
 #if (CHRONO_TICK_TYPE == TICK_TYPE_VARIABLE)
-	.pTickValue = NULL,
+		.pTickValue = NULL,
 #elif (CHRONO_TICK_TYPE == TICK_TYPE_FUNCTION)
-	.GetTickValue = NULL
+		.GetTickValue = NULL
 #endif
+	}
 };
 
 /* Private function prototypes -----------------------------------------------*/
+static void fReciprocalInit(sChronoReciprocal * const me, uint32_t divisor);
+static tick_t fTickDivide(sChronoReciprocal const * const reciprocal, uint32_t divisor, tick_t tick);
+#if (CHRONO_TICK_EXTENSION == TICK_EXTENSION_ENABLED)
+static uint64_t fTickExtend(uint32_t epoch, tick_t tick);
+#endif
+static void fRestartTimeout(sChrono * const me, tick_t timeout);
+static tick_t fStartIn(sChrono * const me, uint8_t domain);
+static void fStartTimeoutSIn(sChrono * const me, uint8_t domain, timeS_t timeout);
+static void fStartTimeoutMsIn(sChrono * const me, uint8_t domain, timeMs_t timeout);
+static void fStartTimeoutUsIn(sChrono * const me, uint8_t domain, timeUs_t timeout);
+static tick_t fDomainGetTick(sChronoDomain const * const domain);
+static void fDomainClear(sChronoDomain * const me);
+static void fDomainSetup(sChronoDomain * const me, tick_t tickTopValue, uint32_t tickToNsCoef, uint32_t usToTickCoef, uint32_t msToTickCoef, uint32_t secToTickCoef, uint8_t counterMode);
+#if (CHRONO_DOMAIN_QTY > 1U)
+static uint8_t fDomainCheck(uint8_t domain, tick_t tickTopValue, uint32_t tickFrequencyHz, uint8_t counterMode);
+#endif
+
 /* Variables -----------------------------------------------------------------*/
 
 /*
@@ -336,10 +503,9 @@ static sChronoInternal _chrono = {
  */
 uint8_t fChrono_Init(volatile tick_t *tickValue) {
   
-  _chrono.Init = FALSE;
-  _chrono.InitUs = FALSE;
-  _chrono.InitMs = FALSE;
-  _chrono.InitSec = FALSE;
+  for(uint8_t i = 0U; i < CHRONO_DOMAIN_QTY; i++) {
+    fDomainClear(&_chrono.Domains[i]);
+  }
 
   if(CHRONO_TICK_TOP_VALUE == 0U) {
     return CHRONO_ERROR_TICK_TOP_ZERO; /* MISRA 2012 Rule 15.5 deviation */
@@ -353,22 +519,19 @@ uint8_t fChrono_Init(volatile tick_t *tickValue) {
     return CHRONO_ERROR_TICK_PTR_ERROR; /* MISRA 2012 Rule 15.5 deviation */
   }
   
-  _chrono.TickTopValue = CHRONO_TICK_TOP_VALUE;
-  _chrono.TickToNsCoef = CHRONO_TICK_TO_NANOSECOND_COEF;
-  _chrono.pTickValue = tickValue;
-
-  _chrono.UsToTickCoef = (1000U / CHRONO_TICK_TO_NANOSECOND_COEF);
-  _chrono.MsToTickCoef = (1000000U / CHRONO_TICK_TO_NANOSECOND_COEF);
-  _chrono.SecToTickCoef = (1000000000U / CHRONO_TICK_TO_NANOSECOND_COEF);
+  DOMAIN_DEFAULT_->pTickValue = tickValue;
   
   _chrono.ContinuousTickUs = 0U;
 	_chrono.ContinuousTickMs = 0U;
 	_chrono.ContinuousTickS = 0U;
 	
-  _chrono.Init = TRUE;
-  _chrono.InitUs = (_chrono.UsToTickCoef != 0U);
-  _chrono.InitMs = (_chrono.MsToTickCoef != 0U);
-  _chrono.InitSec = (_chrono.SecToTickCoef != 0U);
+  fDomainSetup(DOMAIN_DEFAULT_,
+               CHRONO_TICK_TOP_VALUE,
+               CHRONO_TICK_TO_NANOSECOND_COEF,
+               (1000U / CHRONO_TICK_TO_NANOSECOND_COEF),
+               (1000000U / CHRONO_TICK_TO_NANOSECOND_COEF),
+               (1000000000U / CHRONO_TICK_TO_NANOSECOND_COEF),
+               CHRONO_TICK_COUNTERMODE);
   
 	fChrono_Start(&_chrono.ChronoTickUs);
 	fChrono_Start(&_chrono.ChronoTickMs);
@@ -376,6 +539,11 @@ uint8_t fChrono_Init(volatile tick_t *tickValue) {
 
   _chrono.TickInitValue = fChrono_GetTick();
 
+#if (CHRONO_TICK_EXTENSION == TICK_EXTENSION_ENABLED)
+  _chrono.TickEpoch = 0U;
+  _chrono.Tick64InitValue = fTickExtend(0U, _chrono.TickInitValue);
+#endif
+
   return CHRONO_OK;
 }
 #elif (CHRONO_TICK_TYPE == TICK_TYPE_FUNCTION)
@@ -395,11 +563,10 @@ uint8_t fChrono_Init(volatile tick_t *tickValue) {
  * @retval initStatus: returns 0 if successful and 1 if it fails.
  */
 uint8_t fChrono_Init(tick_t(*fpTickValue)(void)) {
-
-  _chrono.Init = FALSE;
-  _chrono.InitUs = FALSE;
-  _chrono.InitMs = FALSE;
-  _chrono.InitSec = FALSE;
+  
+  for(uint8_t i = 0U; i < CHRONO_DOMAIN_QTY; i++) {
+    fDomainClear(&_chrono.Domains[i]);
+  }
 
   if(CHRONO_TICK_TOP_VALUE == 0U) {
     return CHRONO_ERROR_TICK_TOP_ZERO; /* MISRA 2012 Rule 15.5 deviation */
@@ -413,22 +580,19 @@ uint8_t fChrono_Init(tick_t(*fpTickValue)(void)) {
     return CHRONO_ERROR_TICK_PTR_ERROR; /* MISRA 2012 Rule 15.5 deviation */
   }
   
-  _chrono.TickTopValue = CHRONO_TICK_TOP_VALUE;
-  _chrono.TickToNsCoef = CHRONO_TICK_TO_NANOSECOND_COEF;
-  _chrono.GetTickValue = fpTickValue;
-
-  _chrono.UsToTickCoef = (1000U / CHRONO_TICK_TO_NANOSECOND_COEF);
-  _chrono.MsToTickCoef = (1000000U / CHRONO_TICK_TO_NANOSECOND_COEF);
-  _chrono.SecToTickCoef = (1000000000U / CHRONO_TICK_TO_NANOSECOND_COEF);
-
+  DOMAIN_DEFAULT_->GetTickValue = fpTickValue;
+  
   _chrono.ContinuousTickUs = 0U;
 	_chrono.ContinuousTickMs = 0U;
 	_chrono.ContinuousTickS = 0U;
 	
-  _chrono.Init = TRUE;
-  _chrono.InitUs = (_chrono.UsToTickCoef != 0U);
-  _chrono.InitMs = (_chrono.MsToTickCoef != 0U);
-  _chrono.InitSec = (_chrono.SecToTickCoef != 0U);
+  fDomainSetup(DOMAIN_DEFAULT_,
+               CHRONO_TICK_TOP_VALUE,
+               CHRONO_TICK_TO_NANOSECOND_COEF,
+               (1000U / CHRONO_TICK_TO_NANOSECOND_COEF),
+               (1000000U / CHRONO_TICK_TO_NANOSECOND_COEF),
+               (1000000000U / CHRONO_TICK_TO_NANOSECOND_COEF),
+               CHRONO_TICK_COUNTERMODE);
   
 	fChrono_Start(&_chrono.ChronoTickUs);
 	fChrono_Start(&_chrono.ChronoTickMs);
@@ -436,10 +600,106 @@ uint8_t fChrono_Init(tick_t(*fpTickValue)(void)) {
 
   _chrono.TickInitValue = fChrono_GetTick();
 
+#if (CHRONO_TICK_EXTENSION == TICK_EXTENSION_ENABLED)
+  _chrono.TickEpoch = 0U;
+  _chrono.Tick64InitValue = fTickExtend(0U, _chrono.TickInitValue);
+#endif
+
   return CHRONO_OK;
 }
 #endif
 
+#if (CHRONO_DOMAIN_QTY > 1U)
+
+#if (CHRONO_TICK_TYPE == TICK_TYPE_VARIABLE)
+
+/**
+ * @brief Initializes an additional clock domain in VARIABLE mode.
+ * 
+ * @attention fChrono_Init() must be called first. It clears all the additional domains.
+ * 
+ * @note A clock domain is a tick generator with its own top value, frequency and counter mode, e.g. a cycle counter for
+ *       profiling or a low-power counter for long timeouts. Chrono objects measure time in the domain they are started in
+ *       with fChrono_StartIn(), and the functional API always uses the default domain of fChrono_Init().
+ * 
+ * @note The conversion coefficients are the number of ticks per microsecond, millisecond and second, so they are exact
+ *       for frequencies that are multiples of 1MHz, 1kHz and 1Hz respectively. Units finer than one tick are not available.
+ * 
+ * @param domain Clock domain, from 1 to CHRONO_DOMAIN_QTY - 1
+ * @param tickValue Pointer to the memory location that contains the tick value.
+ * @param tickTopValue Top value of the tick generator
+ * @param tickFrequencyHz Frequency of the tick generator (Hz)
+ * @param counterMode TICK_COUNTERMODE_UP or TICK_COUNTERMODE_DOWN
+ * @retval initStatus: CHRONO_OK if successful, otherwise one of the CHRONO_ERROR_ values
+ */
+uint8_t fChrono_DomainInit(uint8_t domain, volatile tick_t *tickValue, tick_t tickTopValue, uint32_t tickFrequencyHz, uint8_t counterMode) {
+  
+  uint8_t ret = fDomainCheck(domain, tickTopValue, tickFrequencyHz, counterMode);
+  
+  if(ret != CHRONO_OK) {
+    return ret; /* MISRA 2012 Rule 15.5 deviation */
+  }
+  
+  if(tickValue == NULL) {
+    return CHRONO_ERROR_TICK_PTR_ERROR; /* MISRA 2012 Rule 15.5 deviation */
+  }
+  
+  _chrono.Domains[domain].pTickValue = tickValue;
+  
+  fDomainSetup(&_chrono.Domains[domain],
+               tickTopValue,
+               (1000000000U / tickFrequencyHz),
+               (tickFrequencyHz / 1000000U),
+               (tickFrequencyHz / 1000U),
+               tickFrequencyHz,
+               counterMode);
+  
+  return CHRONO_OK;
+}
+
+#elif (CHRONO_TICK_TYPE == TICK_TYPE_FUNCTION)
+
+/**
+ * @brief Initializes an additional clock domain in FUNCTION mode.
+ * 
+ * @note Refer to the VARIABLE mode of fChrono_DomainInit() for more information.
+ * 
+ * @param domain Clock domain, from 1 to CHRONO_DOMAIN_QTY - 1
+ * @param fpTickValue Pointer to the function that returns tick value.
+ * @param tickTopValue Top value of the tick generator
+ * @param tickFrequencyHz Frequency of the tick generator (Hz)
+ * @param counterMode TICK_COUNTERMODE_UP or TICK_COUNTERMODE_DOWN
+ * @retval initStatus: CHRONO_OK if successful, otherwise one of the CHRONO_ERROR_ values
+ */
+uint8_t fChrono_DomainInit(uint8_t domain, tick_t(*fpTickValue)(void), tick_t tickTopValue, uint32_t tickFrequencyHz, uint8_t counterMode) {
+  
+  uint8_t ret = fDomainCheck(domain, tickTopValue, tickFrequencyHz, counterMode);
+  
+  if(ret != CHRONO_OK) {
+    return ret; /* MISRA 2012 Rule 15.5 deviation */
+  }
+  
+  if(fpTickValue == NULL) {
+    return CHRONO_ERROR_TICK_PTR_ERROR; /* MISRA 2012 Rule 15.5 deviation */
+  }
+  
+  _chrono.Domains[domain].GetTickValue = fpTickValue;
+  
+  fDomainSetup(&_chrono.Domains[domain],
+               tickTopValue,
+               (1000000000U / tickFrequencyHz),
+               (tickFrequencyHz / 1000000U),
+               (tickFrequencyHz / 1000U),
+               tickFrequencyHz,
+               counterMode);
+  
+  return CHRONO_OK;
+}
+
+#endif
+
+#endif
+
 /** @} */ //End of INIT_FUNCTION
 
 /** @defgroup FUNCTIONAL_API Functional API in chrono module
@@ -455,11 +715,11 @@ uint8_t fChrono_Init(tick_t(*fpTickValue)(void)) {
  */
 bool_t fChrono_IsTickUsAvailable(void) {
   
-  if(!_chrono.Init) {
+  if(!DOMAIN_DEFAULT_->Init) {
     return false;
   }
   
-  return _chrono.InitUs;
+  return DOMAIN_DEFAULT_->InitUs;
 }
 
 /**
@@ -469,11 +729,11 @@ bool_t fChrono_IsTickUsAvailable(void) {
  */
 bool_t fChrono_IsTickMsAvailable(void) {
   
-  if(!_chrono.Init) {
+  if(!DOMAIN_DEFAULT_->Init) {
     return false;
   }
   
-  return _chrono.InitMs;
+  return DOMAIN_DEFAULT_->InitMs;
 }
 
 /**
@@ -483,11 +743,11 @@ bool_t fChrono_IsTickMsAvailable(void) {
  */
 bool_t fChrono_IsTickSAvailable(void) {
   
-  if(!_chrono.Init) {
+  if(!DOMAIN_DEFAULT_->Init) {
     return false;
   }
   
-  return _chrono.InitSec;
+  return DOMAIN_DEFAULT_->InitSec;
 }
 
 /**
@@ -513,20 +773,7 @@ tick_t fChrono_GetTick(void) {
 
   CHECK_INIT_RET_((tick_t)0); /* MISRA 2012 Rule 15.5 deviation */
   
-#if (CHRONO_TICK_TYPE == TICK_TYPE_VARIABLE)
-
-  return *_chrono.pTickValue;
-
-#elif (CHRONO_TICK_TYPE == TICK_TYPE_FUNCTION)
-
-  return _chrono.GetTickValue();
-
-#else
-  
-  return (tick_t)0;
-  
-#endif
-  
+  return fDomainGetTick(DOMAIN_DEFAULT_);
 }
 
 /**
@@ -535,15 +782,27 @@ tick_t fChrono_GetTick(void) {
  * @attention Always remember to call this function before tick generator overflows. For example if tick generator reaches its topValue in 71 minutes,
  *            make sure fChrono_GetContinuousTickUs() is called once in this interval.
  *
+ * @note If CHRONO_TICK_EXTENSION is enabled, the time is derived from fChrono_GetTick64() and the attention above does not apply.
+ *
  * @retval continuousTickTime: Time length since calling fChrono_Init() in milliseconds
  */
 uint64_t fChrono_GetContinuousTickUs(void) {
   
+#if (CHRONO_TICK_EXTENSION == TICK_EXTENSION_ENABLED)
+
+  CHECK_INIT_US_RET_(0U); /* MISRA 2012 Rule 15.5 deviation */
+  
+  return fChrono_GetTick64() / (uint64_t)DOMAIN_DEFAULT_->UsToTickCoef;
+
+#else
+
   _chrono.ContinuousTickUs += (uint64_t)fChrono_ElapsedUs(&_chrono.ChronoTickUs);
   
   fChrono_Start(&_chrono.ChronoTickUs);
   
   return _chrono.ContinuousTickUs;
+
+#endif
 }
 
 /**
@@ -552,15 +811,27 @@ uint64_t fChrono_GetContinuousTickUs(void) {
  * @attention Always remember to call this function before tick generator overflows. For example if tick generator reaches its topValue in 71 minutes,
  *            make sure fChrono_GetContinuousTickMs() is called once in this interval.
  *
+ * @note If CHRONO_TICK_EXTENSION is enabled, the time is derived from fChrono_GetTick64() and the attention above does not apply.
+ *
  * @retval continuousTickTime: Time length since calling fChrono_Init() in milliseconds
  */
 uint64_t fChrono_GetContinuousTickMs(void) {
   
+#if (CHRONO_TICK_EXTENSION == TICK_EXTENSION_ENABLED)
+
+  CHECK_INIT_MS_RET_(0U); /* MISRA 2012 Rule 15.5 deviation */
+  
+  return fChrono_GetTick64() / (uint64_t)DOMAIN_DEFAULT_->MsToTickCoef;
+
+#else
+
   _chrono.ContinuousTickMs += (uint64_t)fChrono_ElapsedMs(&_chrono.ChronoTickMs);
   
   fChrono_Start(&_chrono.ChronoTickMs);
   
   return _chrono.ContinuousTickMs;
+
+#endif
 }
 
 /**
@@ -569,17 +840,147 @@ uint64_t fChrono_GetContinuousTickMs(void) {
  * @attention Always remember to call this function before tick generator overflows. For example if tick generator reaches its topValue in 71 minutes,
  *            make sure fChrono_GetContinuousTickS() is called once in this interval.
  *
+ * @note If CHRONO_TICK_EXTENSION is enabled, the time is derived from fChrono_GetTick64() and the attention above does not apply.
+ *
  * @retval continuousTickTime: Time length since calling fChrono_Init() in milliseconds
  */
 uint64_t fChrono_GetContinuousTickS(void) {
   
+#if (CHRONO_TICK_EXTENSION == TICK_EXTENSION_ENABLED)
+
+  CHECK_INIT_SEC_RET_(0U); /* MISRA 2012 Rule 15.5 deviation */
+  
+  return fChrono_GetTick64() / (uint64_t)DOMAIN_DEFAULT_->SecToTickCoef;
+
+#else
+
   _chrono.ContinuousTickS += (uint64_t)fChrono_ElapsedS(&_chrono.ChronoTickS);
   
   fChrono_Start(&_chrono.ChronoTickS);
   
   return _chrono.ContinuousTickS;
+
+#endif
+}
+
+#if (CHRONO_TICK_EXTENSION == TICK_EXTENSION_ENABLED)
+
+/** @defgroup TICK_EXTENSION
+ *  @ingroup FUNCTIONAL_API
+ *  @brief These functions extend the tick generator to a 64-bit monotonic tick.
+ *  @{
+ */
+
+/**
+ * @brief Counts one overflow of the tick generator. Must be called from its overflow interrupt.
+ * 
+ * @note For example, if SysTick is the tick generator, call this function in SysTick_Handler().
+ * 
+ */
+void fChrono_TickOverflowHandler(void) {
+  
+  _chrono.TickEpoch++;
+}
+
+/**
+ * @brief Sets the function that reports a pending overflow interrupt of the tick generator.
+ * 
+ * @note Without this function, fChrono_GetTick64() is only monotonic in contexts that the overflow interrupt can preempt.
+ *       With it, fChrono_GetTick64() also stays monotonic in higher priority interrupts or while interrupts are disabled,
+ *       as long as the overflow interrupt is not held pending for more than one overflow period.
+ * 
+ * @param fpIsTickOverflowPending Pointer to the function that returns TRUE if the overflow interrupt is pending, or NULL.
+ */
+void fChrono_SetTickOverflowPendingCallback(bool_t(*fpIsTickOverflowPending)(void)) {
+  
+  _chrono.IsTickOverflowPending = fpIsTickOverflowPending;
 }
 
+/**
+ * @brief Returns the number of ticks since calling fChrono_Init() as a 64-bit monotonic value.
+ * 
+ * @note The read is lock-free: the overflow epoch is read, then the tick, then the epoch again. If the overflow interrupt
+ *       ran in between, the read is repeated. If the overflow interrupt is pending, the tick is read again after the overflow
+ *       and one more epoch is counted.
+ * 
+ * @note Each epoch is CHRONO_TICK_TOP_VALUE ticks long, the same overflow period that fChrono_TimeSpanTick() assumes.
+ * 
+ * @retval tick64: Ticks since calling fChrono_Init()
+ */
+uint64_t fChrono_GetTick64(void) {
+  
+  uint32_t epoch;
+  uint32_t pendingEpoch;
+  tick_t tick;
+  
+  CHECK_INIT_RET_(0U); /* MISRA 2012 Rule 15.5 deviation */
+  
+  do {
+    
+    epoch = _chrono.TickEpoch;
+    pendingEpoch = 0U;
+    tick = fChrono_GetTick();
+    
+    if((_chrono.IsTickOverflowPending != NULL) && _chrono.IsTickOverflowPending()) {
+      tick = fChrono_GetTick();
+      pendingEpoch = 1U;
+    }
+    
+  } while(epoch != _chrono.TickEpoch);
+  
+  return fTickExtend(epoch + pendingEpoch, tick) - _chrono.Tick64InitValue;
+}
+
+/** @} */ //End of TICK_EXTENSION
+
+#endif
+
+#if (CHRONO_DOMAIN_QTY > 1U)
+
+/** @defgroup CLOCK_DOMAIN
+ *  @ingroup FUNCTIONAL_API
+ *  @brief These functions return information of a clock domain.
+ *  @{
+ */
+
+/**
+ * @brief Get current tick of a clock domain.
+ * 
+ * @param domain Clock domain
+ * @retval tick: Current tick of the domain (raw). It is 0 if the domain is not initialized.
+ */
+tick_t fChrono_GetDomainTick(uint8_t domain) {
+  
+  if(domain >= CHRONO_DOMAIN_QTY) {
+    return (tick_t)0; /* MISRA 2012 Rule 15.5 deviation */
+  }
+  
+  CHECK_DOMAIN_INIT_RET_(&_chrono.Domains[domain], (tick_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  
+  return fDomainGetTick(&_chrono.Domains[domain]);
+}
+
+/**
+ * @brief Get tick top value of a clock domain.
+ * 
+ * @param domain Clock domain
+ * @retval topValue: Tick top value of the domain. It is 0 if the domain is not initialized.
+ */
+tick_t fChrono_GetDomainTickTopValue(uint8_t domain) {
+  
+  if(domain >= CHRONO_DOMAIN_QTY) {
+    return (tick_t)0; /* MISRA 2012 Rule 15.5 deviation */
+  }
+  
+  CHECK_DOMAIN_INIT_RET_(&_chrono.Domains[domain], (tick_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  
+  return _chrono.Domains[domain].TickTopValue;
+}
+
+/** @} */ //End of CLOCK_DOMAIN
+
+#endif
+
 /**
  * @brief Get Tick top value.
  * 
@@ -591,7 +992,7 @@ tick_t fChrono_GetTickTopValue(void) {
   
   CHECK_INIT_RET_((tick_t)0); /* MISRA 2012 Rule 15.5 deviation */
   
-  return _chrono.TickTopValue;
+  return DOMAIN_DEFAULT_->TickTopValue;
 }
 
 /**
@@ -623,7 +1024,7 @@ uint32_t fChrono_GetTickToNsCoef(void) {
   
   CHECK_INIT_RET_(0U); /* MISRA 2012 Rule 15.5 deviation */
   
-  return _chrono.TickToNsCoef;
+  return DOMAIN_DEFAULT_->TickToNsCoef;
 }
 
 /**
@@ -637,7 +1038,7 @@ uint32_t fChrono_GetTickToNsCoef(void) {
     
     CHECK_INIT_RET_(NULL);  /* MISRA 2012 Rule 15.5 deviation */
   
-    return _chrono.pTickValue;
+    return DOMAIN_DEFAULT_->pTickValue;
   }
 
 #elif (CHRONO_TICK_TYPE == TICK_TYPE_FUNCTION)
@@ -646,7 +1047,7 @@ uint32_t fChrono_GetTickToNsCoef(void) {
     
     CHECK_INIT_RET_(NULL);
     
-    return _chrono.GetTickValue;
+    return DOMAIN_DEFAULT_->GetTickValue;
   }
 
 #else
@@ -664,7 +1065,7 @@ timeS_t fChrono_GetMaxMeasurableTimeS(void) {
   
   CHECK_INIT_SEC_RET_((timeS_t)0); /* MISRA 2012 Rule 15.5 deviation */
   
-  return (timeS_t)_chrono.TickTopValue / _chrono.SecToTickCoef;
+  return (timeS_t)TICK_TO_S_(DOMAIN_DEFAULT_, DOMAIN_DEFAULT_->TickTopValue);
 }
 
 /**
@@ -676,7 +1077,7 @@ timeMs_t fChrono_GetMaxMeasurableTimeMs(void) {
   
   CHECK_INIT_MS_RET_((timeMs_t)0); /* MISRA 2012 Rule 15.5 deviation */
   
-  return (timeMs_t)_chrono.TickTopValue / _chrono.MsToTickCoef;
+  return (timeMs_t)TICK_TO_MS_(DOMAIN_DEFAULT_, DOMAIN_DEFAULT_->TickTopValue);
 }
 
 /**
@@ -688,7 +1089,7 @@ timeUs_t fChrono_GetMaxMeasurableTimeUs(void) {
   
   CHECK_INIT_US_RET_((timeUs_t)0); /* MISRA 2012 Rule 15.5 deviation */
   
-  return (timeUs_t)_chrono.TickTopValue / _chrono.UsToTickCoef;
+  return (timeUs_t)TICK_TO_US_(DOMAIN_DEFAULT_, DOMAIN_DEFAULT_->TickTopValue);
 }
 
 /**
@@ -702,7 +1103,7 @@ timeS_t fChrono_TimeSpanS(tick_t startTick, tick_t endTick) {
   
   CHECK_INIT_SEC_RET_((timeS_t)0); /* MISRA 2012 Rule 15.5 deviation */
   
-  return (timeS_t)(ELAPSED_(endTick, startTick)) / _chrono.SecToTickCoef;
+  return (timeS_t)TICK_TO_S_(DOMAIN_DEFAULT_, ELAPSED_(DOMAIN_DEFAULT_, endTick, startTick));
 }
 
 /**
@@ -716,7 +1117,7 @@ timeMs_t fChrono_TimeSpanMs(tick_t startTick, tick_t endTick) {
   
   CHECK_INIT_MS_RET_((timeMs_t)0); /* MISRA 2012 Rule 15.5 deviation */
   
-  return (timeMs_t)(ELAPSED_(endTick, startTick)) / _chrono.MsToTickCoef;
+  return (timeMs_t)TICK_TO_MS_(DOMAIN_DEFAULT_, ELAPSED_(DOMAIN_DEFAULT_, endTick, startTick));
   
 }
 
@@ -731,7 +1132,7 @@ timeUs_t fChrono_TimeSpanUs(tick_t startTick, tick_t endTick) {
   
   CHECK_INIT_US_RET_((timeUs_t)0); /* MISRA 2012 Rule 15.5 deviation */
   
-  return (timeUs_t)(ELAPSED_(endTick, startTick)) / _chrono.UsToTickCoef;
+  return (timeUs_t)TICK_TO_US_(DOMAIN_DEFAULT_, ELAPSED_(DOMAIN_DEFAULT_, endTick, startTick));
   
 }
 
@@ -746,7 +1147,7 @@ tick_t fChrono_TimeSpanTick(tick_t startTick, tick_t endTick) {
   
   CHECK_INIT_RET_((tick_t)0); /* MISRA 2012 Rule 15.5 deviation */
   
-  return (tick_t)(ELAPSED_(endTick, startTick));
+  return (tick_t)(ELAPSED_(DOMAIN_DEFAULT_, endTick, startTick));
   
 }
 
@@ -822,13 +1223,7 @@ void fChrono_DelayUs(timeUs_t delayUs) {
  */
 tick_t fChrono_Start(sChrono * const me) {
 
-  CHECK_INIT_RET_((tick_t)0);        /* MISRA 2012 Rule 15.5 deviation */
-  ASSERT_NOT_NULL_RET_(me, (tick_t)0); /* MISRA 2012 Rule 15.5 deviation */
-  
-  me->_startTick = fChrono_GetTick();
-  me->_run = TRUE;
-
-  return me->_startTick;
+  return fStartIn(me, CHRONO_DOMAIN_DEFAULT);
 }
 
 /**
@@ -842,13 +1237,33 @@ tick_t fChrono_Stop(sChrono * const me) {
 
   ASSERT_NOT_NULL_RET_(me, (tick_t)0); /* MISRA 2012 Rule 15.5 deviation */
   
-  me->_stopTick = fChrono_GetTick();
+  sChronoDomain const * const domain = DOMAIN_(me);
+  
+  me->_stopTick = domain->Init ? fDomainGetTick(domain) : (tick_t)0;
   me->_run = FALSE;
   me->_isTimeout = FALSE;
 
   return me->_stopTick;
 }
 
+#if (CHRONO_DOMAIN_QTY > 1U)
+
+/**
+ * @brief Starts the chrono object for measuring time in a clock domain.
+ * 
+ * @note All the measurements and timeouts of the chrono object use the tick generator of this domain until it is started
+ *       again. fChrono_Start() and fChrono_StartTimeoutX() start the object in the default domain.
+ * 
+ * @param me Pointer to the chrono object
+ * @param domain Clock domain. Invalid domains select CHRONO_DOMAIN_DEFAULT.
+ */
+tick_t fChrono_StartIn(sChrono * const me, uint8_t domain) {
+
+  return fStartIn(me, domain);
+}
+
+#endif
+
 /**
  * @brief Returns the elapsed time in seconds since the start of the measurement using fChrono_Start().
  * 
@@ -859,14 +1274,16 @@ tick_t fChrono_Stop(sChrono * const me) {
  */
 timeS_t fChrono_ElapsedS(sChrono const * const me) {
   
-  CHECK_INIT_SEC_RET_((timeS_t)0);      /* MISRA 2012 Rule 15.5 deviation */
   ASSERT_NOT_NULL_RET_(me, (timeS_t)0); /* MISRA 2012 Rule 15.5 deviation */
-  CHECK_RUN_(fChrono_TimeSpanS(me->_startTick, me->_stopTick));               /* MISRA 2012 Rule 15.5 deviation */
+  
+  sChronoDomain const * const domain = DOMAIN_(me);
+  CHECK_DOMAIN_INIT_SEC_RET_(domain, (timeS_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  CHECK_RUN_((timeS_t)TICK_TO_S_(domain, ELAPSED_(domain, me->_stopTick, me->_startTick))); /* MISRA 2012 Rule 15.5 deviation */
   
   tick_t startTick = me->_startTick;
-  tick_t currentTick = fChrono_GetTick();
+  tick_t currentTick = fDomainGetTick(domain);
   
-  return (timeS_t)((timeS_t)(ELAPSED_(currentTick, startTick)) / _chrono.SecToTickCoef);
+  return (timeS_t)TICK_TO_S_(domain, ELAPSED_(domain, currentTick, startTick));
 }
 
 /**
@@ -879,14 +1296,16 @@ timeS_t fChrono_ElapsedS(sChrono const * const me) {
  */
 timeMs_t fChrono_ElapsedMs(sChrono const * const me) {
   
-  CHECK_INIT_MS_RET_((timeMs_t)0);        /* MISRA 2012 Rule 15.5 deviation */
-  ASSERT_NOT_NULL_RET_(me, (timeMs_t)0);  /* MISRA 2012 Rule 15.5 deviation */
-  CHECK_RUN_(fChrono_TimeSpanMs(me->_startTick, me->_stopTick));                /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RET_(me, (timeMs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  
+  sChronoDomain const * const domain = DOMAIN_(me);
+  CHECK_DOMAIN_INIT_MS_RET_(domain, (timeMs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  CHECK_RUN_((timeMs_t)TICK_TO_MS_(domain, ELAPSED_(domain, me->_stopTick, me->_startTick))); /* MISRA 2012 Rule 15.5 deviation */
   
   tick_t startTick = me->_startTick;
-  tick_t currentTick = fChrono_GetTick();
+  tick_t currentTick = fDomainGetTick(domain);
   
-  return (timeMs_t)((timeMs_t)(ELAPSED_(currentTick, startTick)) / _chrono.MsToTickCoef);
+  return (timeMs_t)TICK_TO_MS_(domain, ELAPSED_(domain, currentTick, startTick));
 }
 
 /**
@@ -899,14 +1318,16 @@ timeMs_t fChrono_ElapsedMs(sChrono const * const me) {
  */
 timeUs_t fChrono_ElapsedUs(sChrono const * const me) {
   
-  CHECK_INIT_US_RET_((timeUs_t)0);        /* MISRA 2012 Rule 15.5 deviation */
-  ASSERT_NOT_NULL_RET_(me, (timeUs_t)0);  /* MISRA 2012 Rule 15.5 deviation */
-  CHECK_RUN_(fChrono_TimeSpanUs(me->_startTick, me->_stopTick));                /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RET_(me, (timeUs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  
+  sChronoDomain const * const domain = DOMAIN_(me);
+  CHECK_DOMAIN_INIT_US_RET_(domain, (timeUs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  CHECK_RUN_((timeUs_t)TICK_TO_US_(domain, ELAPSED_(domain, me->_stopTick, me->_startTick))); /* MISRA 2012 Rule 15.5 deviation */
   
   tick_t startTick = me->_startTick;
-  tick_t currentTick = fChrono_GetTick();
+  tick_t currentTick = fDomainGetTick(domain);
   
-  return (timeUs_t)((timeUs_t)(ELAPSED_(currentTick, startTick)) / _chrono.UsToTickCoef);
+  return (timeUs_t)TICK_TO_US_(domain, ELAPSED_(domain, currentTick, startTick));
 }
 
 /**
@@ -922,8 +1343,10 @@ timeUs_t fChrono_ElapsedUs(sChrono const * const me) {
  */
 timeS_t fChrono_LeftS(sChrono * const me) {
   
-  CHECK_INIT_SEC_RET_((timeS_t)0);      /* MISRA 2012 Rule 15.5 deviation */
   ASSERT_NOT_NULL_RET_(me, (timeS_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  
+  sChronoDomain const * const domain = DOMAIN_(me);
+  CHECK_DOMAIN_INIT_SEC_RET_(domain, (timeS_t)0); /* MISRA 2012 Rule 15.5 deviation */
   CHECK_RUN_((timeS_t)0);               /* MISRA 2012 Rule 15.5 deviation */
   
   tick_t startTick = me->_startTick;
@@ -932,14 +1355,14 @@ timeS_t fChrono_LeftS(sChrono * const me) {
     return (timeS_t)0;
   }
   
-  tick_t currentTick = fChrono_GetTick();
-  tick_t elapsedTick = ELAPSED_(currentTick, startTick);
-  timeS_t elapsed = (timeS_t)((timeS_t)(elapsedTick) / _chrono.SecToTickCoef);
+  tick_t currentTick = fDomainGetTick(domain);
+  tick_t elapsedTick = ELAPSED_(domain, currentTick, startTick);
+  timeS_t elapsed = (timeS_t)TICK_TO_S_(domain, elapsedTick);
   if(elapsedTick >= (me->_timeout)) {
     me->_isTimeout = TRUE;
     return (timeS_t)0;
   } else {
-    return ((me->_timeout / _chrono.SecToTickCoef) - elapsed);
+    return ((timeS_t)TICK_TO_S_(domain, me->_timeout) - elapsed);
   }
 }
 
@@ -956,8 +1379,10 @@ timeS_t fChrono_LeftS(sChrono * const me) {
  */
 timeMs_t fChrono_LeftMs(sChrono * const me) {
   
-  CHECK_INIT_MS_RET_((timeMs_t)0);        /* MISRA 2012 Rule 15.5 deviation */
-  ASSERT_NOT_NULL_RET_(me, (timeMs_t)0);  /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RET_(me, (timeMs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  
+  sChronoDomain const * const domain = DOMAIN_(me);
+  CHECK_DOMAIN_INIT_MS_RET_(domain, (timeMs_t)0); /* MISRA 2012 Rule 15.5 deviation */
   CHECK_RUN_((timeMs_t)0);                /* MISRA 2012 Rule 15.5 deviation */
   
   tick_t startTick = me->_startTick;
@@ -966,14 +1391,14 @@ timeMs_t fChrono_LeftMs(sChrono * const me) {
     return (timeMs_t)0;
   }
   
-  tick_t currentTick = fChrono_GetTick();
-  tick_t elapsedTick = ELAPSED_(currentTick, startTick);
-  timeMs_t elapsed = (timeMs_t)((timeMs_t)(elapsedTick) / _chrono.MsToTickCoef);
+  tick_t currentTick = fDomainGetTick(domain);
+  tick_t elapsedTick = ELAPSED_(domain, currentTick, startTick);
+  timeMs_t elapsed = (timeMs_t)TICK_TO_MS_(domain, elapsedTick);
   if(elapsedTick >= (me->_timeout)) {
     me->_isTimeout = TRUE;
     return (timeMs_t)0;
   } else {
-    return ((me->_timeout / _chrono.MsToTickCoef) - elapsed);
+    return ((timeMs_t)TICK_TO_MS_(domain, me->_timeout) - elapsed);
   }
 }
 
@@ -990,8 +1415,10 @@ timeMs_t fChrono_LeftMs(sChrono * const me) {
  */
 timeUs_t fChrono_LeftUs(sChrono * const me) {
   
-  CHECK_INIT_US_RET_((timeUs_t)0);        /* MISRA 2012 Rule 15.5 deviation */
-  ASSERT_NOT_NULL_RET_(me, (timeUs_t)0);  /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RET_(me, (timeUs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  
+  sChronoDomain const * const domain = DOMAIN_(me);
+  CHECK_DOMAIN_INIT_US_RET_(domain, (timeUs_t)0); /* MISRA 2012 Rule 15.5 deviation */
   CHECK_RUN_((timeUs_t)0);                /* MISRA 2012 Rule 15.5 deviation */
   
   tick_t startTick = me->_startTick;
@@ -1000,14 +1427,14 @@ timeUs_t fChrono_LeftUs(sChrono * const me) {
     return (timeUs_t)0;
   }
   
-  tick_t currentTick = fChrono_GetTick();
-  tick_t elapsedTick = ELAPSED_(currentTick, startTick);
-  timeUs_t elapsed = (timeUs_t)((timeUs_t)(elapsedTick) / _chrono.UsToTickCoef);
+  tick_t currentTick = fDomainGetTick(domain);
+  tick_t elapsedTick = ELAPSED_(domain, currentTick, startTick);
+  timeUs_t elapsed = (timeUs_t)TICK_TO_US_(domain, elapsedTick);
   if(elapsedTick >= (me->_timeout)) {
     me->_isTimeout = TRUE;
     return (timeUs_t)0;
   } else {
-    return ((me->_timeout / _chrono.UsToTickCoef) - elapsed);
+    return ((timeUs_t)TICK_TO_US_(domain, me->_timeout) - elapsed);
   }
 }
 
@@ -1019,15 +1446,27 @@ timeUs_t fChrono_LeftUs(sChrono * const me) {
  */
 void fChrono_StartTimeoutS(sChrono * const me, timeS_t timeout) {
 
-  CHECK_INIT_SEC_();    /* MISRA 2012 Rule 15.5 deviation */
-  ASSERT_NOT_NULL_(me); /* MISRA 2012 Rule 15.5 deviation */
-  
-  me->_timeout = (tick_t)(timeout * (timeS_t)_chrono.SecToTickCoef);
-  me->_isTimeout = FALSE;
-  
-  fChrono_Start(me);
+  fStartTimeoutSIn(me, CHRONO_DOMAIN_DEFAULT, timeout);
+}
+
+#if (CHRONO_DOMAIN_QTY > 1U)
+
+/**
+ * @brief Starts the chrono object in timeout mode in a clock domain.
+ * 
+ * @note Refer to fChrono_StartIn() for more information.
+ * 
+ * @param me Pointer to the chrono object
+ * @param domain Clock domain. Invalid domains select CHRONO_DOMAIN_DEFAULT.
+ * @param timeout Time length until the chrono object times out (seconds)
+ */
+void fChrono_StartTimeoutSIn(sChrono * const me, uint8_t domain, timeS_t timeout) {
+
+  fStartTimeoutSIn(me, domain, timeout);
 }
 
+#endif
+
 /**
  * @brief Starts the chrono object in timeout mode.
  * 
@@ -1036,15 +1475,27 @@ void fChrono_StartTimeoutS(sChrono * const me, timeS_t timeout) {
  */
 void fChrono_StartTimeoutMs(sChrono * const me, timeMs_t timeout) {
 
-  CHECK_INIT_MS_();     /* MISRA 2012 Rule 15.5 deviation */
-  ASSERT_NOT_NULL_(me); /* MISRA 2012 Rule 15.5 deviation */
-  
-  me->_timeout = (tick_t)(timeout * (timeMs_t)_chrono.MsToTickCoef);
-  me->_isTimeout = FALSE;
-  
-  fChrono_Start(me);
+  fStartTimeoutMsIn(me, CHRONO_DOMAIN_DEFAULT, timeout);
+}
+
+#if (CHRONO_DOMAIN_QTY > 1U)
+
+/**
+ * @brief Starts the chrono object in timeout mode in a clock domain.
+ * 
+ * @note Refer to fChrono_StartIn() for more information.
+ * 
+ * @param me Pointer to the chrono object
+ * @param domain Clock domain. Invalid domains select CHRONO_DOMAIN_DEFAULT.
+ * @param timeout Time length until the chrono object times out (milliseconds)
+ */
+void fChrono_StartTimeoutMsIn(sChrono * const me, uint8_t domain, timeMs_t timeout) {
+
+  fStartTimeoutMsIn(me, domain, timeout);
 }
 
+#endif
+
 /**
  * @brief Starts the chrono object in timeout mode.
  * 
@@ -1053,13 +1504,97 @@ void fChrono_StartTimeoutMs(sChrono * const me, timeMs_t timeout) {
  */
 void fChrono_StartTimeoutUs(sChrono * const me, timeUs_t timeout) {
 
-  CHECK_INIT_US_();     /* MISRA 2012 Rule 15.5 deviation */
+  fStartTimeoutUsIn(me, CHRONO_DOMAIN_DEFAULT, timeout);
+}
+
+#if (CHRONO_DOMAIN_QTY > 1U)
+
+/**
+ * @brief Starts the chrono object in timeout mode in a clock domain.
+ * 
+ * @note Refer to fChrono_StartIn() for more information.
+ * 
+ * @param me Pointer to the chrono object
+ * @param domain Clock domain. Invalid domains select CHRONO_DOMAIN_DEFAULT.
+ * @param timeout Time length until the chrono object times out (microseconds)
+ */
+void fChrono_StartTimeoutUsIn(sChrono * const me, uint8_t domain, timeUs_t timeout) {
+
+  fStartTimeoutUsIn(me, domain, timeout);
+}
+
+#endif
+
+/**
+ * @brief Restarts the timeout of the chrono object from its last deadline.
+ * 
+ * @note Unlike fChrono_StartTimeoutS(), the next timeout is measured from the moment the chrono timed out, not from the
+ *       time of this call. Calling it right after fChrono_IsTimeout() returns TRUE gives a periodic timeout whose
+ *       lateness doesn't accumulate. If the chrono is behind by more than one timeout, the missed timeouts are skipped.
+ *       A running chrono keeps its clock domain, and a stopped one is started in the default domain like fChrono_StartTimeoutS().
+ * 
+ * @param me Pointer to the chrono object
+ * @param timeout Time length until the chrono object times out again (seconds)
+ */
+void fChrono_RestartTimeoutS(sChrono * const me, timeS_t timeout) {
+
   ASSERT_NOT_NULL_(me); /* MISRA 2012 Rule 15.5 deviation */
   
-  me->_timeout = (tick_t)(timeout * (timeUs_t)_chrono.UsToTickCoef);
-  me->_isTimeout = FALSE;
+  if(!me->_run) {
+    fStartTimeoutSIn(me, CHRONO_DOMAIN_DEFAULT, timeout);
+    return; /* MISRA 2012 Rule 15.5 deviation */
+  }
+  
+  sChronoDomain const * const domain = DOMAIN_(me);
+  CHECK_DOMAIN_INIT_SEC_(domain); /* MISRA 2012 Rule 15.5 deviation */
+  
+  fRestartTimeout(me, (tick_t)(timeout * (timeS_t)domain->SecToTickCoef));
+}
+
+/**
+ * @brief Restarts the timeout of the chrono object from its last deadline.
+ * 
+ * @note Refer to fChrono_RestartTimeoutS() for more information.
+ * 
+ * @param me Pointer to the chrono object
+ * @param timeout Time length until the chrono object times out again (milliseconds)
+ */
+void fChrono_RestartTimeoutMs(sChrono * const me, timeMs_t timeout) {
+
+  ASSERT_NOT_NULL_(me); /* MISRA 2012 Rule 15.5 deviation */
+  
+  if(!me->_run) {
+    fStartTimeoutMsIn(me, CHRONO_DOMAIN_DEFAULT, timeout);
+    return; /* MISRA 2012 Rule 15.5 deviation */
+  }
+  
+  sChronoDomain const * const domain = DOMAIN_(me);
+  CHECK_DOMAIN_INIT_MS_(domain); /* MISRA 2012 Rule 15.5 deviation */
+  
+  fRestartTimeout(me, (tick_t)(timeout * (timeMs_t)domain->MsToTickCoef));
+}
+
+/**
+ * @brief Restarts the timeout of the chrono object from its last deadline.
+ * 
+ * @note Refer to fChrono_RestartTimeoutS() for more information.
+ * 
+ * @param me Pointer to the chrono object
+ * @param timeout Time length until the chrono object times out again (microseconds)
+ */
+void fChrono_RestartTimeoutUs(sChrono * const me, timeUs_t timeout) {
+
+  ASSERT_NOT_NULL_(me); /* MISRA 2012 Rule 15.5 deviation */
+  
+  if(!me->_run) {
+    fStartTimeoutUsIn(me, CHRONO_DOMAIN_DEFAULT, timeout);
+    return; /* MISRA 2012 Rule 15.5 deviation */
+  }
   
-  fChrono_Start(me);
+  sChronoDomain const * const domain = DOMAIN_(me);
+  CHECK_DOMAIN_INIT_US_(domain); /* MISRA 2012 Rule 15.5 deviation */
+  
+  fRestartTimeout(me, (tick_t)(timeout * (timeUs_t)domain->UsToTickCoef));
 }
 
 /**
@@ -1072,8 +1607,10 @@ void fChrono_StartTimeoutUs(sChrono * const me, timeUs_t timeout) {
  */
 bool_t fChrono_IsTimeout(sChrono * const me) {
   
-  CHECK_INIT_RET_(FALSE);           /* MISRA 2012 Rule 15.5 deviation */
-  ASSERT_NOT_NULL_RET_(me, FALSE);  /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RET_(me, FALSE); /* MISRA 2012 Rule 15.5 deviation */
+  
+  sChronoDomain const * const domain = DOMAIN_(me);
+  CHECK_DOMAIN_INIT_RET_(domain, FALSE); /* MISRA 2012 Rule 15.5 deviation */
   CHECK_RUN_(FALSE);                /* MISRA 2012 Rule 15.5 deviation */
   
   tick_t startTick = me->_startTick;
@@ -1082,8 +1619,8 @@ bool_t fChrono_IsTimeout(sChrono * const me) {
     return TRUE;
   }
   
-  tick_t currentTick = fChrono_GetTick();
-  if(ELAPSED_(currentTick, startTick) >= me->_timeout) {
+  tick_t currentTick = fDomainGetTick(domain);
+  if(ELAPSED_(domain, currentTick, startTick) >= me->_timeout) {
     me->_isTimeout = TRUE;
   } else {
     return FALSE;
@@ -1108,15 +1645,17 @@ bool_t fChrono_IsTimeout(sChrono * const me) {
  */
 timeS_t fChrono_IntervalS(sChrono * const me) {
   
-  CHECK_INIT_SEC_RET_((timeS_t)0);      /* MISRA 2012 Rule 15.5 deviation */
   ASSERT_NOT_NULL_RET_(me, (timeS_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  
+  sChronoDomain const * const domain = DOMAIN_(me);
+  CHECK_DOMAIN_INIT_SEC_RET_(domain, (timeS_t)0); /* MISRA 2012 Rule 15.5 deviation */
   CHECK_RUN_((timeS_t)0);               /* MISRA 2012 Rule 15.5 deviation */
   
-  tick_t currentTick = fChrono_GetTick();
+  tick_t currentTick = fDomainGetTick(domain);
   tick_t startTick = me->_startTick;
   me->_startTick = currentTick;
   
-  return ((timeS_t)(ELAPSED_(currentTick, startTick)) / _chrono.SecToTickCoef);
+  return (timeS_t)TICK_TO_S_(domain, ELAPSED_(domain, currentTick, startTick));
 }
 
 /**
@@ -1135,15 +1674,17 @@ timeS_t fChrono_IntervalS(sChrono * const me) {
  */
 timeMs_t fChrono_IntervalMs(sChrono * const me) {
   
-  CHECK_INIT_MS_RET_((timeMs_t)0);        /* MISRA 2012 Rule 15.5 deviation */
-  ASSERT_NOT_NULL_RET_(me, (timeMs_t)0);  /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RET_(me, (timeMs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  
+  sChronoDomain const * const domain = DOMAIN_(me);
+  CHECK_DOMAIN_INIT_MS_RET_(domain, (timeMs_t)0); /* MISRA 2012 Rule 15.5 deviation */
   CHECK_RUN_((timeMs_t)0);                /* MISRA 2012 Rule 15.5 deviation */
   
-  tick_t currentTick = fChrono_GetTick();
+  tick_t currentTick = fDomainGetTick(domain);
   tick_t startTick = me->_startTick;
   me->_startTick = currentTick;
   
-  return ((timeMs_t)(ELAPSED_(currentTick, startTick)) / _chrono.MsToTickCoef);
+  return (timeMs_t)TICK_TO_MS_(domain, ELAPSED_(domain, currentTick, startTick));
 }
 
 /**
@@ -1162,15 +1703,17 @@ timeMs_t fChrono_IntervalMs(sChrono * const me) {
  */
 timeUs_t fChrono_IntervalUs(sChrono * const me) {
   
-  CHECK_INIT_US_RET_((timeUs_t)0);        /* MISRA 2012 Rule 15.5 deviation */
-  ASSERT_NOT_NULL_RET_(me, (timeUs_t)0);  /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RET_(me, (timeUs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  
+  sChronoDomain const * const domain = DOMAIN_(me);
+  CHECK_DOMAIN_INIT_US_RET_(domain, (timeUs_t)0); /* MISRA 2012 Rule 15.5 deviation */
   CHECK_RUN_((timeUs_t)0);                /* MISRA 2012 Rule 15.5 deviation */
   
-  tick_t currentTick = fChrono_GetTick();
+  tick_t currentTick = fDomainGetTick(domain);
   tick_t startTick = me->_startTick;
   me->_startTick = currentTick;
   
-  return ((timeUs_t)(ELAPSED_(currentTick, startTick)) / _chrono.UsToTickCoef);
+  return (timeUs_t)TICK_TO_US_(domain, ELAPSED_(domain, currentTick, startTick));
 }
 
 /** @} */ //End of OBJECTIVE_API
@@ -1181,5 +1724,333 @@ timeUs_t fChrono_IntervalUs(sChrono * const me) {
 ╚══════════════════════════════════════════════════════════════════════════════════╝
 */
 
+/**
+ * @brief Precomputes the fixed-point reciprocal of a divisor.
+ * 
+ * @note The multiplier is ceil(2^(32 + l) / divisor) - 2^32 with l = ceil(log2(divisor)), which is exact
+ *       for every 32-bit dividend (Granlund-Montgomery). The 64-bit division only runs here.
+ * 
+ * @param me Pointer to the reciprocal object
+ * @param divisor Divisor. Zero leaves a reciprocal that is never used, since the corresponding unit is not initialized.
+ */
+static void fReciprocalInit(sChronoReciprocal * const me, uint32_t divisor) {
+  
+  uint8_t log2Ceil = 0U;
+  
+  me->Magic = 0U;
+  me->Shift = 0U;
+  me->IsPowerOfTwo = TRUE;
+  
+  if(divisor == 0U) {
+    return; /* MISRA 2012 Rule 15.5 deviation */
+  }
+  
+  while((log2Ceil < 32U) && (((uint64_t)1U << log2Ceil) < (uint64_t)divisor)) {
+    log2Ceil++;
+  }
+  
+  if((divisor & (divisor - 1U)) == 0U) {
+    me->Shift = log2Ceil;
+    return; /* MISRA 2012 Rule 15.5 deviation */
+  }
+  
+  me->Magic = (uint32_t)(((((uint64_t)1U << log2Ceil) - (uint64_t)divisor) << 32U) / (uint64_t)divisor) + 1U;
+  me->Shift = (uint8_t)(log2Ceil - 1U);
+  me->IsPowerOfTwo = FALSE;
+}
+
+/**
+ * @brief Divides a number of ticks by a conversion coefficient using its precomputed reciprocal.
+ * 
+ * @note The result is bit-exact with (tick / divisor). If tick_t is wider than 32 bits, a plain division is used.
+ * 
+ * @param reciprocal Pointer to the reciprocal of the divisor
+ * @param divisor Divisor
+ * @param tick Number of ticks
+ * @retval quotient: tick / divisor
+ */
+static tick_t fTickDivide(sChronoReciprocal const * const reciprocal, uint32_t divisor, tick_t tick) {
+  
+  if(sizeof(tick_t) > sizeof(uint32_t)) {
+    return tick / (tick_t)divisor; /* MISRA 2012 Rule 15.5 deviation */
+  }
+  
+  uint32_t n = (uint32_t)tick;
+  
+  if(reciprocal->IsPowerOfTwo) {
+    return (tick_t)(n >> reciprocal->Shift); /* MISRA 2012 Rule 15.5 deviation */
+  }
+  
+  uint32_t t = (uint32_t)(((uint64_t)reciprocal->Magic * (uint64_t)n) >> 32U);
+  
+  return (tick_t)((t + ((n - t) >> 1U)) >> reciprocal->Shift);
+}
+
+#if (CHRONO_TICK_EXTENSION == TICK_EXTENSION_ENABLED)
+
+/**
+ * @brief Combines an overflow epoch and a tick into a 64-bit tick.
+ * 
+ * @note Down-counting ticks are mirrored so that the result always increases with time.
+ * 
+ * @param epoch Number of tick generator overflows
+ * @param tick Tick value in this epoch
+ * @retval tick64: epoch * CHRONO_TICK_TOP_VALUE + ticks counted in this epoch
+ */
+static uint64_t fTickExtend(uint32_t epoch, tick_t tick) {
+  
+#if(CHRONO_TICK_COUNTERMODE == TICK_COUNTERMODE_UP)
+  return ((uint64_t)epoch * (uint64_t)DOMAIN_DEFAULT_->TickTopValue) + (uint64_t)tick;
+#else
+  return ((uint64_t)epoch * (uint64_t)DOMAIN_DEFAULT_->TickTopValue) + (uint64_t)(DOMAIN_DEFAULT_->TickTopValue - tick);
+#endif
+}
+
+#endif
+
+/**
+ * @brief Starts the chrono object in a clock domain.
+ * 
+ * @note Every start writes the domain of the object, so an object is never measured in a domain it was not started in.
+ * 
+ * @param me Pointer to the chrono object
+ * @param domainIndex Clock domain. Invalid domains select CHRONO_DOMAIN_DEFAULT.
+ * @retval startTick: Start tick of the chrono object
+ */
+static tick_t fStartIn(sChrono * const me, uint8_t domainIndex) {
+
+  ASSERT_NOT_NULL_RET_(me, (tick_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  
+#if (CHRONO_DOMAIN_QTY > 1U)
+  me->_domain = (domainIndex < CHRONO_DOMAIN_QTY) ? domainIndex : CHRONO_DOMAIN_DEFAULT;
+#else
+  (void)domainIndex;
+#endif
+  
+  sChronoDomain const * const domain = DOMAIN_(me);
+  CHECK_DOMAIN_INIT_RET_(domain, (tick_t)0); /* MISRA 2012 Rule 15.5 deviation */
+  
+  me->_startTick = fDomainGetTick(domain);
+  me->_run = TRUE;
+
+  return me->_startTick;
+}
+
+/**
+ * @brief Starts the chrono object in timeout mode in a clock domain.
+ * 
+ * @param me Pointer to the chrono object
+ * @param domainIndex Clock domain. Invalid domains select CHRONO_DOMAIN_DEFAULT.
+ * @param timeout Time length until the chrono object times out (seconds)
+ */
+static void fStartTimeoutSIn(sChrono * const me, uint8_t domainIndex, timeS_t timeout) {
+
+  ASSERT_NOT_NULL_(me); /* MISRA 2012 Rule 15.5 deviation */
+  
+#if (CHRONO_DOMAIN_QTY > 1U)
+  me->_domain = (domainIndex < CHRONO_DOMAIN_QTY) ? domainIndex : CHRONO_DOMAIN_DEFAULT;
+#else
+  (void)domainIndex;
+#endif
+  
+  sChronoDomain const * const domain = DOMAIN_(me);
+  CHECK_DOMAIN_INIT_SEC_(domain); /* MISRA 2012 Rule 15.5 deviation */
+  
+  me->_timeout = (tick_t)(timeout * (timeS_t)domain->SecToTickCoef);
+  me->_isTimeout = FALSE;
+  
+  me->_startTick = fDomainGetTick(domain);
+  me->_run = TRUE;
+}
+
+/**
+ * @brief Starts the chrono object in timeout mode in a clock domain.
+ * 
+ * @param me Pointer to the chrono object
+ * @param domainIndex Clock domain. Invalid domains select CHRONO_DOMAIN_DEFAULT.
+ * @param timeout Time length until the chrono object times out (milliseconds)
+ */
+static void fStartTimeoutMsIn(sChrono * const me, uint8_t domainIndex, timeMs_t timeout) {
+
+  ASSERT_NOT_NULL_(me); /* MISRA 2012 Rule 15.5 deviation */
+  
+#if (CHRONO_DOMAIN_QTY > 1U)
+  me->_domain = (domainIndex < CHRONO_DOMAIN_QTY) ? domainIndex : CHRONO_DOMAIN_DEFAULT;
+#else
+  (void)domainIndex;
+#endif
+  
+  sChronoDomain const * const domain = DOMAIN_(me);
+  CHECK_DOMAIN_INIT_MS_(domain); /* MISRA 2012 Rule 15.5 deviation */
+  
+  me->_timeout = (tick_t)(timeout * (timeMs_t)domain->MsToTickCoef);
+  me->_isTimeout = FALSE;
+  
+  me->_startTick = fDomainGetTick(domain);
+  me->_run = TRUE;
+}
+
+/**
+ * @brief Starts the chrono object in timeout mode in a clock domain.
+ * 
+ * @param me Pointer to the chrono object
+ * @param domainIndex Clock domain. Invalid domains select CHRONO_DOMAIN_DEFAULT.
+ * @param timeout Time length until the chrono object times out (microseconds)
+ */
+static void fStartTimeoutUsIn(sChrono * const me, uint8_t domainIndex, timeUs_t timeout) {
+
+  ASSERT_NOT_NULL_(me); /* MISRA 2012 Rule 15.5 deviation */
+  
+#if (CHRONO_DOMAIN_QTY > 1U)
+  me->_domain = (domainIndex < CHRONO_DOMAIN_QTY) ? domainIndex : CHRONO_DOMAIN_DEFAULT;
+#else
+  (void)domainIndex;
+#endif
+  
+  sChronoDomain const * const domain = DOMAIN_(me);
+  CHECK_DOMAIN_INIT_US_(domain); /* MISRA 2012 Rule 15.5 deviation */
+  
+  me->_timeout = (tick_t)(timeout * (timeUs_t)domain->UsToTickCoef);
+  me->_isTimeout = FALSE;
+  
+  me->_startTick = fDomainGetTick(domain);
+  me->_run = TRUE;
+}
+
+/**
+ * @brief Moves the start of the chrono object to its last deadline and sets the new timeout.
+ * 
+ * @note If the chrono is not running or has not timed out yet, it is started from the current tick.
+ * 
+ * @param me Pointer to the chrono object
+ * @param timeout New timeout length (ticks)
+ */
+static void fRestartTimeout(sChrono * const me, tick_t timeout) {
+
+  sChronoDomain const * const domain = DOMAIN_(me);
+  tick_t currentTick = fDomainGetTick(domain);
+  tick_t elapsedTick = ELAPSED_(domain, currentTick, me->_startTick);
+
+  if(!me->_run || (elapsedTick < me->_timeout)) {
+    me->_timeout = timeout;
+    me->_isTimeout = FALSE;
+    me->_startTick = currentTick;
+    me->_run = TRUE;
+    return; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  tick_t advanceTick = me->_timeout;
+  tick_t lateTick = elapsedTick - me->_timeout;
+
+  if((timeout != 0U) && (lateTick >= timeout)) {
+    advanceTick += (lateTick / timeout) * timeout;
+  }
+
+  me->_startTick = ADVANCE_(domain, me->_startTick, advanceTick);
+  me->_timeout = timeout;
+  me->_isTimeout = FALSE;
+}
+
+/**
+ * @brief Returns the current tick of a clock domain.
+ * 
+ * @note The domain must be initialized.
+ * 
+ * @param domain Pointer to the clock domain
+ * @retval tick: Current tick (raw)
+ */
+static tick_t fDomainGetTick(sChronoDomain const * const domain) {
+  
+#if (CHRONO_TICK_TYPE == TICK_TYPE_VARIABLE)
+  return *domain->pTickValue;
+#else
+  return domain->GetTickValue();
+#endif
+}
+
+/**
+ * @brief Marks a clock domain as not initialized.
+ * 
+ * @param me Pointer to the clock domain
+ */
+static void fDomainClear(sChronoDomain * const me) {
+  
+  me->Init = FALSE;
+  me->InitUs = FALSE;
+  me->InitMs = FALSE;
+  me->InitSec = FALSE;
+}
+
+/**
+ * @brief Sets the top value, the counter mode and the conversion coefficients of a clock domain and marks it as initialized.
+ * 
+ * @note A time unit is only available if one unit takes at least one tick, i.e. its coefficient is not zero.
+ * 
+ * @param me Pointer to the clock domain
+ * @param tickTopValue Top value of the tick generator
+ * @param tickToNsCoef Time length of one tick (nanoseconds)
+ * @param usToTickCoef Number of ticks in one microsecond
+ * @param msToTickCoef Number of ticks in one millisecond
+ * @param secToTickCoef Number of ticks in one second
+ * @param counterMode TICK_COUNTERMODE_UP or TICK_COUNTERMODE_DOWN
+ */
+static void fDomainSetup(sChronoDomain * const me, tick_t tickTopValue, uint32_t tickToNsCoef, uint32_t usToTickCoef, uint32_t msToTickCoef, uint32_t secToTickCoef, uint8_t counterMode) {
+  
+  me->TickTopValue = tickTopValue;
+  me->CounterMode = counterMode;
+  me->TickToNsCoef = tickToNsCoef;
+  me->UsToTickCoef = usToTickCoef;
+  me->MsToTickCoef = msToTickCoef;
+  me->SecToTickCoef = secToTickCoef;
+  
+  fReciprocalInit(&me->UsReciprocal, usToTickCoef);
+  fReciprocalInit(&me->MsReciprocal, msToTickCoef);
+  fReciprocalInit(&me->SecReciprocal, secToTickCoef);
+  
+  me->Init = TRUE;
+  me->InitUs = (usToTickCoef != 0U);
+  me->InitMs = (msToTickCoef != 0U);
+  me->InitSec = (secToTickCoef != 0U);
+}
+
+#if (CHRONO_DOMAIN_QTY > 1U)
+
+/**
+ * @brief Validates the parameters of fChrono_DomainInit() and clears the domain.
+ * 
+ * @param domain Clock domain
+ * @param tickTopValue Top value of the tick generator
+ * @param tickFrequencyHz Frequency of the tick generator (Hz)
+ * @param counterMode Counter mode of the tick generator
+ * @retval status: CHRONO_OK if the domain can be initialized, otherwise one of the CHRONO_ERROR_ values
+ */
+static uint8_t fDomainCheck(uint8_t domain, tick_t tickTopValue, uint32_t tickFrequencyHz, uint8_t counterMode) {
+  
+  if(!DOMAIN_DEFAULT_->Init) {
+    return CHRONO_ERROR_NOT_INIT; /* MISRA 2012 Rule 15.5 deviation */
+  }
+  
+  if((domain == CHRONO_DOMAIN_DEFAULT) || (domain >= CHRONO_DOMAIN_QTY)) {
+    return CHRONO_ERROR_DOMAIN_INVALID; /* MISRA 2012 Rule 15.5 deviation */
+  }
+  
+  if((counterMode != TICK_COUNTERMODE_UP) && (counterMode != TICK_COUNTERMODE_DOWN)) {
+    return CHRONO_ERROR_DOMAIN_INVALID; /* MISRA 2012 Rule 15.5 deviation */
+  }
+  
+  fDomainClear(&_chrono.Domains[domain]);
+  
+  if(tickTopValue == 0U) {
+    return CHRONO_ERROR_TICK_TOP_ZERO; /* MISRA 2012 Rule 15.5 deviation */
+  }
+  
+  if(tickFrequencyHz == 0U) {
+    return CHRONO_ERROR_TICK_FREQ_ZERO; /* MISRA 2012 Rule 15.5 deviation */
+  }
+  
+  return CHRONO_OK;
+}
+
+#endif
 
 /************************ Copyright (c) 2024 FaraabinCo *****END OF FILE****/
@@ -44,6 +44,31 @@ extern "C" {
 #define CHRONO_ERROR_TICK_TOP_ZERO    (1U)
 #define CHRONO_ERROR_TICK_TO_NS_ZERO  (2U)
 #define CHRONO_ERROR_TICK_PTR_ERROR   (3U)
+#define CHRONO_ERROR_DOMAIN_INVALID   (4U)
+#define CHRONO_ERROR_TICK_FREQ_ZERO   (5U)
+#define CHRONO_ERROR_NOT_INIT         (6U)
+
+/**
+ * @brief The tick extension is disabled unless it is selected in chrono_config.h.
+ * 
+ */
+#ifndef CHRONO_TICK_EXTENSION
+#define CHRONO_TICK_EXTENSION TICK_EXTENSION_DISABLED
+#endif
+
+/**
+ * @brief Number of clock domains. Only the default domain of fChrono_Init() exists unless more are selected in chrono_config.h.
+ * 
+ */
+#ifndef CHRONO_DOMAIN_QTY
+#define CHRONO_DOMAIN_QTY (1U)
+#endif
+
+/**
+ * @brief Clock domain of the tick generator that is given to fChrono_Init().
+ * 
+ */
+#define CHRONO_DOMAIN_DEFAULT (0U)
 
 /* Exported macro ------------------------------------------------------------*/
 /** @defgroup TIME_MACROS Time macros
@@ -100,7 +125,7 @@ extern "C" {
  * 
  */
 #define tic_(name_) \
-  sChrono __tic_toc_##name_##__;\
+  sChrono __tic_toc_##name_##__ = {0};\
   fChrono_Start(&(__tic_toc_##name_##__))
   
 #define tocUs_(name_) fChrono_ElapsedUs(&(__tic_toc_##name_##__))
@@ -144,6 +169,11 @@ typedef struct {
   
   bool_t _isTimeout;  /*!< Holds the timeout state of the chrono object.
                            This parameter is private and is set by the chrono API. Users must not change its value. */
+
+#if (CHRONO_DOMAIN_QTY > 1U)
+  uint8_t _domain;    /*!< Holds the clock domain that the chrono object measures time with. Zero is the default domain.
+                           This parameter is private and is set when the object is started. Users must not change its value. */
+#endif
 }sChrono;
 
 /* Exported constants --------------------------------------------------------*/
@@ -176,6 +206,27 @@ typedef struct {
 
   #error "CHRONO_TICK_TYPE must be defined"
 
+#endif
+
+#if (CHRONO_DOMAIN_QTY > 1U)
+
+/**
+ * @brief Initializes an additional clock domain with its own tick generator.
+ * 
+ * @param domain Clock domain, from 1 to CHRONO_DOMAIN_QTY - 1
+ * @param tickValue If module is configured with TICK_TYPE_VARIABLE, pointer to the memory location that contains the tick value,
+ *                  otherwise pointer to the function that returns tick value.
+ * @param tickTopValue Top value of the tick generator
+ * @param tickFrequencyHz Frequency of the tick generator (Hz)
+ * @param counterMode TICK_COUNTERMODE_UP or TICK_COUNTERMODE_DOWN
+ * @retval initStatus: CHRONO_OK if successful, otherwise one of the CHRONO_ERROR_ values
+ */
+#if (CHRONO_TICK_TYPE == TICK_TYPE_VARIABLE)
+  uint8_t fChrono_DomainInit(uint8_t domain, volatile tick_t *tickValue, tick_t tickTopValue, uint32_t tickFrequencyHz, uint8_t counterMode);
+#elif (CHRONO_TICK_TYPE == TICK_TYPE_FUNCTION)
+  uint8_t fChrono_DomainInit(uint8_t domain, tick_t(*fpTickValue)(void), tick_t tickTopValue, uint32_t tickFrequencyHz, uint8_t counterMode);
+#endif
+
 #endif
 /** @} */ //End of INIT_FUNCTION
 
@@ -210,14 +261,74 @@ tick_t fChrono_GetTick(void);
 
 /**
  * @brief Returns the amount of time converted to microseconds, milliseconds & seconds since calling fChrono_Init().
- * @note This functions are not re-entrant. if this condition may be happen, user should use critical section
- *       for prevent it.
+ * @note This functions are not re-entrant, unless CHRONO_TICK_EXTENSION is enabled. if this condition may be happen,
+ *       user should use critical section for prevent it.
  * @retval timeLength: Time length since calling fChrono_Init() in microseconds, milliseconds & seconds
  */
 uint64_t fChrono_GetContinuousTickUs(void);
 uint64_t fChrono_GetContinuousTickMs(void);
 uint64_t fChrono_GetContinuousTickS(void);
 
+#if (CHRONO_TICK_EXTENSION == TICK_EXTENSION_ENABLED)
+
+/** @defgroup TICK_EXTENSION
+ *  @ingroup FUNCTIONAL_API
+ *  @brief These functions extend the tick generator to a 64-bit monotonic tick.
+ *  @{
+ */
+
+/**
+ * @brief Counts one overflow of the tick generator. Must be called from its overflow interrupt.
+ * 
+ */
+void fChrono_TickOverflowHandler(void);
+
+/**
+ * @brief Sets the function that reports a pending overflow interrupt of the tick generator.
+ * 
+ * @param fpIsTickOverflowPending Pointer to the function that returns TRUE if the overflow interrupt is pending, or NULL.
+ */
+void fChrono_SetTickOverflowPendingCallback(bool_t(*fpIsTickOverflowPending)(void));
+
+/**
+ * @brief Returns the number of ticks since calling fChrono_Init() as a 64-bit monotonic value.
+ * 
+ * @retval tick64: Ticks since calling fChrono_Init()
+ */
+uint64_t fChrono_GetTick64(void);
+
+/** @} */ //End of TICK_EXTENSION
+
+#endif
+
+#if (CHRONO_DOMAIN_QTY > 1U)
+
+/** @defgroup CLOCK_DOMAIN
+ *  @ingroup FUNCTIONAL_API
+ *  @brief These functions return information of a clock domain.
+ *  @{
+ */
+
+/**
+ * @brief Get current tick of a clock domain.
+ * 
+ * @param domain Clock domain
+ * @retval tick: Current tick of the domain (raw)
+ */
+tick_t fChrono_GetDomainTick(uint8_t domain);
+
+/**
+ * @brief Get tick top value of a clock domain.
+ * 
+ * @param domain Clock domain
+ * @retval topValue: Tick top value of the domain
+ */
+tick_t fChrono_GetDomainTickTopValue(uint8_t domain);
+
+/** @} */ //End of CLOCK_DOMAIN
+
+#endif
+
 /**
  * @brief Get Tick top value.
  * 
@@ -315,6 +426,9 @@ void fChrono_DelayUs(timeUs_t delayUs);
 
 tick_t fChrono_Start(sChrono * const me);
 tick_t fChrono_Stop(sChrono * const me);
+#if (CHRONO_DOMAIN_QTY > 1U)
+tick_t fChrono_StartIn(sChrono * const me, uint8_t domain);
+#endif
 
 /** @} */ //End of DELAY
 
@@ -350,6 +464,14 @@ timeUs_t fChrono_LeftUs(sChrono * const me);
 void fChrono_StartTimeoutS(sChrono * const me, timeS_t timeout);
 void fChrono_StartTimeoutMs(sChrono * const me, timeMs_t timeout);
 void fChrono_StartTimeoutUs(sChrono * const me, timeUs_t timeout);
+#if (CHRONO_DOMAIN_QTY > 1U)
+void fChrono_StartTimeoutSIn(sChrono * const me, uint8_t domain, timeS_t timeout);
+void fChrono_StartTimeoutMsIn(sChrono * const me, uint8_t domain, timeMs_t timeout);
+void fChrono_StartTimeoutUsIn(sChrono * const me, uint8_t domain, timeUs_t timeout);
+#endif
+void fChrono_RestartTimeoutS(sChrono * const me, timeS_t timeout);
+void fChrono_RestartTimeoutMs(sChrono * const me, timeMs_t timeout);
+void fChrono_RestartTimeoutUs(sChrono * const me, timeUs_t timeout);
 bool_t fChrono_IsTimeout(sChrono * const me);
 
 /** @} */ //End of TIMEOUT
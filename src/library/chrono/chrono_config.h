@@ -46,7 +46,7 @@ extern "C" {
  * @note For example, if you have a timer that counts upto 0xFFFFFFFFU, CHRONO_TICK_TOP_VALUE should be this value.
  * 
  */
-#define CHRONO_TICK_TOP_VALUE   (0x00FFFFFFU)
+#define CHRONO_TICK_TOP_VALUE   (0xFFFFFFFFU)
 
 /**
  * @brief Set the coefficient for converting one tick of the tick generator to nanoseconds.
@@ -61,7 +61,38 @@ extern "C" {
   *        and TICK_COUNTERMODE_DOWN if it counts downward from CHRONO_TICK_TOP_VALUE to zero.
   *
   */
-#define CHRONO_TICK_COUNTERMODE TICK_COUNTERMODE_DOWN
+#define CHRONO_TICK_COUNTERMODE TICK_COUNTERMODE_UP
+
+/**
+  * @brief Select TICK_EXTENSION_ENABLED to extend the tick generator to a 64-bit monotonic tick, or TICK_EXTENSION_DISABLED otherwise.
+  *
+  * @note When enabled, the overflow interrupt of the tick generator must call fChrono_TickOverflowHandler().
+  *       fChrono_GetContinuousTickUs/Ms/S() are then derived from fChrono_GetTick64() and don't need to be called once per overflow.
+  *
+  */
+#define CHRONO_TICK_EXTENSION TICK_EXTENSION_ENABLED
+
+/**
+  * @brief Select INLINE_ENABLED to provide the static inline fast path of chrono_inline.h, or INLINE_DISABLED otherwise.
+  *
+  * @note The inline functions read the tick with CHRONO_INLINE_TICK_() instead of the tick pointer or function that is
+  *       given to fChrono_Init(), and convert ticks to time with the constants of this file. Both must refer to the same
+  *       tick generator. For example, #define CHRONO_INLINE_TICK_() (SysTick->VAL) reads the SysTick counter directly.
+  *
+  * @note Select INLINE_ASSERT_DISABLED for CHRONO_INLINE_ASSERT in release builds to remove the null pointer checks of
+  *       the inline functions.
+  *
+  */
+#define CHRONO_INLINE INLINE_DISABLED
+
+/**
+  * @brief Set the number of clock domains, i.e. tick generators that chrono objects can be started in with fChrono_StartIn().
+  *
+  * @note The tick generator above is CHRONO_DOMAIN_DEFAULT. The others are initialized with fChrono_DomainInit().
+  *       On this board, the second domain is the DWT cycle counter of the core, which is used for profiling.
+  *
+  */
+#define CHRONO_DOMAIN_QTY (2U)
 
 /**
  * @brief User typedef for measurements in chrono module
@@ -0,0 +1,201 @@
+/**
+  ******************************************************************************
+  * @file           : chrono_inline.h
+  * @brief          : Inline fast path of the chrono module.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 FaraabinCo.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  *
+  * https://faraabinco.ir/
+  * https://github.com/FaraabinCo
+  *
+  ******************************************************************************
+  @verbatim
+
+  The functions of chrono.c check the initialization of the module and the validity of their arguments, and read the
+  tick through the pointer or the function that is given to fChrono_Init(). In tight loops, this overhead is larger than
+  the work of the function itself.
+
+  When CHRONO_INLINE is INLINE_ENABLED in chrono_config.h, this header provides static inline versions of the hot
+  functions of the objective API:
+  - The tick is read with CHRONO_INLINE_TICK_(), which is bound at compile time, e.g. to a register of a timer.
+  - Ticks are converted to time with the constants of chrono_config.h, so the compiler can replace the division.
+  - The initialization of the module is not checked. The null pointer checks are removed if CHRONO_INLINE_ASSERT is
+    INLINE_ASSERT_DISABLED.
+
+  The inline functions work on the same sChrono objects as the functions of chrono.c, so both can be mixed. fChrono_Init()
+  must still be called before using the module, and CHRONO_INLINE_TICK_() must read the same tick generator.
+
+  CHRONO_INLINE_TICK_() only reads the default clock domain. Chrono objects that are started in another domain with
+  fChrono_StartIn() are passed to the functions of chrono.c.
+
+  @code
+  // chrono_config.h
+  #define CHRONO_INLINE         INLINE_ENABLED
+  #define CHRONO_INLINE_ASSERT  INLINE_ASSERT_DISABLED
+  #define CHRONO_INLINE_TICK_() (SysTick->VAL)
+
+  // Application
+  #include "chrono_inline.h"
+
+  sChrono myChrono;
+  fChrono_StartTimeoutUs(&myChrono, 100);
+  while(!fChrono_IsTimeoutInline(&myChrono)) {
+    // Poll a flag
+  }
+  @endcode
+
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef CHRONO_INLINE_H
+#define CHRONO_INLINE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "chrono.h"
+
+/* Exported defines ----------------------------------------------------------*/
+/**
+ * @brief The inline fast path is disabled unless it is selected in chrono_config.h.
+ *
+ */
+#ifndef CHRONO_INLINE
+#define CHRONO_INLINE INLINE_DISABLED
+#endif
+
+/**
+ * @brief The null pointer checks of the inline functions are enabled unless they are disabled in chrono_config.h.
+ *
+ */
+#ifndef CHRONO_INLINE_ASSERT
+#define CHRONO_INLINE_ASSERT INLINE_ASSERT_ENABLED
+#endif
+
+#if (CHRONO_INLINE == INLINE_ENABLED)
+
+#ifndef CHRONO_INLINE_TICK_
+#error "CHRONO_INLINE_TICK_() should be defined in chrono_config.h file when CHRONO_INLINE is INLINE_ENABLED."
+#endif
+
+/* Exported macro ------------------------------------------------------------*/
+/**
+ * @brief Returns the time length between "a" and "b" with the tick top value of chrono_config.h.
+ *
+ * @note Chronologically, "a" must be a time tick after "b". It is the same as ELAPSED_ in chrono.c.
+ *
+ */
+#if(CHRONO_TICK_COUNTERMODE == TICK_COUNTERMODE_UP)
+#define CHRONO_INLINE_ELAPSED_(a, b)  (((a) >= (b)) ? ((a) - (b)) : ((tick_t)CHRONO_TICK_TOP_VALUE - ((b) - (a))))
+#elif(CHRONO_TICK_COUNTERMODE == TICK_COUNTERMODE_DOWN)
+#define CHRONO_INLINE_ELAPSED_(a, b)  (((a) <= (b)) ? ((b) - (a)) : ((tick_t)CHRONO_TICK_TOP_VALUE - ((a) - (b))))
+#else
+#error "CHRONO_TICK_COUNTERMODE should be either TICK_COUNTERMODE_UP or TICK_COUNTERMODE_DOWN in chrono_config.h file."
+#endif
+
+/**
+ * @brief Asserts whether the object is null or not.
+ *
+ * @note If CHRONO_INLINE_ASSERT is INLINE_ASSERT_DISABLED, this macro is empty.
+ *
+ */
+#if (CHRONO_INLINE_ASSERT == INLINE_ASSERT_ENABLED)
+#define CHRONO_INLINE_ASSERT_NOT_NULL_RET_(object, ret) if((object) == NULL){return (ret);}
+#else
+#define CHRONO_INLINE_ASSERT_NOT_NULL_RET_(object, ret)
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* Exported functions --------------------------------------------------------*/
+/** @defgroup INLINE_API Inline API in chrono module
+ *  @brief These functions are the inline versions of the hot functions of chrono.c.
+ *  @{
+ */
+
+/**
+ * @brief Returns the current tick of the tick generator.
+ *
+ * @retval tick: Current tick value
+ */
+static inline tick_t fChrono_GetTickInline(void) {
+
+  return (tick_t)CHRONO_INLINE_TICK_();
+}
+
+/**
+ * @brief Returns the timeout status of the chrono object.
+ *
+ * @note It is the inline version of fChrono_IsTimeout().
+ *
+ * @param me Pointer to the chrono object
+ * @retval isTimeout: TRUE if the chrono is timed out, otherwise returns FALSE
+ */
+static inline bool_t fChrono_IsTimeoutInline(sChrono * const me) {
+
+  CHRONO_INLINE_ASSERT_NOT_NULL_RET_(me, FALSE); /* MISRA 2012 Rule 15.5 deviation */
+
+#if (CHRONO_DOMAIN_QTY > 1U)
+  if(me->_domain != CHRONO_DOMAIN_DEFAULT) {
+    return fChrono_IsTimeout(me); /* MISRA 2012 Rule 15.5 deviation */
+  }
+#endif
+
+  if(!me->_run) {
+    return FALSE; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  if(!me->_isTimeout) {
+    tick_t currentTick = fChrono_GetTickInline();
+    me->_isTimeout = (CHRONO_INLINE_ELAPSED_(currentTick, me->_startTick) >= me->_timeout);
+  }
+
+  return me->_isTimeout;
+}
+
+#if ((1000U / CHRONO_TICK_TO_NANOSECOND_COEF) != 0U)
+/**
+ * @brief Returns the elapsed time since the chrono object started.
+ *
+ * @note It is the inline version of fChrono_ElapsedUs(). It is only available if a microsecond is at least one tick.
+ *
+ * @param me Pointer to the chrono object
+ * @retval elapsed: Elapsed time (microseconds)
+ */
+static inline timeUs_t fChrono_ElapsedUsInline(sChrono const * const me) {
+
+  CHRONO_INLINE_ASSERT_NOT_NULL_RET_(me, (timeUs_t)0); /* MISRA 2012 Rule 15.5 deviation */
+
+#if (CHRONO_DOMAIN_QTY > 1U)
+  if(me->_domain != CHRONO_DOMAIN_DEFAULT) {
+    return fChrono_ElapsedUs(me); /* MISRA 2012 Rule 15.5 deviation */
+  }
+#endif
+
+  tick_t endTick = me->_run ? fChrono_GetTickInline() : me->_stopTick;
+
+  return (timeUs_t)(CHRONO_INLINE_ELAPSED_(endTick, me->_startTick) / (tick_t)(1000U / CHRONO_TICK_TO_NANOSECOND_COEF));
+}
+#endif
+
+/** @} */ //End of INLINE_API
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHRONO_INLINE_H */
+
+/************************ Copyright (c) 2024 FaraabinCo *****END OF FILE****/
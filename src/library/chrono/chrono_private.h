@@ -37,6 +37,15 @@ extern "C" {
 
 #define TICK_COUNTERMODE_UP   (0U)
 #define TICK_COUNTERMODE_DOWN (1U)
+
+#define TICK_EXTENSION_DISABLED (0U)
+#define TICK_EXTENSION_ENABLED  (1U)
+
+#define INLINE_DISABLED (0U)
+#define INLINE_ENABLED  (1U)
+
+#define INLINE_ASSERT_DISABLED  (0U)
+#define INLINE_ASSERT_ENABLED   (1U)
 /** @} */ //End of PRIVATE_DEFINES
 
 #ifdef __cplusplus
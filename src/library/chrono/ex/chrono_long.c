@@ -15,6 +15,21 @@
   * https://github.com/FaraabinCo
   *
   ******************************************************************************
+  @verbatim
+
+  The chronoLong module measures time lengths and timeouts that are longer than one overflow of the tick generator,
+  e.g. hours or days.
+
+  When CHRONO_TICK_EXTENSION is TICK_EXTENSION_ENABLED, an sChronoLong object stores 64-bit timestamps of
+  fChrono_GetTick64(). This timestamp is always valid as long as the overflow interrupt calls fChrono_TickOverflowHandler(),
+  so the objects don't need to be polled between overflows. Elapsed and left times are a subtraction and a conversion,
+  and reading them doesn't change the object.
+
+  Otherwise, the timestamps are fChrono_GetContinuousTickMs(), which must be called at least once per overflow of the
+  tick generator, e.g. by calling any function of this module.
+
+  @endverbatim
+  ******************************************************************************
   */
 
 /* Includes ------------------------------------------------------------------*/
@@ -42,9 +57,26 @@
  */
 #define CHECK_RUN_(ret)   if(!me->_run){return (ret);}
 
+/**
+ * @brief Converts between milliseconds and the unit of the 64-bit timestamp.
+ * 
+ * @note With the tick extension, the timestamp is in ticks and the conversion goes through nanoseconds, which
+ *       doesn't overflow for 584 years.
+ * 
+ */
+#if (CHRONO_TICK_EXTENSION == TICK_EXTENSION_ENABLED)
+#define TICK_TO_MS_(tick_)  (((uint64_t)(tick_) * (uint64_t)CHRONO_TICK_TO_NANOSECOND_COEF) / (uint64_t)1000000U)
+#define MS_TO_TICK_(ms_)    (((uint64_t)(ms_) * (uint64_t)1000000U) / (uint64_t)CHRONO_TICK_TO_NANOSECOND_COEF)
+#else
+#define TICK_TO_MS_(tick_)  ((uint64_t)(tick_))
+#define MS_TO_TICK_(ms_)    ((uint64_t)(ms_))
+#endif
+
 /* Private typedef -----------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+static uint64_t fLongGetTimestamp(void);
+
 /* Variables -----------------------------------------------------------------*/
 
 /*
@@ -69,10 +101,7 @@
  */
 void fChronoLong_Start(sChronoLong * const me) {
 
-  CHRONO_LONG_CRITICAL_SECTION_ENTER_;
-  me->_startTimeMs = millis_();
-  CHRONO_LONG_CRITICAL_SECTION_EXIT_;
-
+  me->_startTick = fLongGetTimestamp();
   me->_run = TRUE;
 }
 
@@ -84,9 +113,8 @@ void fChronoLong_Start(sChronoLong * const me) {
  * @param me Pointer to the chrono object
  */
 void fChronoLong_Stop(sChronoLong * const me) {
-  
+
   me->_run = FALSE;
-  me->_isTimeout = FALSE;
 }
 
 /**
@@ -98,16 +126,8 @@ void fChronoLong_Stop(sChronoLong * const me) {
  * @retval elapsed: Elapsed time since starting the chrono object (seconds)
  */
 uint64_t fChronoLong_ElapsedS(sChronoLong const * const me) {
-  
-  CHECK_RUN_((uint64_t)0);  /* MISRA 2012 Rule 15.5 deviation */
-  
-  uint64_t startTime = me->_startTimeMs;
-  
-  CHRONO_LONG_CRITICAL_SECTION_ENTER_;
-  uint64_t millis = millis_();
-  CHRONO_LONG_CRITICAL_SECTION_EXIT_;
 
-  return (ELAPSED_(millis, startTime) / 1000U);
+  return (fChronoLong_ElapsedMs(me) / 1000U);
 }
 
 /**
@@ -119,16 +139,13 @@ uint64_t fChronoLong_ElapsedS(sChronoLong const * const me) {
  * @retval elapsed: Elapsed time since starting the chrono object (milliseconds)
  */
 uint64_t fChronoLong_ElapsedMs(sChronoLong const * const me) {
-  
+
   CHECK_RUN_((uint64_t)0);  /* MISRA 2012 Rule 15.5 deviation */
-  
-  uint64_t startTime = me->_startTimeMs;
 
-  CHRONO_LONG_CRITICAL_SECTION_ENTER_;
-  uint64_t millis = millis_();
-  CHRONO_LONG_CRITICAL_SECTION_EXIT_;
-  
-  return ELAPSED_(millis, startTime);
+  uint64_t startTick = me->_startTick;
+  uint64_t currentTick = fLongGetTimestamp();
+
+  return TICK_TO_MS_(ELAPSED_(currentTick, startTick));
 }
 
 /**
@@ -136,33 +153,24 @@ uint64_t fChronoLong_ElapsedMs(sChronoLong const * const me) {
  * 
  * @note Before using this function, ensure that fChronoLong_StartTimeoutS() or fChronoLong_StartTimeoutMs() has been called to start the measurement.
  * 
- * @note This function works correctly if a timeout has occurred, returning zero in that case.
- *       However, if it is called after the timeout, and the tick values have surpassed the start tick, the returned value is no longer valid.
+ * @note This function returns zero after the timeout.
  * 
  * @param me Pointer to the chrono object
  * @retval timeLeft: Time length until timeout (seconds)
  */
-uint64_t fChronoLong_LeftS(sChronoLong * const me) {
-  
+uint64_t fChronoLong_LeftS(sChronoLong const * const me) {
+
   CHECK_RUN_((uint64_t)0);  /* MISRA 2012 Rule 15.5 deviation */
-  
-  uint64_t startTime = me->_startTimeMs;
-  
-  if(me->_isTimeout) {
-    return (uint64_t)0;
-  }
 
-  CHRONO_LONG_CRITICAL_SECTION_ENTER_;
-  uint64_t millis = millis_();
-  CHRONO_LONG_CRITICAL_SECTION_EXIT_;
-    
-  uint64_t elapsed = (ELAPSED_(millis, startTime)) / (uint64_t)1000U;
-  if(elapsed >= (me->_timeoutMs / (tick_t)1000U)) {
-    me->_isTimeout = TRUE;
-    return 0;
-  } else {
-    return ((me->_timeoutMs / (tick_t)1000) - elapsed);
+  uint64_t startTick = me->_startTick;
+  uint64_t currentTick = fLongGetTimestamp();
+  uint64_t elapsedTick = ELAPSED_(currentTick, startTick);
+
+  if(elapsedTick >= me->_timeoutTick) {
+    return (uint64_t)0; /* MISRA 2012 Rule 15.5 deviation */
   }
+
+  return ((TICK_TO_MS_(me->_timeoutTick) / 1000U) - (TICK_TO_MS_(elapsedTick) / 1000U));
 }
 
 /**
@@ -170,33 +178,24 @@ uint64_t fChronoLong_LeftS(sChronoLong * const me) {
  * 
  * @note Before using this function, ensure that fChronoLong_StartTimeoutS() or fChronoLong_StartTimeoutMs() has been called to start the measurement.
  * 
- * @note This function works correctly if a timeout has occurred, returning zero in that case.
- *       However, if it is called after the timeout, and the tick values have surpassed the start tick, the returned value is no longer valid.
+ * @note This function returns zero after the timeout.
  * 
  * @param me Pointer to the chrono object
  * @retval timeLeft: Time length until timeout (milliseconds)
  */
-uint64_t fChronoLong_LeftMs(sChronoLong * const me) {
-  
+uint64_t fChronoLong_LeftMs(sChronoLong const * const me) {
+
   CHECK_RUN_((uint64_t)0);  /* MISRA 2012 Rule 15.5 deviation */
-  
-  uint64_t startTime = me->_startTimeMs;
-  
-  if(me->_isTimeout) {
-    return (timeMs_t)0;
-  }
 
-  CHRONO_LONG_CRITICAL_SECTION_ENTER_;
-  uint64_t millis = millis_();
-  CHRONO_LONG_CRITICAL_SECTION_EXIT_;
-    
-  uint64_t elapsed = ELAPSED_(millis, startTime);
-  if(elapsed >= (me->_timeoutMs)) {
-    me->_isTimeout = TRUE;
-    return (timeMs_t)0;
-  } else {
-    return ((me->_timeoutMs) - elapsed);
+  uint64_t startTick = me->_startTick;
+  uint64_t currentTick = fLongGetTimestamp();
+  uint64_t elapsedTick = ELAPSED_(currentTick, startTick);
+
+  if(elapsedTick >= me->_timeoutTick) {
+    return (uint64_t)0; /* MISRA 2012 Rule 15.5 deviation */
   }
+
+  return (TICK_TO_MS_(me->_timeoutTick) - TICK_TO_MS_(elapsedTick));
 }
 
 /**
@@ -206,11 +205,8 @@ uint64_t fChronoLong_LeftMs(sChronoLong * const me) {
  * @param timeout Time length until the chronoLong object times out (seconds)
  */
 void fChronoLong_StartTimeoutS(sChronoLong * const me, uint64_t timeout) {
-  
-  me->_timeoutMs = (tick_t)(timeout * (uint64_t)1000U);
-  me->_isTimeout = FALSE;
-  
-  fChronoLong_Start(me);
+
+  fChronoLong_StartTimeoutMs(me, timeout * (uint64_t)1000U);
 }
 
 /**
@@ -220,10 +216,9 @@ void fChronoLong_StartTimeoutS(sChronoLong * const me, uint64_t timeout) {
  * @param timeout Time length until the chronoLong object times out (milliseconds)
  */
 void fChronoLong_StartTimeoutMs(sChronoLong * const me, uint64_t timeout) {
-  
-  me->_timeoutMs = timeout;
-  me->_isTimeout = FALSE;
-  
+
+  me->_timeoutTick = MS_TO_TICK_(timeout);
+
   fChronoLong_Start(me);
 }
 
@@ -235,27 +230,14 @@ void fChronoLong_StartTimeoutMs(sChronoLong * const me, uint64_t timeout) {
  * @param me Pointer to the chronoLong object
  * @retval isTimeout: TRUE if the chronoLong is timed out, otherwise returns FALSE
  */
-bool_t fChronoLong_IsTimeout(sChronoLong * const me) {
-  
-  CHECK_RUN_(FALSE);  /* MISRA 2012 Rule 15.5 deviation */
-  
-  uint64_t startTime = me->_startTimeMs;
-  
-  if(me->_isTimeout) {
-    return TRUE;
-  }
+bool_t fChronoLong_IsTimeout(sChronoLong const * const me) {
 
-  CHRONO_LONG_CRITICAL_SECTION_ENTER_;
-  uint64_t millis = millis_();
-  CHRONO_LONG_CRITICAL_SECTION_EXIT_;
+  CHECK_RUN_(FALSE);  /* MISRA 2012 Rule 15.5 deviation */
 
-  if(ELAPSED_(millis, startTime) >= me->_timeoutMs) {
-    me->_isTimeout = TRUE;
-  } else {
-    return FALSE;
-  }
+  uint64_t startTick = me->_startTick;
+  uint64_t currentTick = fLongGetTimestamp();
 
-  return TRUE;
+  return (ELAPSED_(currentTick, startTick) >= me->_timeoutTick);
 }
 
 /** @} */ //End of OBJECTIVE_API
@@ -266,5 +248,25 @@ bool_t fChronoLong_IsTimeout(sChronoLong * const me) {
 ╚══════════════════════════════════════════════════════════════════════════════════╝
 */
 
+/**
+ * @brief Returns the 64-bit timestamp that the chronoLong objects are based on.
+ * 
+ * @note fChrono_GetTick64() is lock-free. fChrono_GetContinuousTickMs() is not re-entrant, so it is called in the
+ *       critical section of chrono_long_config.h.
+ * 
+ * @retval timestamp: Ticks since fChrono_Init() with the tick extension, otherwise milliseconds
+ */
+static uint64_t fLongGetTimestamp(void) {
+
+#if (CHRONO_TICK_EXTENSION == TICK_EXTENSION_ENABLED)
+  return fChrono_GetTick64();
+#else
+  CHRONO_LONG_CRITICAL_SECTION_ENTER_;
+  uint64_t millis = millis_();
+  CHRONO_LONG_CRITICAL_SECTION_EXIT_;
+
+  return millis;
+#endif
+}
 
 /************************ Copyright (c) 2024 FaraabinCo *****END OF FILE****/
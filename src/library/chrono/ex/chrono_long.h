@@ -48,14 +48,11 @@ typedef struct {
                              When this parameter is false, the chronoLong is in stop mode, and time measurement functions will return 0.
                              This parameter is private and is set by the chronoLong API. Users must not change its value. */
 
-  uint64_t _startTimeMs;  /*!< Holds the start time of the chronoLong in milliseconds.
+  uint64_t _startTick;    /*!< Holds the 64-bit timestamp of the start of the chronoLong.
                              This parameter is private and is set by the chronoLong API. Users must not change its value. */
   
-  uint64_t _timeoutMs;    /*!< Holds the timeout length.
-                             This parameter is private and is set by the chrono API. Users must not change its value. */
-  
-  bool_t _isTimeout;      /*!< Holds the timeout state of the chronoLong object.
-                             This parameter is private and is set by the chrono API. Users must not change its value. */
+  uint64_t _timeoutTick;  /*!< Holds the timeout length in units of the 64-bit timestamp.
+                             This parameter is private and is set by the chronoLong API. Users must not change its value. */
   
 }sChronoLong;
 
@@ -94,8 +91,8 @@ uint64_t fChronoLong_ElapsedMs(sChronoLong const * const me);
  *  @brief These functions return the remaining time until the chronoLong object reaches its timeout.
  *  @{
  */
-uint64_t fChronoLong_LeftS(sChronoLong * const me);
-uint64_t fChronoLong_LeftMs(sChronoLong * const me);
+uint64_t fChronoLong_LeftS(sChronoLong const * const me);
+uint64_t fChronoLong_LeftMs(sChronoLong const * const me);
 
 /** @} */ //End of LEFT
 
@@ -107,7 +104,7 @@ uint64_t fChronoLong_LeftMs(sChronoLong * const me);
 
 void fChronoLong_StartTimeoutS(sChronoLong * const me, uint64_t timeout);
 void fChronoLong_StartTimeoutMs(sChronoLong * const me, uint64_t timeout);
-bool_t fChronoLong_IsTimeout(sChronoLong * const me);
+bool_t fChronoLong_IsTimeout(sChronoLong const * const me);
 
 /** @} */ //End of TIMEOUT
 
@@ -0,0 +1,685 @@
+/**
+  ******************************************************************************
+  * @file           : chrono_scheduler.c
+  * @brief          : ChronoScheduler module.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 FaraabinCo.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  *
+  * https://faraabinco.ir/
+  * https://github.com/FaraabinCo
+  *
+  ******************************************************************************
+  @verbatim
+
+  The chronoScheduler runs periodic tasks from a single loop. Instead of every task polling its own sChrono object
+  with fChrono_IsTimeout(), the scheduler samples the tick once per fChronoScheduler_Run() and keeps the tasks in a
+  binary min-heap ordered by deadline. When no task is due, a run costs one tick read and one comparison, regardless
+  of the number of tasks. Each due task costs O(log n).
+
+  Deadlines advance by whole periods from the first deadline, so the schedule does not drift with the lateness of
+  the loop. If a task falls more than one period behind, fChronoScheduler_SetTaskOverrunPolicy() selects what happens:
+  - eCHRONO_OVERRUN_SKIP (default): The task runs once and the missed periods are skipped. The deadlines stay on the
+    original period grid.
+  - eCHRONO_OVERRUN_CATCH_UP: The task runs once for every missed period in a burst. Use it when every period counts,
+    e.g. an integrator or a counter. A long stall causes a long burst.
+  - eCHRONO_OVERRUN_RESYNC: The task runs once and the next deadline is one period after now.
+  In all cases, the number of missed periods is counted and is returned by fChronoScheduler_GetTaskMissedQty().
+
+  For each task, the scheduler records the lateness of its last run (how long after its deadline it ran) and the
+  jitter (the change of lateness between two consecutive runs), together with their maximum values.
+  fChronoScheduler_SetTaskHistogram() optionally adds a histogram of the lateness of the task. The bins are an array of
+  the user, so they can be introduced to Faraabin as a U32 array variable and monitored or streamed.
+
+  If CHRONO_TICK_EXTENSION is disabled, fChronoScheduler_Run() must be called at least once per tick generator
+  overflow, the same as fChrono_GetContinuousTickUs().
+
+  Since the earliest deadline is always at the root of the heap, fChronoScheduler_NextDeadlineUs() returns the time
+  that the loop can sleep (tickless idle) without delaying any task. The tick keeps counting while the MCU sleeps.
+
+  @code
+  #include "chrono_scheduler.h"
+
+  static sChronoScheduler Scheduler;
+  static sChronoTask *SchedulerHeap[2];
+  static sChronoTask ControlTask;
+  static sChronoTask LogTask;
+
+  static void ControlRun(void *arg) {
+    // Runs every 1 ms
+  }
+
+  static void LogRun(void *arg) {
+    // Runs every 100 ms
+    printf("Control jitter: %u us\n", fChronoScheduler_GetTaskMaxJitterUs(&ControlTask));
+  }
+
+  int main(void) {
+
+    fChrono_Init(tickValue);
+
+    fChronoScheduler_Init(&Scheduler, SchedulerHeap, 2);
+    fChronoScheduler_AddTaskUs(&Scheduler, &ControlTask, ControlRun, NULL, 1000);
+    fChronoScheduler_AddTaskMs(&Scheduler, &LogTask, LogRun, NULL, 100);
+    fChronoScheduler_SetTaskOverrunPolicy(&LogTask, eCHRONO_OVERRUN_RESYNC);
+
+    while(TRUE) {
+      fChronoScheduler_Run(&Scheduler);
+
+      // Sleep until the next deadline or an interrupt
+      fBsp_Sleep(fChronoScheduler_NextDeadlineUs(&Scheduler));
+    }
+  }
+  @endcode
+
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "chrono_scheduler.h"
+
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/**
+ * @brief Checks whether the scheduler is initialized or not.
+ *
+ * @note If the scheduler is not initialized, this macro forces the API to return the values specified by "ret".
+ *
+ */
+#define CHECK_INIT_RET_(ret)  if(!me->_init){return (ret);}
+
+/**
+ * @brief Asserts whether the object is null or not.
+ *
+ * @note If the object is null, ASSERT_NOT_NULL_RET_ macro forces the API to return the value specified by "ret"
+ *
+ */
+#define ASSERT_NOT_NULL_RET_(object, ret) if((object) == NULL){return (ret);}
+
+/**
+ * @brief Returns the index of the parent and the left child of a heap node.
+ *
+ */
+#define HEAP_PARENT_(index_)  (((index_) - 1U) / 2U)
+#define HEAP_CHILD_(index_)   (((index_) * 2U) + 1U)
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static uint64_t fSchedulerSampleTick(sChronoScheduler * const me);
+static uint8_t fSchedulerAddTask(sChronoScheduler * const me, sChronoTask * const task, void(*fpRun)(void *arg), void *arg, uint64_t periodTick);
+static void fHeapPlace(sChronoScheduler * const me, sChronoTask * const task, uint16_t index);
+static void fHeapSiftUp(sChronoScheduler * const me, uint16_t index);
+static void fHeapSiftDown(sChronoScheduler * const me, uint16_t index);
+static uint32_t fTickToUs(uint64_t tick);
+
+/* Variables -----------------------------------------------------------------*/
+
+/*
+╔══════════════════════════════════════════════════════════════════════════════════╗
+║                          ##### Exported Functions #####                          ║
+╚══════════════════════════════════════════════════════════════════════════════════╝
+*/
+
+/** @defgroup OBJECTIVE_API Objective API in the chrono_scheduler module
+ *  @brief These functions require an object of type sChronoScheduler. Users must declare one to use this API.
+ *  @{
+ */
+
+/**
+ * @brief Initializes the scheduler object.
+ *
+ * @attention The chrono module must be initialized before calling this function.
+ *
+ * @param me Pointer to the scheduler object
+ * @param heap Array of task pointers that holds the deadline heap. Its length sets the maximum number of tasks.
+ * @param capacity Number of task pointers in the heap array
+ * @retval status: CHRONO_SCHEDULER_OK if successful, otherwise one of the CHRONO_SCHEDULER_ERROR codes.
+ */
+uint8_t fChronoScheduler_Init(sChronoScheduler * const me, sChronoTask **heap, uint16_t capacity) {
+
+  ASSERT_NOT_NULL_RET_(me, CHRONO_SCHEDULER_ERROR_NULL_PTR); /* MISRA 2012 Rule 15.5 deviation */
+
+  me->_init = FALSE;
+
+  ASSERT_NOT_NULL_RET_(heap, CHRONO_SCHEDULER_ERROR_NULL_PTR); /* MISRA 2012 Rule 15.5 deviation */
+
+  me->_heap = heap;
+  me->_capacity = capacity;
+  me->_taskQty = 0U;
+  me->_nowTick = 0U;
+  me->_lastTick = fChrono_GetTick();
+
+  me->_init = TRUE;
+
+  (void)fSchedulerSampleTick(me);
+
+  return CHRONO_SCHEDULER_OK;
+}
+
+/**
+ * @brief Adds a periodic task to the scheduler with a period in microseconds.
+ *
+ * @note The first run of the task is one period after this call.
+ *
+ * @param me Pointer to the scheduler object
+ * @param task Pointer to the task object
+ * @param fpRun Function that is called on every period
+ * @param arg Argument that is passed to fpRun
+ * @param periodUs Period of the task in microseconds. It must be at least one tick.
+ * @retval status: CHRONO_SCHEDULER_OK if successful, otherwise one of the CHRONO_SCHEDULER_ERROR codes.
+ */
+uint8_t fChronoScheduler_AddTaskUs(sChronoScheduler * const me, sChronoTask * const task, void(*fpRun)(void *arg), void *arg, uint32_t periodUs) {
+
+  uint32_t tickToNsCoef = fChrono_GetTickToNsCoef();
+
+  if(tickToNsCoef == 0U) {
+    return CHRONO_SCHEDULER_ERROR_NOT_INIT; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return fSchedulerAddTask(me, task, fpRun, arg, ((uint64_t)periodUs * 1000U) / tickToNsCoef);
+}
+
+/**
+ * @brief Adds a periodic task to the scheduler with a period in milliseconds.
+ *
+ * @note The first run of the task is one period after this call.
+ *
+ * @param me Pointer to the scheduler object
+ * @param task Pointer to the task object
+ * @param fpRun Function that is called on every period
+ * @param arg Argument that is passed to fpRun
+ * @param periodMs Period of the task in milliseconds
+ * @retval status: CHRONO_SCHEDULER_OK if successful, otherwise one of the CHRONO_SCHEDULER_ERROR codes.
+ */
+uint8_t fChronoScheduler_AddTaskMs(sChronoScheduler * const me, sChronoTask * const task, void(*fpRun)(void *arg), void *arg, uint32_t periodMs) {
+
+  uint32_t tickToNsCoef = fChrono_GetTickToNsCoef();
+
+  if(tickToNsCoef == 0U) {
+    return CHRONO_SCHEDULER_ERROR_NOT_INIT; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return fSchedulerAddTask(me, task, fpRun, arg, ((uint64_t)periodMs * 1000000U) / tickToNsCoef);
+}
+
+/**
+ * @brief Removes a task from the scheduler.
+ *
+ * @note A task can remove itself, or any other task, from inside its run function.
+ *
+ * @param me Pointer to the scheduler object
+ * @param task Pointer to the task object
+ * @retval status: CHRONO_SCHEDULER_OK if successful, otherwise one of the CHRONO_SCHEDULER_ERROR codes.
+ */
+uint8_t fChronoScheduler_RemoveTask(sChronoScheduler * const me, sChronoTask * const task) {
+
+  ASSERT_NOT_NULL_RET_(me, CHRONO_SCHEDULER_ERROR_NULL_PTR); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RET_(task, CHRONO_SCHEDULER_ERROR_NULL_PTR); /* MISRA 2012 Rule 15.5 deviation */
+  CHECK_INIT_RET_(CHRONO_SCHEDULER_ERROR_NOT_INIT); /* MISRA 2012 Rule 15.5 deviation */
+
+  uint16_t index = task->_heapIndex;
+
+  if(!task->_scheduled || (index >= me->_taskQty) || (me->_heap[index] != task)) {
+    return CHRONO_SCHEDULER_ERROR_NOT_SCHEDULED; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  task->_scheduled = FALSE;
+  me->_taskQty--;
+
+  if(index == me->_taskQty) {
+    return CHRONO_SCHEDULER_OK; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  fHeapPlace(me, me->_heap[me->_taskQty], index);
+  fHeapSiftUp(me, index);
+  fHeapSiftDown(me, me->_heap[index]->_heapIndex);
+
+  return CHRONO_SCHEDULER_OK;
+}
+
+/**
+ * @brief Sets what the scheduler does when a task misses one or more of its periods.
+ *
+ * @note Adding a task sets its policy to eCHRONO_OVERRUN_SKIP, so call this function after adding the task.
+ *
+ * @param task Pointer to the task object
+ * @param policy Overrun policy of the task
+ * @retval status: CHRONO_SCHEDULER_OK if successful, otherwise one of the CHRONO_SCHEDULER_ERROR codes.
+ */
+uint8_t fChronoScheduler_SetTaskOverrunPolicy(sChronoTask * const task, eChronoOverrunPolicy policy) {
+
+  ASSERT_NOT_NULL_RET_(task, CHRONO_SCHEDULER_ERROR_NULL_PTR); /* MISRA 2012 Rule 15.5 deviation */
+
+  if((policy != eCHRONO_OVERRUN_SKIP) && (policy != eCHRONO_OVERRUN_CATCH_UP) && (policy != eCHRONO_OVERRUN_RESYNC)) {
+    return CHRONO_SCHEDULER_ERROR_INVALID_PARAM; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  task->_overrunPolicy = policy;
+
+  return CHRONO_SCHEDULER_OK;
+}
+
+/**
+ * @brief Sets the bins of the lateness histogram of a task.
+ *
+ * @note On every run, the bin of the lateness of the run is incremented. Bin i counts the runs with a lateness in
+ *       [i * binWidthUs, (i + 1) * binWidthUs) and the last bin also counts all the later runs.
+ * @note The bins are cleared by this function. Adding a task disables its histogram, so call this function after
+ *       adding the task.
+ *
+ * @param task Pointer to the task object
+ * @param bins Array of bins. Pass NULL to disable the histogram.
+ * @param binQty Number of bins in the array
+ * @param binWidthUs Width of each bin in microseconds. It is rounded down to whole ticks, with a minimum of one tick.
+ * @retval status: CHRONO_SCHEDULER_OK if successful, otherwise one of the CHRONO_SCHEDULER_ERROR codes.
+ */
+uint8_t fChronoScheduler_SetTaskHistogram(sChronoTask * const task, uint32_t *bins, uint16_t binQty, uint32_t binWidthUs) {
+
+  ASSERT_NOT_NULL_RET_(task, CHRONO_SCHEDULER_ERROR_NULL_PTR); /* MISRA 2012 Rule 15.5 deviation */
+
+  task->_histogram = NULL;
+
+  if(bins == NULL) {
+    return CHRONO_SCHEDULER_OK; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  uint32_t tickToNsCoef = fChrono_GetTickToNsCoef();
+
+  if(tickToNsCoef == 0U) {
+    return CHRONO_SCHEDULER_ERROR_NOT_INIT; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  if(binQty == 0U) {
+    return CHRONO_SCHEDULER_ERROR_INVALID_PARAM; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  uint64_t binTick = ((uint64_t)binWidthUs * 1000U) / tickToNsCoef;
+
+  if(binTick == 0U) {
+    binTick = 1U;
+  } else if(binTick > (uint64_t)fChrono_GetTickTopValue()) {
+    binTick = (uint64_t)fChrono_GetTickTopValue();
+  } else {
+    /* Bin width fits in a tick */
+  }
+
+  for(uint16_t i = 0U; i < binQty; i++) {
+    bins[i] = 0U;
+  }
+
+  task->_histogramBinQty = binQty;
+  task->_histogramBinTick = (tick_t)binTick;
+  task->_histogram = bins;
+
+  return CHRONO_SCHEDULER_OK;
+}
+
+/**
+ * @brief Runs the tasks that are due.
+ *
+ * @note The tick is sampled once. Due tasks run in deadline order and each one is rescheduled before its run function
+ *       is called. If no task is due, this function only reads the tick and compares it with the earliest deadline.
+ *
+ * @param me Pointer to the scheduler object
+ * @retval runQty: Number of task runs
+ */
+uint16_t fChronoScheduler_Run(sChronoScheduler * const me) {
+
+  uint16_t runQty = 0U;
+
+  ASSERT_NOT_NULL_RET_(me, 0U); /* MISRA 2012 Rule 15.5 deviation */
+  CHECK_INIT_RET_(0U); /* MISRA 2012 Rule 15.5 deviation */
+
+  uint64_t now = fSchedulerSampleTick(me);
+
+  while((me->_taskQty > 0U) && (me->_heap[0]->_deadlineTick <= now)) {
+
+    sChronoTask *task = me->_heap[0];
+    uint64_t lateness = now - task->_deadlineTick;
+    tick_t latenessTick = (lateness > (uint64_t)fChrono_GetTickTopValue()) ? fChrono_GetTickTopValue() : (tick_t)lateness;
+
+    if(task->_runQty > 0U) {
+      task->_jitterTick = (latenessTick >= task->_latenessTick) ? (latenessTick - task->_latenessTick) : (task->_latenessTick - latenessTick);
+      if(task->_jitterTick > task->_maxJitterTick) {
+        task->_maxJitterTick = task->_jitterTick;
+      }
+    }
+
+    task->_latenessTick = latenessTick;
+    if(latenessTick > task->_maxLatenessTick) {
+      task->_maxLatenessTick = latenessTick;
+    }
+
+    if(task->_histogram != NULL) {
+      uint32_t bin = (uint32_t)(latenessTick / task->_histogramBinTick);
+      task->_histogram[(bin < task->_histogramBinQty) ? bin : (task->_histogramBinQty - 1U)]++;
+    }
+
+    uint64_t missedQty = 0U;
+    if(lateness >= task->_periodTick) {
+      missedQty = lateness / task->_periodTick;
+    }
+
+    switch(task->_overrunPolicy) {
+
+      case eCHRONO_OVERRUN_CATCH_UP: {
+        /* The missed periods run in the next iterations, one per iteration. */
+        task->_deadlineTick += task->_periodTick;
+        task->_missedQty += (missedQty > 0U) ? 1U : 0U;
+        break;
+      }
+
+      case eCHRONO_OVERRUN_RESYNC: {
+        task->_deadlineTick = now + task->_periodTick;
+        task->_missedQty += (uint32_t)missedQty;
+        break;
+      }
+
+      default: {
+        task->_deadlineTick += ((missedQty + 1U) * task->_periodTick);
+        task->_missedQty += (uint32_t)missedQty;
+        break;
+      }
+    }
+
+    fHeapSiftDown(me, 0U);
+
+    task->_runQty++;
+    runQty++;
+
+    task->_fpRun(task->_arg);
+  }
+
+  return runQty;
+}
+
+/**
+ * @brief Returns the time until the earliest deadline of the scheduled tasks.
+ *
+ * @note The tick is sampled to compute the remaining time. Use this value to program a wake-up before entering a
+ *       low power mode, e.g. with WFI. Sleeping for this time doesn't delay any task.
+ *
+ * @param me Pointer to the scheduler object
+ * @retval nextDeadline: Time until the earliest deadline (microseconds). It is 0 if a task is due, and UINT32_MAX if
+ *                       no task is scheduled or the deadline is further than UINT32_MAX microseconds.
+ */
+uint32_t fChronoScheduler_NextDeadlineUs(sChronoScheduler * const me) {
+
+  ASSERT_NOT_NULL_RET_(me, UINT32_MAX); /* MISRA 2012 Rule 15.5 deviation */
+  CHECK_INIT_RET_(UINT32_MAX); /* MISRA 2012 Rule 15.5 deviation */
+
+  if(me->_taskQty == 0U) {
+    return UINT32_MAX; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  uint64_t now = fSchedulerSampleTick(me);
+  uint64_t deadline = me->_heap[0]->_deadlineTick;
+
+  if(deadline <= now) {
+    return 0U; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return fTickToUs(deadline - now);
+}
+
+/**
+ * @brief Returns the number of times a task has run since it was added.
+ *
+ * @param task Pointer to the task object
+ * @retval runQty: Number of runs
+ */
+uint32_t fChronoScheduler_GetTaskRunQty(sChronoTask const * const task) {
+
+  ASSERT_NOT_NULL_RET_(task, 0U); /* MISRA 2012 Rule 15.5 deviation */
+
+  return task->_runQty;
+}
+
+/**
+ * @brief Returns how long after its deadline the last run of a task started.
+ *
+ * @param task Pointer to the task object
+ * @retval lateness: Lateness of the last run (microseconds)
+ */
+uint32_t fChronoScheduler_GetTaskLatenessUs(sChronoTask const * const task) {
+
+  ASSERT_NOT_NULL_RET_(task, 0U); /* MISRA 2012 Rule 15.5 deviation */
+
+  return fTickToUs(task->_latenessTick);
+}
+
+/**
+ * @brief Returns the maximum lateness of a task since it was added.
+ *
+ * @param task Pointer to the task object
+ * @retval maxLateness: Maximum lateness (microseconds)
+ */
+uint32_t fChronoScheduler_GetTaskMaxLatenessUs(sChronoTask const * const task) {
+
+  ASSERT_NOT_NULL_RET_(task, 0U); /* MISRA 2012 Rule 15.5 deviation */
+
+  return fTickToUs(task->_maxLatenessTick);
+}
+
+/**
+ * @brief Returns the jitter of a task, which is the change of lateness between its last two runs.
+ *
+ * @param task Pointer to the task object
+ * @retval jitter: Jitter of the last run (microseconds)
+ */
+uint32_t fChronoScheduler_GetTaskJitterUs(sChronoTask const * const task) {
+
+  ASSERT_NOT_NULL_RET_(task, 0U); /* MISRA 2012 Rule 15.5 deviation */
+
+  return fTickToUs(task->_jitterTick);
+}
+
+/**
+ * @brief Returns the maximum jitter of a task since it was added.
+ *
+ * @param task Pointer to the task object
+ * @retval maxJitter: Maximum jitter (microseconds)
+ */
+uint32_t fChronoScheduler_GetTaskMaxJitterUs(sChronoTask const * const task) {
+
+  ASSERT_NOT_NULL_RET_(task, 0U); /* MISRA 2012 Rule 15.5 deviation */
+
+  return fTickToUs(task->_maxJitterTick);
+}
+
+/**
+ * @brief Returns the number of periods that a task missed since it was added.
+ *
+ * @note With eCHRONO_OVERRUN_CATCH_UP, a missed period is one whose run started after the next deadline had passed.
+ *
+ * @param task Pointer to the task object
+ * @retval missedQty: Number of missed periods
+ */
+uint32_t fChronoScheduler_GetTaskMissedQty(sChronoTask const * const task) {
+
+  ASSERT_NOT_NULL_RET_(task, 0U); /* MISRA 2012 Rule 15.5 deviation */
+
+  return task->_missedQty;
+}
+
+/** @} */ //End of OBJECTIVE_API
+
+/*
+╔══════════════════════════════════════════════════════════════════════════════════╗
+║                            ##### Private Functions #####                         ║
+╚══════════════════════════════════════════════════════════════════════════════════╝
+*/
+
+/**
+ * @brief Samples the tick and updates the time base of the scheduler.
+ *
+ * @note With CHRONO_TICK_EXTENSION, the time base is the 64-bit tick of the chrono module. Otherwise the elapsed ticks
+ *       since the last sample are accumulated.
+ *
+ * @param me Pointer to the scheduler object
+ * @retval now: Time base of the scheduler (ticks)
+ */
+static uint64_t fSchedulerSampleTick(sChronoScheduler * const me) {
+
+#if (CHRONO_TICK_EXTENSION == TICK_EXTENSION_ENABLED)
+
+  me->_nowTick = fChrono_GetTick64();
+
+#else
+
+  tick_t tick = fChrono_GetTick();
+
+  me->_nowTick += (uint64_t)fChrono_TimeSpanTick(me->_lastTick, tick);
+  me->_lastTick = tick;
+
+#endif
+
+  return me->_nowTick;
+}
+
+/**
+ * @brief Adds a periodic task to the scheduler with a period in ticks.
+ *
+ * @param me Pointer to the scheduler object
+ * @param task Pointer to the task object
+ * @param fpRun Function that is called on every period
+ * @param arg Argument that is passed to fpRun
+ * @param periodTick Period of the task in ticks
+ * @retval status: CHRONO_SCHEDULER_OK if successful, otherwise one of the CHRONO_SCHEDULER_ERROR codes.
+ */
+static uint8_t fSchedulerAddTask(sChronoScheduler * const me, sChronoTask * const task, void(*fpRun)(void *arg), void *arg, uint64_t periodTick) {
+
+  ASSERT_NOT_NULL_RET_(me, CHRONO_SCHEDULER_ERROR_NULL_PTR); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RET_(task, CHRONO_SCHEDULER_ERROR_NULL_PTR); /* MISRA 2012 Rule 15.5 deviation */
+  ASSERT_NOT_NULL_RET_(fpRun, CHRONO_SCHEDULER_ERROR_NULL_PTR); /* MISRA 2012 Rule 15.5 deviation */
+  CHECK_INIT_RET_(CHRONO_SCHEDULER_ERROR_NOT_INIT); /* MISRA 2012 Rule 15.5 deviation */
+
+  if(periodTick == 0U) {
+    return CHRONO_SCHEDULER_ERROR_PERIOD_ZERO; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  if(me->_taskQty >= me->_capacity) {
+    return CHRONO_SCHEDULER_ERROR_FULL; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  if(task->_scheduled) {
+    (void)fChronoScheduler_RemoveTask(me, task);
+  }
+
+  task->_fpRun = fpRun;
+  task->_arg = arg;
+  task->_periodTick = periodTick;
+  task->_deadlineTick = fSchedulerSampleTick(me) + periodTick;
+  task->_runQty = 0U;
+  task->_latenessTick = 0U;
+  task->_maxLatenessTick = 0U;
+  task->_jitterTick = 0U;
+  task->_maxJitterTick = 0U;
+  task->_overrunPolicy = eCHRONO_OVERRUN_SKIP;
+  task->_missedQty = 0U;
+  task->_histogram = NULL;
+  task->_histogramBinQty = 0U;
+  task->_histogramBinTick = 0U;
+  task->_scheduled = TRUE;
+
+  me->_taskQty++;
+  fHeapPlace(me, task, me->_taskQty - 1U);
+  fHeapSiftUp(me, task->_heapIndex);
+
+  return CHRONO_SCHEDULER_OK;
+}
+
+/**
+ * @brief Puts a task at a position of the heap.
+ *
+ * @param me Pointer to the scheduler object
+ * @param task Pointer to the task object
+ * @param index Position in the heap
+ */
+static void fHeapPlace(sChronoScheduler * const me, sChronoTask * const task, uint16_t index) {
+
+  me->_heap[index] = task;
+  task->_heapIndex = index;
+}
+
+/**
+ * @brief Moves a task toward the root of the heap while its deadline is earlier than its parent's.
+ *
+ * @param me Pointer to the scheduler object
+ * @param index Position of the task in the heap
+ */
+static void fHeapSiftUp(sChronoScheduler * const me, uint16_t index) {
+
+  sChronoTask *task = me->_heap[index];
+
+  while(index > 0U) {
+
+    uint16_t parent = HEAP_PARENT_(index);
+
+    if(me->_heap[parent]->_deadlineTick <= task->_deadlineTick) {
+      break;
+    }
+
+    fHeapPlace(me, me->_heap[parent], index);
+    index = parent;
+  }
+
+  fHeapPlace(me, task, index);
+}
+
+/**
+ * @brief Moves a task toward the leaves of the heap while a child has an earlier deadline.
+ *
+ * @param me Pointer to the scheduler object
+ * @param index Position of the task in the heap
+ */
+static void fHeapSiftDown(sChronoScheduler * const me, uint16_t index) {
+
+  sChronoTask *task = me->_heap[index];
+
+  while(HEAP_CHILD_((uint32_t)index) < me->_taskQty) {
+
+    uint16_t child = (uint16_t)HEAP_CHILD_((uint32_t)index);
+
+    if(((child + 1U) < me->_taskQty) && (me->_heap[child + 1U]->_deadlineTick < me->_heap[child]->_deadlineTick)) {
+      child++;
+    }
+
+    if(task->_deadlineTick <= me->_heap[child]->_deadlineTick) {
+      break;
+    }
+
+    fHeapPlace(me, me->_heap[child], index);
+    index = child;
+  }
+
+  fHeapPlace(me, task, index);
+}
+
+/**
+ * @brief Converts a number of ticks to microseconds.
+ *
+ * @note The result saturates at UINT32_MAX.
+ *
+ * @param tick Number of ticks
+ * @retval timeUs: Time length (microseconds)
+ */
+static uint32_t fTickToUs(uint64_t tick) {
+
+  uint64_t coef = (uint64_t)fChrono_GetTickToNsCoef();
+
+  if((coef != 0U) && (tick > (((uint64_t)UINT32_MAX * 1000U) / coef))) {
+    return UINT32_MAX; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  return (uint32_t)((tick * coef) / 1000U);
+}
+
+/************************ Copyright (c) 2024 FaraabinCo *****END OF FILE****/
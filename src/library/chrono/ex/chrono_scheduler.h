@@ -0,0 +1,219 @@
+/**
+  ******************************************************************************
+  * @file           : chrono_scheduler.h
+  * @brief          : ChronoScheduler module header file.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 FaraabinCo.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  *
+  * https://faraabinco.ir/
+  * https://github.com/FaraabinCo
+  *
+  ******************************************************************************
+  @verbatim
+
+  For more information on how to use this module, please refer to the implementation
+  of the module in chrono_scheduler.c file.
+
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef CHRONO_SCHEDULER_H
+#define CHRONO_SCHEDULER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "chrono.h"
+
+/* Exported defines ----------------------------------------------------------*/
+#define CHRONO_SCHEDULER_OK                   (0U)
+#define CHRONO_SCHEDULER_ERROR_NULL_PTR       (1U)
+#define CHRONO_SCHEDULER_ERROR_NOT_INIT       (2U)
+#define CHRONO_SCHEDULER_ERROR_PERIOD_ZERO    (3U)
+#define CHRONO_SCHEDULER_ERROR_FULL           (4U)
+#define CHRONO_SCHEDULER_ERROR_NOT_SCHEDULED  (5U)
+#define CHRONO_SCHEDULER_ERROR_INVALID_PARAM  (6U)
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief Definition of what the scheduler does when a task misses one or more of its periods.
+  *
+  */
+typedef enum {
+
+  eCHRONO_OVERRUN_SKIP = 0,     /*!< The task runs once and the missed periods are skipped. The deadlines stay on the original period grid. */
+  eCHRONO_OVERRUN_CATCH_UP,     /*!< The task runs once for every missed period, back to back, until it catches up with the period grid. */
+  eCHRONO_OVERRUN_RESYNC        /*!< The task runs once and the next deadline is one period after this run. The period grid is shifted. */
+
+} eChronoOverrunPolicy;
+
+/**
+  * @brief Definition of the periodic task object.
+  *
+  * @note Users of the scheduler need to create a variable of type sChronoTask for each periodic task.
+  *
+  */
+typedef struct {
+
+  void(*_fpRun)(void *arg);   /*!< Function that is called on every period of the task.
+                                   This parameter is private and is set by the chronoScheduler API. Users must not change its value. */
+
+  void *_arg;                 /*!< Argument that is passed to _fpRun.
+                                   This parameter is private and is set by the chronoScheduler API. Users must not change its value. */
+
+  uint64_t _periodTick;       /*!< Holds the period of the task in ticks.
+                                   This parameter is private and is set by the chronoScheduler API. Users must not change its value. */
+
+  uint64_t _deadlineTick;     /*!< Holds the next deadline of the task on the time base of the scheduler.
+                                   This parameter is private and is set by the chronoScheduler API. Users must not change its value. */
+
+  uint16_t _heapIndex;        /*!< Holds the position of the task in the deadline heap of the scheduler.
+                                   This parameter is private and is set by the chronoScheduler API. Users must not change its value. */
+
+  bool_t _scheduled;          /*!< Holds whether the task is registered in a scheduler.
+                                   This parameter is private and is set by the chronoScheduler API. Users must not change its value. */
+
+  uint32_t _runQty;           /*!< Holds the number of times the task has run.
+                                   This parameter is private and is set by the chronoScheduler API. Users must not change its value. */
+
+  tick_t _latenessTick;       /*!< Holds the delay of the last run after its deadline in ticks.
+                                   This parameter is private and is set by the chronoScheduler API. Users must not change its value. */
+
+  tick_t _maxLatenessTick;    /*!< Holds the maximum lateness since the task was added.
+                                   This parameter is private and is set by the chronoScheduler API. Users must not change its value. */
+
+  tick_t _jitterTick;         /*!< Holds the difference between the lateness of the last two runs in ticks.
+                                   This parameter is private and is set by the chronoScheduler API. Users must not change its value. */
+
+  tick_t _maxJitterTick;      /*!< Holds the maximum jitter since the task was added.
+                                   This parameter is private and is set by the chronoScheduler API. Users must not change its value. */
+
+  eChronoOverrunPolicy _overrunPolicy; /*!< Holds what the scheduler does when the task misses its periods.
+                                            This parameter is private and is set by the chronoScheduler API. Users must not change its value. */
+
+  uint32_t _missedQty;        /*!< Holds the number of periods that the task missed since it was added.
+                                   This parameter is private and is set by the chronoScheduler API. Users must not change its value. */
+
+  uint32_t *_histogram;       /*!< Holds the bins of the lateness histogram of the task. It is NULL if the histogram is disabled.
+                                   This parameter is private and is set by the chronoScheduler API. Users must not change its value. */
+
+  uint16_t _histogramBinQty;  /*!< Holds the number of bins of the lateness histogram.
+                                   This parameter is private and is set by the chronoScheduler API. Users must not change its value. */
+
+  tick_t _histogramBinTick;   /*!< Holds the width of each bin of the lateness histogram in ticks.
+                                   This parameter is private and is set by the chronoScheduler API. Users must not change its value. */
+
+}sChronoTask;
+
+/**
+  * @brief Definition of the scheduler object.
+  *
+  * @note The scheduler keeps its tasks in a binary min-heap ordered by deadline. The heap is an array of task pointers
+  *       provided by the user in fChronoScheduler_Init().
+  *
+  */
+typedef struct {
+
+  bool_t _init;               /*!< Holds the INIT state of the scheduler.
+                                   This parameter is private and is set by the chronoScheduler API. Users must not change its value. */
+
+  sChronoTask **_heap;        /*!< Holds the deadline heap of the scheduler.
+                                   This parameter is private and is set by the chronoScheduler API. Users must not change its value. */
+
+  uint16_t _capacity;         /*!< Holds the number of task pointers in the heap.
+                                   This parameter is private and is set by the chronoScheduler API. Users must not change its value. */
+
+  uint16_t _taskQty;          /*!< Holds the number of scheduled tasks.
+                                   This parameter is private and is set by the chronoScheduler API. Users must not change its value. */
+
+  uint64_t _nowTick;          /*!< Holds the time base of the scheduler in ticks, sampled once per call to fChronoScheduler_Run().
+                                   This parameter is private and is set by the chronoScheduler API. Users must not change its value. */
+
+  tick_t _lastTick;           /*!< Holds the tick of the last time base sample.
+                                   This parameter is private and is set by the chronoScheduler API. Users must not change its value. */
+
+}sChronoScheduler;
+
+/* Exported constants --------------------------------------------------------*/
+/* Exported functions prototypes ---------------------------------------------*/
+/** @defgroup OBJECTIVE_API Objective API in the chrono_scheduler module
+ *  @brief These functions require an object of type sChronoScheduler. Users must declare one to use this API.
+ *  @{
+ */
+
+/** @defgroup SCHEDULER_CMD
+ *  @ingroup OBJECTIVE_API
+ *  @brief These functions are used to initialize the scheduler, to add and remove its periodic tasks and to configure them.
+ *  @{
+ */
+
+uint8_t fChronoScheduler_Init(sChronoScheduler * const me, sChronoTask **heap, uint16_t capacity);
+uint8_t fChronoScheduler_AddTaskUs(sChronoScheduler * const me, sChronoTask * const task, void(*fpRun)(void *arg), void *arg, uint32_t periodUs);
+uint8_t fChronoScheduler_AddTaskMs(sChronoScheduler * const me, sChronoTask * const task, void(*fpRun)(void *arg), void *arg, uint32_t periodMs);
+uint8_t fChronoScheduler_RemoveTask(sChronoScheduler * const me, sChronoTask * const task);
+uint8_t fChronoScheduler_SetTaskOverrunPolicy(sChronoTask * const task, eChronoOverrunPolicy policy);
+uint8_t fChronoScheduler_SetTaskHistogram(sChronoTask * const task, uint32_t *bins, uint16_t binQty, uint32_t binWidthUs);
+
+/** @} */ //End of SCHEDULER_CMD
+
+/** @defgroup SCHEDULER_RUN
+ *  @ingroup OBJECTIVE_API
+ *  @brief This function samples the tick once and runs the tasks that are due in deadline order.
+ *  @{
+ */
+
+uint16_t fChronoScheduler_Run(sChronoScheduler * const me);
+
+/** @} */ //End of SCHEDULER_RUN
+
+/** @defgroup SCHEDULER_IDLE
+ *  @ingroup OBJECTIVE_API
+ *  @brief This function returns the time until the earliest deadline, so that the MCU can sleep until then.
+ *  @{
+ */
+
+uint32_t fChronoScheduler_NextDeadlineUs(sChronoScheduler * const me);
+
+/** @} */ //End of SCHEDULER_IDLE
+
+/** @defgroup TASK_TIMING
+ *  @ingroup OBJECTIVE_API
+ *  @brief These functions return the lateness, jitter and missed periods of a periodic task.
+ *  @{
+ */
+
+uint32_t fChronoScheduler_GetTaskRunQty(sChronoTask const * const task);
+uint32_t fChronoScheduler_GetTaskLatenessUs(sChronoTask const * const task);
+uint32_t fChronoScheduler_GetTaskMaxLatenessUs(sChronoTask const * const task);
+uint32_t fChronoScheduler_GetTaskJitterUs(sChronoTask const * const task);
+uint32_t fChronoScheduler_GetTaskMaxJitterUs(sChronoTask const * const task);
+uint32_t fChronoScheduler_GetTaskMissedQty(sChronoTask const * const task);
+
+/** @} */ //End of TASK_TIMING
+
+/** @} */ //End of OBJECTIVE_API
+
+/* Exported variables --------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHRONO_SCHEDULER_H */
+
+/************************ Copyright (c) 2024 FaraabinCo *****END OF FILE****/
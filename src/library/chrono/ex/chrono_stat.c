@@ -0,0 +1,263 @@
+/**
+  ******************************************************************************
+  * @file           : chrono_stat.c
+  * @brief          : ChronoStat module.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 FaraabinCo.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  *
+  * https://faraabinco.ir/
+  * https://github.com/FaraabinCo
+  *
+  ******************************************************************************
+  @verbatim
+
+  The chronoStat module collects statistics of time samples, e.g. the intervals between the runs of a periodic function
+  or its execution times. fChrono_IntervalUs() and fChrono_ElapsedUs() only return the last value, while an sChronoStat
+  object keeps:
+  - The number of samples, their minimum and their maximum.
+  - Their mean and variance, updated online with Welford's algorithm.
+  - A histogram with log2 bins: bin 0 counts the samples equal to 0 us, and bin i counts the samples in [2^(i-1), 2^i) us.
+    The last bin also counts all the larger samples. The number of bins is CHRONO_STAT_BIN_QTY.
+
+  Each sample is added in constant time with integer arithmetic only. The mean is kept with 8 fractional bits and the
+  remainder of its division by the number of samples is carried to the next sample, so the mean does not drift or stall
+  in long runs.
+
+  The results are public fields of sChronoStat, so they can be watched directly. With Faraabin, the chrono_stat add-on
+  introduces sChronoStat as a variable type, and the host can plot the histogram instead of the last value.
+
+  @code
+  #include "chrono_stat.h"
+
+  static sChrono intervalChrono;
+  static sChrono executionChrono;
+  static sChronoStat intervalStat;
+  static sChronoStat executionStat;
+
+  void ControlRun(void) {
+
+    fChronoStat_IntervalUs(&intervalStat, &intervalChrono);
+    fChrono_Start(&executionChrono);
+
+    // Control algorithm
+
+    fChronoStat_ElapsedUs(&executionStat, &executionChrono);
+  }
+
+  int main(void) {
+
+    fChrono_Init(tickValue);
+
+    fChronoStat_Reset(&intervalStat);
+    fChronoStat_Reset(&executionStat);
+    fChrono_Start(&intervalChrono);
+
+    while(TRUE) {
+      ControlRun();
+      printf("Interval: %u +- %u us\n", intervalStat.MeanUs, intervalStat.VarianceUs2);
+    }
+  }
+  @endcode
+
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "chrono_stat.h"
+
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/**
+ * @brief Asserts whether the object is null or not.
+ *
+ * @note If the object is null, ASSERT_NOT_NULL_RET_ macro forces the API to return the value specified by "ret"
+ *
+ */
+#define ASSERT_NOT_NULL_RET_(object, ret) if((object) == NULL){return (ret);}
+#define ASSERT_NOT_NULL_(object) if((object) == NULL){return;}
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static uint8_t fStatBitLength(uint32_t value);
+
+/* Variables -----------------------------------------------------------------*/
+
+/*
+╔══════════════════════════════════════════════════════════════════════════════════╗
+║                          ##### Exported Functions #####                          ║
+╚══════════════════════════════════════════════════════════════════════════════════╝
+*/
+
+/** @defgroup OBJECTIVE_API Objective API in the chrono_stat module
+ *  @brief These functions require an object of type sChronoStat. Users must declare one to use this API.
+ *  @{
+ */
+
+/**
+ * @brief Clears all the statistics of the object.
+ *
+ * @param me Pointer to the statistics object
+ */
+void fChronoStat_Reset(sChronoStat * const me) {
+
+  ASSERT_NOT_NULL_(me); /* MISRA 2012 Rule 15.5 deviation */
+
+  me->Count = 0U;
+  me->MinUs = UINT32_MAX;
+  me->MaxUs = 0U;
+  me->MeanUs = 0U;
+  me->VarianceUs2 = 0U;
+  me->_meanQ8 = 0U;
+  me->_meanRemQ8 = 0U;
+  me->_m2Q16 = 0U;
+
+  for(uint8_t i = 0U; i < CHRONO_STAT_BIN_QTY; i++) {
+    me->Histogram[i] = 0U;
+  }
+}
+
+/**
+ * @brief Adds a sample to the statistics.
+ *
+ * @note When Count reaches UINT32_MAX, new samples are ignored until the object is reset.
+ *
+ * @param me Pointer to the statistics object
+ * @param sampleUs Sample (microseconds)
+ */
+void fChronoStat_AddSampleUs(sChronoStat * const me, uint32_t sampleUs) {
+
+  ASSERT_NOT_NULL_(me); /* MISRA 2012 Rule 15.5 deviation */
+
+  if(me->Count == UINT32_MAX) {
+    return; /* MISRA 2012 Rule 15.5 deviation */
+  }
+
+  me->Count++;
+
+  if(sampleUs < me->MinUs) {
+    me->MinUs = sampleUs;
+  }
+  if(sampleUs > me->MaxUs) {
+    me->MaxUs = sampleUs;
+  }
+
+  uint8_t bin = fStatBitLength(sampleUs);
+  me->Histogram[(bin < CHRONO_STAT_BIN_QTY) ? bin : (CHRONO_STAT_BIN_QTY - 1U)]++;
+
+  /* Welford's algorithm in fixed point. delta and delta2 have the same sign, so their product is not negative.
+     The exact mean is _meanQ8 + _meanRemQ8 / Count. Carrying the remainder keeps the mean moving when |delta| is
+     smaller than Count, e.g. after a step change in a long run. */
+  uint64_t sampleQ8 = (uint64_t)((sampleUs < CHRONO_STAT_SAMPLE_MAX_US) ? sampleUs : CHRONO_STAT_SAMPLE_MAX_US) << 8;
+  int64_t delta = (int64_t)sampleQ8 - (int64_t)me->_meanQ8;
+  int64_t numerator = (int64_t)me->_meanRemQ8 + delta;
+  int64_t step = numerator / (int64_t)me->Count;
+  int64_t remainder = numerator % (int64_t)me->Count;
+  if(remainder < 0) {
+    remainder += (int64_t)me->Count;
+    step--;
+  }
+  me->_meanQ8 = (uint64_t)((int64_t)me->_meanQ8 + step);
+  me->_meanRemQ8 = (uint32_t)remainder;
+  int64_t delta2 = (int64_t)sampleQ8 - (int64_t)me->_meanQ8;
+  uint64_t product = (uint64_t)(delta * delta2);
+
+  me->_m2Q16 = ((UINT64_MAX - me->_m2Q16) > product) ? (me->_m2Q16 + product) : UINT64_MAX;
+
+  me->MeanUs = (uint32_t)((me->_meanQ8 + 128U) >> 8);
+
+  if(me->Count > 1U) {
+    uint64_t variance = (me->_m2Q16 / (uint64_t)(me->Count - 1U)) >> 16;
+    me->VarianceUs2 = (variance > (uint64_t)UINT32_MAX) ? UINT32_MAX : (uint32_t)variance;
+  }
+}
+
+/**
+ * @brief Measures the interval since the last call with fChrono_IntervalUs() and adds it as a sample.
+ *
+ * @note Refer to fChrono_IntervalUs() for more information. The chrono object must be started first.
+ *
+ * @param me Pointer to the statistics object
+ * @param chrono Pointer to the chrono object
+ * @retval interval: Time interval (microseconds)
+ */
+timeUs_t fChronoStat_IntervalUs(sChronoStat * const me, sChrono * const chrono) {
+
+  timeUs_t interval = fChrono_IntervalUs(chrono);
+
+  fChronoStat_AddSampleUs(me, (uint32_t)interval);
+
+  return interval;
+}
+
+/**
+ * @brief Measures the elapsed time of the chrono object with fChrono_ElapsedUs() and adds it as a sample.
+ *
+ * @note A practical use case is measuring execution times. Start the chrono object at the start of the code
+ *       and call this function at its end.
+ *
+ * @param me Pointer to the statistics object
+ * @param chrono Pointer to the chrono object
+ * @retval elapsed: Elapsed time (microseconds)
+ */
+timeUs_t fChronoStat_ElapsedUs(sChronoStat * const me, sChrono const * const chrono) {
+
+  timeUs_t elapsed = fChrono_ElapsedUs(chrono);
+
+  fChronoStat_AddSampleUs(me, (uint32_t)elapsed);
+
+  return elapsed;
+}
+
+/** @} */ //End of OBJECTIVE_API
+
+/*
+╔══════════════════════════════════════════════════════════════════════════════════╗
+║                            ##### Private Functions #####                         ║
+╚══════════════════════════════════════════════════════════════════════════════════╝
+*/
+
+/**
+ * @brief Returns the number of bits that are needed to represent a value, i.e. floor(log2(value)) + 1, and 0 for 0.
+ *
+ * @note It is a binary search of five fixed steps, so it takes the same time for every value.
+ *
+ * @param value Value
+ * @retval bitLength: Number of bits of the value
+ */
+static uint8_t fStatBitLength(uint32_t value) {
+
+  uint8_t bitLength = 0U;
+
+  if(value >= 0x10000U) {
+    value >>= 16;
+    bitLength += 16U;
+  }
+  if(value >= 0x100U) {
+    value >>= 8;
+    bitLength += 8U;
+  }
+  if(value >= 0x10U) {
+    value >>= 4;
+    bitLength += 4U;
+  }
+  if(value >= 0x4U) {
+    value >>= 2;
+    bitLength += 2U;
+  }
+  if(value >= 0x2U) {
+    value >>= 1;
+    bitLength += 1U;
+  }
+
+  return (uint8_t)(bitLength + (uint8_t)value);
+}
+
+/************************ Copyright (c) 2024 FaraabinCo *****END OF FILE****/
@@ -0,0 +1,141 @@
+/**
+  ******************************************************************************
+  * @file           : chrono_stat.h
+  * @brief          : ChronoStat module header file.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 FaraabinCo.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  *
+  * https://faraabinco.ir/
+  * https://github.com/FaraabinCo
+  *
+  ******************************************************************************
+  @verbatim
+
+  For more information on how to use this module, please refer to the implementation
+  of the module in chrono_stat.c file.
+
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef CHRONO_STAT_H
+#define CHRONO_STAT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "chrono.h"
+
+/* Exported defines ----------------------------------------------------------*/
+/**
+ * @brief Number of bins of the log2 histogram. It can be overridden in chrono_config.h.
+ *
+ * @note Bin 0 counts the samples equal to 0 us and bin i counts the samples in [2^(i-1), 2^i) us.
+ *       The last bin also counts all the larger samples.
+ *
+ */
+#ifndef CHRONO_STAT_BIN_QTY
+#define CHRONO_STAT_BIN_QTY (16U)
+#endif
+
+/**
+ * @brief Largest sample that is used for the mean and the variance. Larger samples are clamped to this value.
+ *
+ * @note It keeps the products of the integer Welford algorithm within 64 bits. Minimum, maximum and histogram use
+ *       the samples as they are.
+ *
+ */
+#define CHRONO_STAT_SAMPLE_MAX_US (0x007FFFFFU)
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief Definition of the statistics object.
+  *
+  * @note The public fields are updated on every sample, so they can be read directly, e.g. by a debugger or Faraabin.
+  *
+  */
+typedef struct {
+
+  uint32_t Count;                           /*!< Holds the number of samples since the last reset.
+                                                 This parameter is set by the chronoStat API. Users must not change its value. */
+
+  uint32_t MinUs;                           /*!< Holds the minimum sample in microseconds.
+                                                 This parameter is set by the chronoStat API. Users must not change its value. */
+
+  uint32_t MaxUs;                           /*!< Holds the maximum sample in microseconds.
+                                                 This parameter is set by the chronoStat API. Users must not change its value. */
+
+  uint32_t MeanUs;                          /*!< Holds the mean of the samples in microseconds.
+                                                 This parameter is set by the chronoStat API. Users must not change its value. */
+
+  uint32_t VarianceUs2;                     /*!< Holds the sample variance in square microseconds. It saturates at UINT32_MAX.
+                                                 This parameter is set by the chronoStat API. Users must not change its value. */
+
+  uint32_t Histogram[CHRONO_STAT_BIN_QTY];  /*!< Holds the log2 histogram of the samples.
+                                                 This parameter is set by the chronoStat API. Users must not change its value. */
+
+  uint64_t _meanQ8;                         /*!< Holds the running mean with 8 fractional bits.
+                                                 This parameter is private and is set by the chronoStat API. Users must not change its value. */
+
+  uint32_t _meanRemQ8;                      /*!< Holds the remainder of the running mean, i.e. the exact mean is _meanQ8 + _meanRemQ8 / Count.
+                                                 This parameter is private and is set by the chronoStat API. Users must not change its value. */
+
+  uint64_t _m2Q16;                          /*!< Holds the sum of squared differences from the mean with 16 fractional bits.
+                                                 This parameter is private and is set by the chronoStat API. Users must not change its value. */
+
+}sChronoStat;
+
+/* Exported constants --------------------------------------------------------*/
+/* Exported functions prototypes ---------------------------------------------*/
+/** @defgroup OBJECTIVE_API Objective API in the chrono_stat module
+ *  @brief These functions require an object of type sChronoStat. Users must declare one to use this API.
+ *  @{
+ */
+
+/** @defgroup STAT_CMD
+ *  @ingroup OBJECTIVE_API
+ *  @brief These functions are used to reset the statistics and to add samples.
+ *  @{
+ */
+
+void fChronoStat_Reset(sChronoStat * const me);
+void fChronoStat_AddSampleUs(sChronoStat * const me, uint32_t sampleUs);
+
+/** @} */ //End of STAT_CMD
+
+/** @defgroup STAT_CHRONO
+ *  @ingroup OBJECTIVE_API
+ *  @brief These functions measure a time with a chrono object and add it as a sample.
+ *  @{
+ */
+
+timeUs_t fChronoStat_IntervalUs(sChronoStat * const me, sChrono * const chrono);
+timeUs_t fChronoStat_ElapsedUs(sChronoStat * const me, sChrono const * const chrono);
+
+/** @} */ //End of STAT_CHRONO
+
+/** @} */ //End of OBJECTIVE_API
+
+/* Exported variables --------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHRONO_STAT_H */
+
+/************************ Copyright (c) 2024 FaraabinCo *****END OF FILE****/
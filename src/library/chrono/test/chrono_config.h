@@ -37,6 +37,11 @@ extern "C" {
 #define TEST_GROUP_8  (8U)
 #define TEST_GROUP_9  (9U)
 #define TEST_GROUP_10 (10U)
+#define TEST_GROUP_11 (11U)
+#define TEST_GROUP_12 (12U)
+#define TEST_GROUP_13 (13U)
+#define TEST_GROUP_14 (14U)
+#define TEST_GROUP_15 (15U)
 
 #define CHRONO_TESTS_DISABLED (0U)
 #define CHRONO_TESTS_ENABLED  (1U)
@@ -192,6 +197,152 @@ typedef uint32_t timeUs_t;
 /** @} */ //End of TEST_GROUP_8_CONFIG
 #endif
 
+#if(CHRONO_TEST_GROUP == TEST_GROUP_9)
+/** @defgroup TEST_GROUP_9_CONFIG
+ *  @{
+ */
+
+#define CHRONO_TICK_TYPE                TICK_TYPE_VARIABLE
+#define CHRONO_TICK_TOP_VALUE           (0xFFFFFFFFU)
+#define CHRONO_TICK_TO_NANOSECOND_COEF  (7U)
+#define CHRONO_TICK_COUNTERMODE         TICK_COUNTERMODE_UP
+
+typedef uint32_t tick_t;
+typedef uint32_t timeS_t;
+typedef uint32_t timeMs_t;
+typedef uint32_t timeUs_t;
+
+/** @} */ //End of TEST_GROUP_9_CONFIG
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_10)
+/** @defgroup TEST_GROUP_10_CONFIG
+ *  @{
+ */
+
+#define CHRONO_TICK_TYPE                TICK_TYPE_FUNCTION
+#define CHRONO_TICK_TOP_VALUE           (1000U)
+#define CHRONO_TICK_TO_NANOSECOND_COEF  (1000U)
+#define CHRONO_TICK_COUNTERMODE         TICK_COUNTERMODE_DOWN
+#define CHRONO_TICK_EXTENSION           TICK_EXTENSION_ENABLED
+
+typedef uint32_t tick_t;
+typedef uint32_t timeS_t;
+typedef uint32_t timeMs_t;
+typedef uint32_t timeUs_t;
+
+/** @} */ //End of TEST_GROUP_10_CONFIG
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_11)
+/** @defgroup TEST_GROUP_11_CONFIG
+ *  @{
+ */
+
+#define CHRONO_TICK_TYPE                TICK_TYPE_VARIABLE
+#define CHRONO_TICK_TOP_VALUE           (0xFFFFFFFFU)
+#define CHRONO_TICK_TO_NANOSECOND_COEF  (1000U)
+#define CHRONO_TICK_COUNTERMODE         TICK_COUNTERMODE_UP
+
+typedef uint32_t tick_t;
+typedef uint32_t timeS_t;
+typedef uint32_t timeMs_t;
+typedef uint32_t timeUs_t;
+
+/** @} */ //End of TEST_GROUP_11_CONFIG
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_12)
+/** @defgroup TEST_GROUP_12_CONFIG
+ *  @{
+ */
+
+#define CHRONO_TICK_TYPE                TICK_TYPE_FUNCTION
+#define CHRONO_TICK_TOP_VALUE           (0xFFFFFFFFU)
+#define CHRONO_TICK_TO_NANOSECOND_COEF  (250U)
+#define CHRONO_TICK_COUNTERMODE         TICK_COUNTERMODE_UP
+#define CHRONO_INLINE                   INLINE_ENABLED
+#define CHRONO_INLINE_ASSERT            INLINE_ASSERT_DISABLED
+#define CHRONO_INLINE_TICK_()           (inlineTickVal)
+
+typedef uint32_t tick_t;
+typedef uint32_t timeS_t;
+typedef uint32_t timeMs_t;
+typedef uint32_t timeUs_t;
+
+extern volatile tick_t inlineTickVal;
+
+/**
+ * @brief Reads the cycle counter of the host for the benchmark of the inline API.
+ * 
+ */
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define CHRONO_TEST_CYCLES_() ((uint64_t)__rdtsc())
+#else
+#include <time.h>
+#define CHRONO_TEST_CYCLES_() ((uint64_t)clock())
+#endif
+
+/** @} */ //End of TEST_GROUP_12_CONFIG
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_13)
+/** @defgroup TEST_GROUP_13_CONFIG
+ *  @{
+ */
+
+#define CHRONO_TICK_TYPE                TICK_TYPE_VARIABLE
+#define CHRONO_TICK_TOP_VALUE           (0xFFFFFFFFU)
+#define CHRONO_TICK_TO_NANOSECOND_COEF  (1000U)
+#define CHRONO_TICK_COUNTERMODE         TICK_COUNTERMODE_UP
+
+typedef uint32_t tick_t;
+typedef uint32_t timeS_t;
+typedef uint32_t timeMs_t;
+typedef uint32_t timeUs_t;
+
+/** @} */ //End of TEST_GROUP_13_CONFIG
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_14)
+/** @defgroup TEST_GROUP_14_CONFIG
+ *  @{
+ */
+
+#define CHRONO_TICK_TYPE                TICK_TYPE_VARIABLE
+#define CHRONO_TICK_TOP_VALUE           (0xFFFFFFFFU)
+#define CHRONO_TICK_TO_NANOSECOND_COEF  (1000U)
+#define CHRONO_TICK_COUNTERMODE         TICK_COUNTERMODE_UP
+#define CHRONO_DOMAIN_QTY               (3U)
+
+typedef uint32_t tick_t;
+typedef uint32_t timeS_t;
+typedef uint32_t timeMs_t;
+typedef uint32_t timeUs_t;
+
+/** @} */ //End of TEST_GROUP_14_CONFIG
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_15)
+/** @defgroup TEST_GROUP_15_CONFIG
+ *  @{
+ */
+
+#define CHRONO_TICK_TYPE                TICK_TYPE_VARIABLE
+#define CHRONO_TICK_TOP_VALUE           (0xFFFFFFFFU)
+#define CHRONO_TICK_TO_NANOSECOND_COEF  (1000U)
+#define CHRONO_TICK_COUNTERMODE         TICK_COUNTERMODE_UP
+#define CHRONO_TICK_EXTENSION           TICK_EXTENSION_ENABLED
+
+typedef uint32_t tick_t;
+typedef uint32_t timeS_t;
+typedef uint32_t timeMs_t;
+typedef uint32_t timeUs_t;
+
+/** @} */ //End of TEST_GROUP_15_CONFIG
+#endif
+
 #ifdef __cplusplus
 }
 #endif
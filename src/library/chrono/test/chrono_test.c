@@ -22,7 +22,10 @@
 #include "chrono_config.h"
 
 #include "..\chrono.h"
+#include "..\chrono_inline.h"
 #include "..\ex\chrono_long.h"
+#include "..\ex\chrono_scheduler.h"
+#include "..\ex\chrono_stat.h"
 
 #include "unity_fixture.h"
 
@@ -33,7 +36,11 @@
 /* Private typedef -----------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 static volatile uint32_t tickVal;
+#if (CHRONO_TICK_TYPE == TICK_TYPE_VARIABLE)
 static volatile tick_t *pTick;
+#elif (CHRONO_TICK_TYPE == TICK_TYPE_FUNCTION)
+static fpTick_t pTick;
+#endif
 
 /* Private function prototypes -----------------------------------------------*/
 static void RunTests(void);
@@ -1941,52 +1948,1412 @@ TEST_GROUP_RUNNER(GROUP_8) {
 /** @} */ //End of TEST_GROUP_8
 #endif
 
-/*
-╔══════════════════════════════════════════════════════════════════════════════════╗
-║                            ##### Private Functions #####                         ║
-╚══════════════════════════════════════════════════════════════════════════════════╝
-*/
+#if(CHRONO_TEST_GROUP == TEST_GROUP_9)
+/** @defgroup TEST_GROUP_9
+ *  @{
+ */
 
 /**
- * @brief Run all tests in test group.
+ * @brief Test group object.
  * 
  */
-static void RunTests(void) {
+TEST_GROUP(GROUP_9);
+
+/**
+ * @brief Unit test setup.
+ * 
+ */
+TEST_SETUP(GROUP_9) {
   
-#if(CHRONO_TEST_STATUS == CHRONO_TESTS_DISABLED)
-  (void)(RunTests);
-#endif
+}
 
-#if(CHRONO_TEST_GROUP == TEST_GROUP_1)
-  RUN_TEST_GROUP(GROUP_1);
-#endif
+/**
+ * @brief Unit test teardown.
+ * 
+ */
+TEST_TEAR_DOWN(GROUP_9) {
 
-#if(CHRONO_TEST_GROUP == TEST_GROUP_2)
-  RUN_TEST_GROUP(GROUP_2);
-#endif
+}
 
-#if(CHRONO_TEST_GROUP == TEST_GROUP_3)
-  RUN_TEST_GROUP(GROUP_3);
-#endif
+/**
+ * @brief Tick conversions must be bit-exact with division for every tick value.
+ * 
+ * @note Tick-to-ns coefficient 7 gives odd divisors (142, 142857 and 142857142) that exercise the multiply-shift path.
+ * 
+ */
+TEST(GROUP_9, Chrono_TimeSpanIsCalledForAllTickValues_ReturnsExactQuotient) {
+  
+  uint32_t mismatchUs = 0U;
+  uint32_t mismatchMs = 0U;
+  uint32_t mismatchS = 0U;
+  uint32_t tick = 0U;
+  
+  fChrono_Init(&tickVal);
+  
+  do {
+    
+    if(fChrono_TimeSpanUs(0U, tick) != (tick / (1000U / CHRONO_TICK_TO_NANOSECOND_COEF))) {
+      mismatchUs++;
+    }
+    
+    if(fChrono_TimeSpanMs(0U, tick) != (tick / (1000000U / CHRONO_TICK_TO_NANOSECOND_COEF))) {
+      mismatchMs++;
+    }
+    
+    if(fChrono_TimeSpanS(0U, tick) != (tick / (1000000000U / CHRONO_TICK_TO_NANOSECOND_COEF))) {
+      mismatchS++;
+    }
+    
+    tick++;
+  } while(tick != 0U);
+  
+  TEST_ASSERT_EQUAL_UINT32(0U, mismatchUs);
+  TEST_ASSERT_EQUAL_UINT32(0U, mismatchMs);
+  TEST_ASSERT_EQUAL_UINT32(0U, mismatchS);
+}
 
-#if(CHRONO_TEST_GROUP == TEST_GROUP_4)
-  RUN_TEST_GROUP(GROUP_4);
-#endif
+/**
+ * @brief Max measurable times use the same conversion.
+ * 
+ */
+TEST(GROUP_9, Chrono_GetMaxMeasurableTimeIsCalled_ReturnsExactQuotient) {
+  
+  fChrono_Init(&tickVal);
+  
+  TEST_ASSERT_EQUAL_UINT32(0xFFFFFFFFU / 142U, fChrono_GetMaxMeasurableTimeUs());
+  TEST_ASSERT_EQUAL_UINT32(0xFFFFFFFFU / 142857U, fChrono_GetMaxMeasurableTimeMs());
+  TEST_ASSERT_EQUAL_UINT32(0xFFFFFFFFU / 142857142U, fChrono_GetMaxMeasurableTimeS());
+}
 
-#if(CHRONO_TEST_GROUP == TEST_GROUP_5)
-  RUN_TEST_GROUP(GROUP_5);
-#endif
+/**
+ * @brief Test group runner.
+ * 
+ */
+TEST_GROUP_RUNNER(GROUP_9) {
 
-#if(CHRONO_TEST_GROUP == TEST_GROUP_6)
-  RUN_TEST_GROUP(GROUP_6);
+  RUN_TEST_CASE(GROUP_9, Chrono_TimeSpanIsCalledForAllTickValues_ReturnsExactQuotient);
+  RUN_TEST_CASE(GROUP_9, Chrono_GetMaxMeasurableTimeIsCalled_ReturnsExactQuotient);
+
+}
+
+/** @} */ //End of TEST_GROUP_9
 #endif
 
-#if(CHRONO_TEST_GROUP == TEST_GROUP_7)
-  RUN_TEST_GROUP(GROUP_7);
+#if(CHRONO_TEST_GROUP == TEST_GROUP_10)
+/** @defgroup TEST_GROUP_10
+ *  @{
+ */
+
+/**
+ * @brief Fake SysTick-like tick generator. It down counts from CHRONO_TICK_TOP_VALUE - 1 to zero and every read
+ *        advances it by fakeStep ticks. fakeNow is the true number of ticks since fChrono_Init().
+ * 
+ */
+static uint64_t fakeNow;
+static uint32_t fakeStep;
+static uint64_t fakeHandledOverflows;
+static bool_t fakeIsrMasked;
+
+/**
+ * @brief Runs the fake overflow interrupt for every overflow that is not handled yet.
+ * 
+ */
+static void fFakeOverflowIsr(void) {
+  
+  while(fakeHandledOverflows < (fakeNow / CHRONO_TICK_TOP_VALUE)) {
+    fakeHandledOverflows++;
+    fChrono_TickOverflowHandler();
+  }
+}
+
+/**
+ * @brief Returns the pending state of the fake overflow interrupt.
+ * 
+ */
+static bool_t fFakeIsOverflowPending(void) {
+  
+  return (fakeHandledOverflows < (fakeNow / CHRONO_TICK_TOP_VALUE));
+}
+
+/**
+ * @brief Reads the fake counter. If the interrupt is not masked, the overflow interrupt preempts right after the read.
+ * 
+ */
+static tick_t fFakeTick(void) {
+  
+  fakeNow += fakeStep;
+  
+  tick_t tick = (tick_t)((CHRONO_TICK_TOP_VALUE - 1U) - (uint32_t)(fakeNow % CHRONO_TICK_TOP_VALUE));
+  
+  if(!fakeIsrMasked) {
+    fFakeOverflowIsr();
+  }
+  
+  return tick;
+}
+
+/**
+ * @brief Test group object.
+ * 
+ */
+TEST_GROUP(GROUP_10);
+
+/**
+ * @brief Unit test setup.
+ * 
+ */
+TEST_SETUP(GROUP_10) {
+  
+  fakeNow = 0U;
+  fakeStep = 0U;
+  fakeHandledOverflows = 0U;
+  fakeIsrMasked = FALSE;
+  
+  fChrono_SetTickOverflowPendingCallback(NULL);
+  fChrono_Init(fFakeTick);
+  
+  fakeStep = 1U;
+}
+
+/**
+ * @brief Unit test teardown.
+ * 
+ */
+TEST_TEAR_DOWN(GROUP_10) {
+  
+  fChrono_SetTickOverflowPendingCallback(NULL);
+}
+
+/**
+ * @brief The 64-bit tick must follow the true tick across many overflows, including overflows between the reads of
+ *        the epoch and the counter.
+ * 
+ * @note A read of the counter never takes more than half an overflow period.
+ * 
+ */
+TEST(GROUP_10, Chrono_GetTick64IsCalledAcrossOverflows_ReturnsTrueTick) {
+  
+  uint32_t mismatch = 0U;
+  
+  for(uint32_t step = 1U; step < (CHRONO_TICK_TOP_VALUE / 2U); step += 37U) {
+    
+    fakeStep = step;
+    
+    for(uint32_t i = 0U; i < 1000U; i++) {
+      if(fChrono_GetTick64() != fakeNow) {
+        mismatch++;
+      }
+    }
+  }
+  
+  TEST_ASSERT_EQUAL_UINT32(0U, mismatch);
+  TEST_ASSERT_GREATER_THAN_UINT32(CHRONO_TICK_TOP_VALUE, (uint32_t)fakeHandledOverflows);
+}
+
+/**
+ * @brief While the overflow interrupt is held pending, the pending callback must keep the 64-bit tick exact.
+ * 
+ */
+TEST(GROUP_10, Chrono_GetTick64IsCalledWhileOverflowIsPending_ReturnsTrueTick) {
+  
+  uint32_t mismatch = 0U;
+  uint32_t pendingReads = 0U;
+  
+  fChrono_SetTickOverflowPendingCallback(fFakeIsOverflowPending);
+  
+  fakeStep = 3U;
+  
+  for(uint32_t i = 0U; i < 100000U; i++) {
+    
+    fakeIsrMasked = ((i % 200U) < 150U);
+    
+    if(fakeIsrMasked && fFakeIsOverflowPending()) {
+      pendingReads++;
+    }
+    
+    if(fChrono_GetTick64() != fakeNow) {
+      mismatch++;
+    }
+  }
+  
+  TEST_ASSERT_EQUAL_UINT32(0U, mismatch);
+  TEST_ASSERT_NOT_EQUAL(0U, pendingReads);
+}
+
+/**
+ * @brief Without the pending callback, a read between the overflow and its interrupt lags one overflow period.
+ * 
+ */
+TEST(GROUP_10, Chrono_GetTick64IsCalledWhileOverflowIsPendingWithoutCallback_LagsOnePeriod) {
+  
+  uint64_t tick64;
+  
+  fakeIsrMasked = TRUE;
+  fakeStep = 600U;
+  
+  tick64 = fChrono_GetTick64();
+  TEST_ASSERT_EQUAL_UINT64(fakeNow, tick64);
+  
+  tick64 = fChrono_GetTick64();
+  TEST_ASSERT_EQUAL_UINT64(fakeNow - CHRONO_TICK_TOP_VALUE, tick64);
+  
+  fChrono_SetTickOverflowPendingCallback(fFakeIsOverflowPending);
+  fakeStep = 1U;
+  
+  tick64 = fChrono_GetTick64();
+  TEST_ASSERT_EQUAL_UINT64(fakeNow, tick64);
+}
+
+/**
+ * @brief Continuous times must stay valid without being read once per overflow.
+ * 
+ */
+TEST(GROUP_10, Chrono_GetContinuousTickIsCalledAfterManyOverflows_ReturnsTrueTime) {
+  
+  fakeStep = 0U;
+  
+  fakeNow = 3723456789ULL;
+  fFakeOverflowIsr();
+  
+  TEST_ASSERT_EQUAL_UINT64(3723456789ULL, fChrono_GetContinuousTickUs());
+  TEST_ASSERT_EQUAL_UINT64(3723456ULL, fChrono_GetContinuousTickMs());
+  TEST_ASSERT_EQUAL_UINT64(3723ULL, fChrono_GetContinuousTickS());
+}
+
+/**
+ * @brief A timeout that is restarted from its deadline must not drift, however late the timeout is checked.
+ * 
+ */
+TEST(GROUP_10, Chrono_RestartTimeoutUsIsCalledOnEveryTimeout_DoesNotDrift) {
+  
+  sChrono testChrono;
+  uint32_t runQty = 0U;
+  
+  fakeStep = 0U;
+  
+  fChrono_StartTimeoutUs(&testChrono, 300U);
+  
+  for(uint32_t i = 0U; i < 100000U; i++) {
+    
+    fakeNow += 7U;
+    
+    if(fChrono_IsTimeout(&testChrono)) {
+      runQty++;
+      fChrono_RestartTimeoutUs(&testChrono, 300U);
+    }
+  }
+  
+  TEST_ASSERT_EQUAL_UINT32((uint32_t)(fakeNow / 300U), runQty);
+}
+
+/**
+ * @brief A timeout that is restarted more than one period late must skip the missed periods and keep its phase.
+ * 
+ */
+TEST(GROUP_10, Chrono_RestartTimeoutUsIsCalledAfterMissedTimeouts_SkipsToNextDeadline) {
+  
+  sChrono testChrono;
+  
+  fakeStep = 0U;
+  
+  fChrono_StartTimeoutUs(&testChrono, 200U);
+  
+  fakeNow = 750U;
+  TEST_ASSERT_EQUAL(TRUE, fChrono_IsTimeout(&testChrono));
+  fChrono_RestartTimeoutUs(&testChrono, 200U);
+  
+  fakeNow = 799U;
+  TEST_ASSERT_EQUAL(FALSE, fChrono_IsTimeout(&testChrono));
+  fakeNow = 800U;
+  TEST_ASSERT_EQUAL(TRUE, fChrono_IsTimeout(&testChrono));
+  fChrono_RestartTimeoutUs(&testChrono, 200U);
+  
+  fakeNow = 999U;
+  TEST_ASSERT_EQUAL(FALSE, fChrono_IsTimeout(&testChrono));
+  fakeNow = 1000U;
+  TEST_ASSERT_EQUAL(TRUE, fChrono_IsTimeout(&testChrono));
+}
+
+/**
+ * @brief Test group runner.
+ * 
+ */
+TEST_GROUP_RUNNER(GROUP_10) {
+
+  RUN_TEST_CASE(GROUP_10, Chrono_GetTick64IsCalledAcrossOverflows_ReturnsTrueTick);
+  RUN_TEST_CASE(GROUP_10, Chrono_GetTick64IsCalledWhileOverflowIsPending_ReturnsTrueTick);
+  RUN_TEST_CASE(GROUP_10, Chrono_GetTick64IsCalledWhileOverflowIsPendingWithoutCallback_LagsOnePeriod);
+  RUN_TEST_CASE(GROUP_10, Chrono_GetContinuousTickIsCalledAfterManyOverflows_ReturnsTrueTime);
+  RUN_TEST_CASE(GROUP_10, Chrono_RestartTimeoutUsIsCalledOnEveryTimeout_DoesNotDrift);
+  RUN_TEST_CASE(GROUP_10, Chrono_RestartTimeoutUsIsCalledAfterMissedTimeouts_SkipsToNextDeadline);
+
+}
+
+/** @} */ //End of TEST_GROUP_10
 #endif
 
-#if(CHRONO_TEST_GROUP == TEST_GROUP_8)
-  RUN_TEST_GROUP(GROUP_8);
+#if(CHRONO_TEST_GROUP == TEST_GROUP_11)
+/** @defgroup TEST_GROUP_11
+ *  @{
+ */
+
+static sChronoScheduler scheduler;
+static sChronoTask *schedulerHeap[16];
+static sChronoTask tasks[16];
+static uint8_t runOrder[16];
+static uint8_t runOrderQty;
+
+/**
+ * @brief Task function that records the id of the task in runOrder.
+ * 
+ */
+static void fRecordTask(void *arg) {
+  
+  if(runOrderQty < ArraySize_(runOrder)) {
+    runOrder[runOrderQty] = *(uint8_t *)arg;
+    runOrderQty++;
+  }
+}
+
+/**
+ * @brief Task function that removes itself from the scheduler.
+ * 
+ */
+static void fRemoveSelfTask(void *arg) {
+  
+  (void)fChronoScheduler_RemoveTask(&scheduler, (sChronoTask *)arg);
+}
+
+/**
+ * @brief Test group object.
+ * 
+ */
+TEST_GROUP(GROUP_11);
+
+/**
+ * @brief Unit test setup.
+ * 
+ */
+TEST_SETUP(GROUP_11) {
+  
+  tickVal = 0U;
+  runOrderQty = 0U;
+  
+  for(uint8_t i = 0U; i < ArraySize_(tasks); i++) {
+    tasks[i]._scheduled = FALSE;
+  }
+  
+  fChrono_Init(&tickVal);
+  fChronoScheduler_Init(&scheduler, schedulerHeap, ArraySize_(schedulerHeap));
+}
+
+/**
+ * @brief Unit test teardown.
+ * 
+ */
+TEST_TEAR_DOWN(GROUP_11) {
+
+}
+
+/**
+ * @brief Due tasks must run once each, in deadline order, and report their lateness.
+ * 
+ */
+TEST(GROUP_11, ChronoScheduler_RunIsCalledAfterSeveralDeadlines_RunsTasksInDeadlineOrder) {
+  
+  static uint8_t ids[] = {0U, 1U, 2U};
+  
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_SCHEDULER_OK, fChronoScheduler_AddTaskUs(&scheduler, &tasks[0], fRecordTask, &ids[0], 300U));
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_SCHEDULER_OK, fChronoScheduler_AddTaskUs(&scheduler, &tasks[1], fRecordTask, &ids[1], 200U));
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_SCHEDULER_OK, fChronoScheduler_AddTaskUs(&scheduler, &tasks[2], fRecordTask, &ids[2], 500U));
+  
+  tickVal = 199U;
+  TEST_ASSERT_EQUAL_UINT16(0U, fChronoScheduler_Run(&scheduler));
+  
+  tickVal = 1000U;
+  TEST_ASSERT_EQUAL_UINT16(3U, fChronoScheduler_Run(&scheduler));
+  TEST_ASSERT_EQUAL_UINT16(0U, fChronoScheduler_Run(&scheduler));
+  
+  TEST_ASSERT_EQUAL_UINT8(3U, runOrderQty);
+  TEST_ASSERT_EQUAL_UINT8(1U, runOrder[0]);
+  TEST_ASSERT_EQUAL_UINT8(0U, runOrder[1]);
+  TEST_ASSERT_EQUAL_UINT8(2U, runOrder[2]);
+  
+  TEST_ASSERT_EQUAL_UINT32(700U, fChronoScheduler_GetTaskLatenessUs(&tasks[0]));
+  TEST_ASSERT_EQUAL_UINT32(800U, fChronoScheduler_GetTaskLatenessUs(&tasks[1]));
+  TEST_ASSERT_EQUAL_UINT32(500U, fChronoScheduler_GetTaskLatenessUs(&tasks[2]));
+}
+
+/**
+ * @brief Deadlines must advance by whole periods, so lateness doesn't accumulate, and jitter is the change of lateness.
+ * 
+ */
+TEST(GROUP_11, ChronoScheduler_RunIsCalledLate_KeepsPhaseAndReportsJitter) {
+  
+  static uint8_t id = 0U;
+  
+  fChronoScheduler_AddTaskUs(&scheduler, &tasks[0], fRecordTask, &id, 100U);
+  
+  for(uint32_t i = 1U; i <= 10U; i++) {
+    tickVal = (i * 100U) + 5U;
+    TEST_ASSERT_EQUAL_UINT16(1U, fChronoScheduler_Run(&scheduler));
+  }
+  
+  TEST_ASSERT_EQUAL_UINT32(10U, fChronoScheduler_GetTaskRunQty(&tasks[0]));
+  TEST_ASSERT_EQUAL_UINT32(5U, fChronoScheduler_GetTaskLatenessUs(&tasks[0]));
+  TEST_ASSERT_EQUAL_UINT32(0U, fChronoScheduler_GetTaskMaxJitterUs(&tasks[0]));
+  
+  tickVal = 1115U;
+  TEST_ASSERT_EQUAL_UINT16(1U, fChronoScheduler_Run(&scheduler));
+  TEST_ASSERT_EQUAL_UINT32(15U, fChronoScheduler_GetTaskLatenessUs(&tasks[0]));
+  TEST_ASSERT_EQUAL_UINT32(10U, fChronoScheduler_GetTaskJitterUs(&tasks[0]));
+  
+  tickVal = 1450U;
+  TEST_ASSERT_EQUAL_UINT16(1U, fChronoScheduler_Run(&scheduler));
+  TEST_ASSERT_EQUAL_UINT32(250U, fChronoScheduler_GetTaskLatenessUs(&tasks[0]));
+  TEST_ASSERT_EQUAL_UINT32(250U, fChronoScheduler_GetTaskMaxLatenessUs(&tasks[0]));
+  TEST_ASSERT_EQUAL_UINT32(235U, fChronoScheduler_GetTaskMaxJitterUs(&tasks[0]));
+  
+  tickVal = 1499U;
+  TEST_ASSERT_EQUAL_UINT16(0U, fChronoScheduler_Run(&scheduler));
+  tickVal = 1500U;
+  TEST_ASSERT_EQUAL_UINT16(1U, fChronoScheduler_Run(&scheduler));
+  TEST_ASSERT_EQUAL_UINT32(0U, fChronoScheduler_GetTaskLatenessUs(&tasks[0]));
+}
+
+/**
+ * @brief Every task of a full scheduler must run once per period, also across a tick overflow.
+ * 
+ */
+TEST(GROUP_11, ChronoScheduler_RunIsCalledEveryTick_RunsEachTaskOncePerPeriod) {
+  
+  static uint8_t ids[16];
+  uint32_t periods[16];
+  
+  tickVal = CHRONO_TICK_TOP_VALUE - 5000U;
+  fChrono_Init(&tickVal);
+  fChronoScheduler_Init(&scheduler, schedulerHeap, ArraySize_(schedulerHeap));
+  
+  for(uint8_t i = 0U; i < ArraySize_(tasks); i++) {
+    ids[i] = i;
+    periods[i] = 7U + (((uint32_t)i * 37U) % 101U);
+    TEST_ASSERT_EQUAL_UINT8(CHRONO_SCHEDULER_OK, fChronoScheduler_AddTaskUs(&scheduler, &tasks[i], fRecordTask, &ids[i], periods[i]));
+  }
+  
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_SCHEDULER_ERROR_FULL, fChronoScheduler_AddTaskUs(&scheduler, &tasks[0], fRecordTask, &ids[0], 1U));
+  
+  for(uint32_t i = 0U; i < 10000U; i++) {
+    tickVal = (tickVal + 1U) % CHRONO_TICK_TOP_VALUE;
+    runOrderQty = 0U;
+    fChronoScheduler_Run(&scheduler);
+  }
+  
+  for(uint8_t i = 0U; i < ArraySize_(tasks); i++) {
+    TEST_ASSERT_EQUAL_UINT32(10000U / periods[i], fChronoScheduler_GetTaskRunQty(&tasks[i]));
+    TEST_ASSERT_EQUAL_UINT32(0U, fChronoScheduler_GetTaskMaxLatenessUs(&tasks[i]));
+  }
+}
+
+/**
+ * @brief Removed tasks must not run, and invalid tasks must be rejected.
+ * 
+ */
+TEST(GROUP_11, ChronoScheduler_RemoveTaskIsCalled_TaskDoesNotRun) {
+  
+  static uint8_t ids[] = {0U, 1U, 2U};
+  
+  fChronoScheduler_AddTaskUs(&scheduler, &tasks[0], fRecordTask, &ids[0], 100U);
+  fChronoScheduler_AddTaskUs(&scheduler, &tasks[1], fRecordTask, &ids[1], 100U);
+  fChronoScheduler_AddTaskUs(&scheduler, &tasks[2], fRemoveSelfTask, &tasks[2], 50U);
+  
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_SCHEDULER_OK, fChronoScheduler_RemoveTask(&scheduler, &tasks[0]));
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_SCHEDULER_ERROR_NOT_SCHEDULED, fChronoScheduler_RemoveTask(&scheduler, &tasks[0]));
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_SCHEDULER_ERROR_PERIOD_ZERO, fChronoScheduler_AddTaskUs(&scheduler, &tasks[3], fRecordTask, &ids[0], 0U));
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_SCHEDULER_ERROR_NULL_PTR, fChronoScheduler_AddTaskUs(&scheduler, &tasks[3], NULL, &ids[0], 100U));
+  
+  tickVal = 1000U;
+  TEST_ASSERT_EQUAL_UINT16(2U, fChronoScheduler_Run(&scheduler));
+  tickVal = 2000U;
+  TEST_ASSERT_EQUAL_UINT16(1U, fChronoScheduler_Run(&scheduler));
+  
+  TEST_ASSERT_EQUAL_UINT8(2U, runOrderQty);
+  TEST_ASSERT_EQUAL_UINT8(1U, runOrder[0]);
+  TEST_ASSERT_EQUAL_UINT8(1U, runOrder[1]);
+  TEST_ASSERT_EQUAL_UINT32(0U, fChronoScheduler_GetTaskRunQty(&tasks[0]));
+  TEST_ASSERT_EQUAL_UINT32(1U, fChronoScheduler_GetTaskRunQty(&tasks[2]));
+}
+
+/**
+ * @brief The next deadline must be the earliest deadline of all tasks, measured from the current tick.
+ * 
+ */
+TEST(GROUP_11, ChronoScheduler_NextDeadlineUsIsCalled_ReturnsTimeUntilEarliestDeadline) {
+  
+  static uint8_t ids[] = {0U, 1U, 2U};
+  
+  TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, fChronoScheduler_NextDeadlineUs(&scheduler));
+  
+  fChronoScheduler_AddTaskUs(&scheduler, &tasks[0], fRecordTask, &ids[0], 700U);
+  TEST_ASSERT_EQUAL_UINT32(700U, fChronoScheduler_NextDeadlineUs(&scheduler));
+  
+  fChronoScheduler_AddTaskUs(&scheduler, &tasks[1], fRecordTask, &ids[1], 250U);
+  fChronoScheduler_AddTaskMs(&scheduler, &tasks[2], fRecordTask, &ids[2], 10U);
+  TEST_ASSERT_EQUAL_UINT32(250U, fChronoScheduler_NextDeadlineUs(&scheduler));
+  
+  tickVal = 100U;
+  TEST_ASSERT_EQUAL_UINT32(150U, fChronoScheduler_NextDeadlineUs(&scheduler));
+  
+  tickVal = 260U;
+  TEST_ASSERT_EQUAL_UINT32(0U, fChronoScheduler_NextDeadlineUs(&scheduler));
+  
+  TEST_ASSERT_EQUAL_UINT16(1U, fChronoScheduler_Run(&scheduler));
+  TEST_ASSERT_EQUAL_UINT32(240U, fChronoScheduler_NextDeadlineUs(&scheduler));
+  
+  fChronoScheduler_RemoveTask(&scheduler, &tasks[1]);
+  TEST_ASSERT_EQUAL_UINT32(440U, fChronoScheduler_NextDeadlineUs(&scheduler));
+  
+  fChronoScheduler_RemoveTask(&scheduler, &tasks[0]);
+  TEST_ASSERT_EQUAL_UINT32(9740U, fChronoScheduler_NextDeadlineUs(&scheduler));
+  
+  fChronoScheduler_RemoveTask(&scheduler, &tasks[2]);
+  TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, fChronoScheduler_NextDeadlineUs(&scheduler));
+}
+
+/**
+ * @brief Each overrun policy must handle missed periods as specified, count them and fill the lateness histogram.
+ * 
+ */
+TEST(GROUP_11, ChronoScheduler_RunIsCalledAfterMissedPeriods_AppliesOverrunPolicy) {
+  
+  static uint8_t ids[] = {0U, 1U, 2U};
+  uint32_t histogram[4];
+  
+  fChronoScheduler_AddTaskUs(&scheduler, &tasks[0], fRecordTask, &ids[0], 100U);
+  fChronoScheduler_AddTaskUs(&scheduler, &tasks[1], fRecordTask, &ids[1], 100U);
+  fChronoScheduler_AddTaskUs(&scheduler, &tasks[2], fRecordTask, &ids[2], 100U);
+  
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_SCHEDULER_OK, fChronoScheduler_SetTaskOverrunPolicy(&tasks[1], eCHRONO_OVERRUN_CATCH_UP));
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_SCHEDULER_OK, fChronoScheduler_SetTaskOverrunPolicy(&tasks[2], eCHRONO_OVERRUN_RESYNC));
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_SCHEDULER_ERROR_INVALID_PARAM, fChronoScheduler_SetTaskOverrunPolicy(&tasks[0], (eChronoOverrunPolicy)7));
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_SCHEDULER_ERROR_INVALID_PARAM, fChronoScheduler_SetTaskHistogram(&tasks[0], histogram, 0U, 100U));
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_SCHEDULER_OK, fChronoScheduler_SetTaskHistogram(&tasks[0], histogram, ArraySize_(histogram), 100U));
+  
+  tickVal = 350U;
+  TEST_ASSERT_EQUAL_UINT16(5U, fChronoScheduler_Run(&scheduler));
+  TEST_ASSERT_EQUAL_UINT32(1U, fChronoScheduler_GetTaskRunQty(&tasks[0]));
+  TEST_ASSERT_EQUAL_UINT32(3U, fChronoScheduler_GetTaskRunQty(&tasks[1]));
+  TEST_ASSERT_EQUAL_UINT32(1U, fChronoScheduler_GetTaskRunQty(&tasks[2]));
+  TEST_ASSERT_EQUAL_UINT32(2U, fChronoScheduler_GetTaskMissedQty(&tasks[0]));
+  TEST_ASSERT_EQUAL_UINT32(2U, fChronoScheduler_GetTaskMissedQty(&tasks[1]));
+  TEST_ASSERT_EQUAL_UINT32(2U, fChronoScheduler_GetTaskMissedQty(&tasks[2]));
+  
+  tickVal = 399U;
+  TEST_ASSERT_EQUAL_UINT16(0U, fChronoScheduler_Run(&scheduler));
+  tickVal = 400U;
+  TEST_ASSERT_EQUAL_UINT16(2U, fChronoScheduler_Run(&scheduler));
+  tickVal = 449U;
+  TEST_ASSERT_EQUAL_UINT16(0U, fChronoScheduler_Run(&scheduler));
+  tickVal = 450U;
+  TEST_ASSERT_EQUAL_UINT16(1U, fChronoScheduler_Run(&scheduler));
+  
+  tickVal = 1500U;
+  fChronoScheduler_Run(&scheduler);
+  
+  TEST_ASSERT_EQUAL_UINT32(1U, histogram[0]);
+  TEST_ASSERT_EQUAL_UINT32(0U, histogram[1]);
+  TEST_ASSERT_EQUAL_UINT32(1U, histogram[2]);
+  TEST_ASSERT_EQUAL_UINT32(1U, histogram[3]);
+  TEST_ASSERT_EQUAL_UINT32(12U, fChronoScheduler_GetTaskMissedQty(&tasks[0]));
+}
+
+/**
+ * @brief Test group runner.
+ * 
+ */
+TEST_GROUP_RUNNER(GROUP_11) {
+
+  RUN_TEST_CASE(GROUP_11, ChronoScheduler_RunIsCalledAfterSeveralDeadlines_RunsTasksInDeadlineOrder);
+  RUN_TEST_CASE(GROUP_11, ChronoScheduler_RunIsCalledLate_KeepsPhaseAndReportsJitter);
+  RUN_TEST_CASE(GROUP_11, ChronoScheduler_RunIsCalledEveryTick_RunsEachTaskOncePerPeriod);
+  RUN_TEST_CASE(GROUP_11, ChronoScheduler_RemoveTaskIsCalled_TaskDoesNotRun);
+  RUN_TEST_CASE(GROUP_11, ChronoScheduler_NextDeadlineUsIsCalled_ReturnsTimeUntilEarliestDeadline);
+  RUN_TEST_CASE(GROUP_11, ChronoScheduler_RunIsCalledAfterMissedPeriods_AppliesOverrunPolicy);
+
+}
+
+/** @} */ //End of TEST_GROUP_11
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_12)
+/** @defgroup TEST_GROUP_12
+ *  @{
+ */
+
+#define BENCHMARK_LOOP_QTY    (100000U)
+#define BENCHMARK_REPEAT_QTY  (20U)
+
+/**
+ * @brief Runs "expr_" BENCHMARK_LOOP_QTY times and stores the cycles of the fastest of BENCHMARK_REPEAT_QTY repeats
+ *        in "cycles_".
+ * 
+ */
+#define BENCHMARK_(cycles_, expr_) {\
+    (cycles_) = UINT64_MAX;\
+    for(uint32_t repeat = 0U; repeat < BENCHMARK_REPEAT_QTY; repeat++) {\
+      uint32_t sum = 0U;\
+      uint64_t start = CHRONO_TEST_CYCLES_();\
+      for(uint32_t i = 0U; i < BENCHMARK_LOOP_QTY; i++) {\
+        sum += (uint32_t)(expr_);\
+      }\
+      uint64_t repeatCycles = CHRONO_TEST_CYCLES_() - start;\
+      (cycles_) = (repeatCycles < (cycles_)) ? repeatCycles : (cycles_);\
+      benchmarkSink += sum;\
+    }\
+  }
+
+volatile tick_t inlineTickVal;
+static volatile uint32_t benchmarkSink;
+
+/**
+ * @brief Tick function of the out-of-line API. It reads the same tick as CHRONO_INLINE_TICK_().
+ * 
+ */
+static tick_t fInlineTick(void) {
+  
+  return inlineTickVal;
+}
+
+/**
+ * @brief Prints the cycles per call of the out-of-line and inline versions of a function.
+ * 
+ */
+static void fPrintBenchmark(const char *name, uint64_t cycles, uint64_t inlineCycles) {
+  
+  UnityPrint(name);
+  UnityPrint(": ");
+  UnityPrintNumberUnsigned((cycles * 100U) / BENCHMARK_LOOP_QTY);
+  UnityPrint(" vs inline ");
+  UnityPrintNumberUnsigned((inlineCycles * 100U) / BENCHMARK_LOOP_QTY);
+  UnityPrint(" (cycles per 100 calls)\n");
+}
+
+/**
+ * @brief Test group object.
+ * 
+ */
+TEST_GROUP(GROUP_12);
+
+/**
+ * @brief Unit test setup.
+ * 
+ */
+TEST_SETUP(GROUP_12) {
+  
+  inlineTickVal = 0U;
+  fChrono_Init(fInlineTick);
+}
+
+/**
+ * @brief Unit test teardown.
+ * 
+ */
+TEST_TEAR_DOWN(GROUP_12) {
+
+}
+
+/**
+ * @brief The inline functions must return the same values as the out-of-line functions, also across a tick overflow.
+ * 
+ */
+TEST(GROUP_12, ChronoInline_FunctionsAreCalled_ReturnSameValuesAsChrono) {
+  
+  sChrono testChrono;
+  sChrono inlineChrono;
+  uint32_t mismatch = 0U;
+  
+  inlineTickVal = CHRONO_TICK_TOP_VALUE - 20000U;
+  
+  fChrono_StartTimeoutUs(&testChrono, 3000U);
+  fChrono_StartTimeoutUs(&inlineChrono, 3000U);
+  
+  for(uint32_t i = 0U; i < 20000U; i++) {
+    
+    inlineTickVal += 3U;
+    
+    if(fChrono_GetTickInline() != fChrono_GetTick()) {
+      mismatch++;
+    }
+    if(fChrono_ElapsedUsInline(&inlineChrono) != fChrono_ElapsedUs(&testChrono)) {
+      mismatch++;
+    }
+    if(fChrono_IsTimeoutInline(&inlineChrono) != fChrono_IsTimeout(&testChrono)) {
+      mismatch++;
+    }
+    if(fChrono_IsTimeout(&testChrono)) {
+      fChrono_RestartTimeoutUs(&testChrono, 3000U);
+      fChrono_RestartTimeoutUs(&inlineChrono, 3000U);
+    }
+  }
+  
+  fChrono_Stop(&testChrono);
+  fChrono_Stop(&inlineChrono);
+  inlineTickVal += 1000U;
+  
+  TEST_ASSERT_EQUAL_UINT32(0U, mismatch);
+  TEST_ASSERT_EQUAL(FALSE, fChrono_IsTimeoutInline(&inlineChrono));
+  TEST_ASSERT_EQUAL_UINT32(fChrono_ElapsedUs(&testChrono), fChrono_ElapsedUsInline(&inlineChrono));
+}
+
+/**
+ * @brief Measures the cycles of the hot functions of the chrono module against their inline versions on the host.
+ * 
+ * @note The result depends on the host and the optimization level, so it is printed and not asserted.
+ * 
+ */
+TEST(GROUP_12, ChronoInline_BenchmarkIsRun_PrintsCyclesPerCall) {
+  
+  sChrono testChrono;
+  uint64_t cycles;
+  uint64_t inlineCycles;
+  
+  fChrono_StartTimeoutUs(&testChrono, 0xFFFFFFU);
+  
+  BENCHMARK_(cycles, fChrono_GetTick());
+  BENCHMARK_(inlineCycles, fChrono_GetTickInline());
+  fPrintBenchmark("fChrono_GetTick", cycles, inlineCycles);
+  
+  BENCHMARK_(cycles, fChrono_IsTimeout(&testChrono));
+  BENCHMARK_(inlineCycles, fChrono_IsTimeoutInline(&testChrono));
+  fPrintBenchmark("fChrono_IsTimeout", cycles, inlineCycles);
+  
+  BENCHMARK_(cycles, fChrono_ElapsedUs(&testChrono));
+  BENCHMARK_(inlineCycles, fChrono_ElapsedUsInline(&testChrono));
+  fPrintBenchmark("fChrono_ElapsedUs", cycles, inlineCycles);
+  
+  TEST_ASSERT_EQUAL(FALSE, fChrono_IsTimeout(&testChrono));
+}
+
+/**
+ * @brief Test group runner.
+ * 
+ */
+TEST_GROUP_RUNNER(GROUP_12) {
+
+  RUN_TEST_CASE(GROUP_12, ChronoInline_FunctionsAreCalled_ReturnSameValuesAsChrono);
+  RUN_TEST_CASE(GROUP_12, ChronoInline_BenchmarkIsRun_PrintsCyclesPerCall);
+
+}
+
+/** @} */ //End of TEST_GROUP_12
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_13)
+/** @defgroup TEST_GROUP_13
+ *  @{
+ */
+
+static sChronoStat stat;
+
+/**
+ * @brief Test group object.
+ * 
+ */
+TEST_GROUP(GROUP_13);
+
+/**
+ * @brief Unit test setup.
+ * 
+ */
+TEST_SETUP(GROUP_13) {
+  
+  tickVal = 0U;
+  
+  fChrono_Init(&tickVal);
+  fChronoStat_Reset(&stat);
+}
+
+/**
+ * @brief Unit test teardown.
+ * 
+ */
+TEST_TEAR_DOWN(GROUP_13) {
+
+}
+
+/**
+ * @brief Minimum, maximum, mean and sample variance of a known data set.
+ * 
+ */
+TEST(GROUP_13, ChronoStat_SamplesAreAdded_ReturnsMinMaxMeanAndVariance) {
+  
+  static const uint32_t samples[] = {2U, 4U, 4U, 4U, 5U, 5U, 7U, 9U};
+  
+  for(uint8_t i = 0U; i < ArraySize_(samples); i++) {
+    fChronoStat_AddSampleUs(&stat, samples[i]);
+  }
+  
+  TEST_ASSERT_EQUAL_UINT32(8U, stat.Count);
+  TEST_ASSERT_EQUAL_UINT32(2U, stat.MinUs);
+  TEST_ASSERT_EQUAL_UINT32(9U, stat.MaxUs);
+  TEST_ASSERT_EQUAL_UINT32(5U, stat.MeanUs);
+  TEST_ASSERT_EQUAL_UINT32(4U, stat.VarianceUs2);
+  
+  TEST_ASSERT_EQUAL_UINT32(1U, stat.Histogram[2]);
+  TEST_ASSERT_EQUAL_UINT32(6U, stat.Histogram[3]);
+  TEST_ASSERT_EQUAL_UINT32(1U, stat.Histogram[4]);
+}
+
+/**
+ * @brief A constant sample must give its value as mean and zero variance, without drift over many samples.
+ * 
+ */
+TEST(GROUP_13, ChronoStat_ConstantSamplesAreAdded_MeanDoesNotDrift) {
+  
+  fChronoStat_AddSampleUs(&stat, 1000U);
+  TEST_ASSERT_EQUAL_UINT32(1000U, stat.MeanUs);
+  TEST_ASSERT_EQUAL_UINT32(0U, stat.VarianceUs2);
+  
+  for(uint32_t i = 1U; i < 100000U; i++) {
+    fChronoStat_AddSampleUs(&stat, 1000U);
+  }
+  
+  TEST_ASSERT_EQUAL_UINT32(100000U, stat.Count);
+  TEST_ASSERT_EQUAL_UINT32(1000U, stat.MeanUs);
+  TEST_ASSERT_EQUAL_UINT32(0U, stat.VarianceUs2);
+  TEST_ASSERT_EQUAL_UINT32(100000U, stat.Histogram[10]);
+}
+
+/**
+ * @brief After a step change in a long run, the mean and the variance must follow both levels.
+ * 
+ */
+TEST(GROUP_13, ChronoStat_StepChangeAfterLongRun_MeanAndVarianceFollow) {
+  
+  for(uint32_t i = 0U; i < 100000U; i++) {
+    fChronoStat_AddSampleUs(&stat, 1000U);
+  }
+  for(uint32_t i = 0U; i < 100000U; i++) {
+    fChronoStat_AddSampleUs(&stat, 1300U);
+  }
+  
+  TEST_ASSERT_EQUAL_UINT32(200000U, stat.Count);
+  TEST_ASSERT_EQUAL_UINT32(1150U, stat.MeanUs);
+  TEST_ASSERT_EQUAL_UINT32(22500U, stat.VarianceUs2);
+}
+
+/**
+ * @brief Samples must go to their log2 bins, large samples to the last bin, and large variances must saturate.
+ * 
+ */
+TEST(GROUP_13, ChronoStat_LargeSamplesAreAdded_LastBinAndVarianceSaturate) {
+  
+  fChronoStat_AddSampleUs(&stat, 0U);
+  fChronoStat_AddSampleUs(&stat, 1U);
+  fChronoStat_AddSampleUs(&stat, 3U);
+  fChronoStat_AddSampleUs(&stat, 16383U);
+  fChronoStat_AddSampleUs(&stat, 16384U);
+  fChronoStat_AddSampleUs(&stat, UINT32_MAX);
+  
+  TEST_ASSERT_EQUAL_UINT32(1U, stat.Histogram[0]);
+  TEST_ASSERT_EQUAL_UINT32(1U, stat.Histogram[1]);
+  TEST_ASSERT_EQUAL_UINT32(1U, stat.Histogram[2]);
+  TEST_ASSERT_EQUAL_UINT32(1U, stat.Histogram[CHRONO_STAT_BIN_QTY - 2U]);
+  TEST_ASSERT_EQUAL_UINT32(2U, stat.Histogram[CHRONO_STAT_BIN_QTY - 1U]);
+  
+  TEST_ASSERT_EQUAL_UINT32(0U, stat.MinUs);
+  TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, stat.MaxUs);
+  TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, stat.VarianceUs2);
+  
+  fChronoStat_Reset(&stat);
+  
+  TEST_ASSERT_EQUAL_UINT32(0U, stat.Count);
+  TEST_ASSERT_EQUAL_UINT32(0U, stat.VarianceUs2);
+  TEST_ASSERT_EQUAL_UINT32(0U, stat.Histogram[CHRONO_STAT_BIN_QTY - 1U]);
+}
+
+/**
+ * @brief Intervals and elapsed times that are measured with a chrono object must be added as samples.
+ * 
+ */
+TEST(GROUP_13, ChronoStat_IntervalAndElapsedAreMeasured_AddsThemAsSamples) {
+  
+  sChrono chrono;
+  sChronoStat elapsedStat;
+  
+  fChronoStat_Reset(&elapsedStat);
+  
+  tickVal = 100U;
+  fChrono_Start(&chrono);
+  
+  tickVal = 350U;
+  TEST_ASSERT_EQUAL_UINT32(250U, fChronoStat_IntervalUs(&stat, &chrono));
+  tickVal = 450U;
+  TEST_ASSERT_EQUAL_UINT32(100U, fChronoStat_IntervalUs(&stat, &chrono));
+  
+  TEST_ASSERT_EQUAL_UINT32(2U, stat.Count);
+  TEST_ASSERT_EQUAL_UINT32(100U, stat.MinUs);
+  TEST_ASSERT_EQUAL_UINT32(250U, stat.MaxUs);
+  TEST_ASSERT_EQUAL_UINT32(175U, stat.MeanUs);
+  
+  fChrono_Start(&chrono);
+  tickVal = 480U;
+  TEST_ASSERT_EQUAL_UINT32(30U, fChronoStat_ElapsedUs(&elapsedStat, &chrono));
+  
+  TEST_ASSERT_EQUAL_UINT32(1U, elapsedStat.Count);
+  TEST_ASSERT_EQUAL_UINT32(30U, elapsedStat.MeanUs);
+  TEST_ASSERT_EQUAL_UINT32(1U, elapsedStat.Histogram[5]);
+}
+
+/**
+ * @brief Test group runner.
+ * 
+ */
+TEST_GROUP_RUNNER(GROUP_13) {
+
+  RUN_TEST_CASE(GROUP_13, ChronoStat_SamplesAreAdded_ReturnsMinMaxMeanAndVariance);
+  RUN_TEST_CASE(GROUP_13, ChronoStat_ConstantSamplesAreAdded_MeanDoesNotDrift);
+  RUN_TEST_CASE(GROUP_13, ChronoStat_StepChangeAfterLongRun_MeanAndVarianceFollow);
+  RUN_TEST_CASE(GROUP_13, ChronoStat_LargeSamplesAreAdded_LastBinAndVarianceSaturate);
+  RUN_TEST_CASE(GROUP_13, ChronoStat_IntervalAndElapsedAreMeasured_AddsThemAsSamples);
+
+}
+
+/** @} */ //End of TEST_GROUP_13
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_14)
+/** @defgroup TEST_GROUP_14
+ *  @{
+ */
+
+#define FAST_DOMAIN (1U)
+#define SLOW_DOMAIN (2U)
+
+static volatile uint32_t fastTickVal;
+static volatile uint32_t slowTickVal;
+
+/**
+ * @brief Test group object.
+ * 
+ */
+TEST_GROUP(GROUP_14);
+
+/**
+ * @brief Unit test setup.
+ * 
+ * @note The fast domain is a 72MHz up-counting cycle counter and the slow domain is a 1kHz 16-bit down-counting timer.
+ * 
+ */
+TEST_SETUP(GROUP_14) {
+  
+  tickVal = 0U;
+  fastTickVal = 0U;
+  slowTickVal = 0xFFFFU;
+  
+  fChrono_Init(&tickVal);
+  fChrono_DomainInit(FAST_DOMAIN, &fastTickVal, 0xFFFFFFFFU, 72000000U, TICK_COUNTERMODE_UP);
+  fChrono_DomainInit(SLOW_DOMAIN, &slowTickVal, 0xFFFFU, 1000U, TICK_COUNTERMODE_DOWN);
+}
+
+/**
+ * @brief Unit test teardown.
+ * 
+ */
+TEST_TEAR_DOWN(GROUP_14) {
+
+}
+
+/**
+ * @brief Invalid parameters of fChrono_DomainInit() return their error codes and leave the domain uninitialized.
+ * 
+ */
+TEST(GROUP_14, Chrono_DomainInitIsCalledWithInvalidParameters_ReturnError) {
+  
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_ERROR_DOMAIN_INVALID, fChrono_DomainInit(CHRONO_DOMAIN_DEFAULT, &fastTickVal, 0xFFFFFFFFU, 72000000U, TICK_COUNTERMODE_UP));
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_ERROR_DOMAIN_INVALID, fChrono_DomainInit(CHRONO_DOMAIN_QTY, &fastTickVal, 0xFFFFFFFFU, 72000000U, TICK_COUNTERMODE_UP));
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_ERROR_DOMAIN_INVALID, fChrono_DomainInit(FAST_DOMAIN, &fastTickVal, 0xFFFFFFFFU, 72000000U, 7U));
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_ERROR_TICK_TOP_ZERO, fChrono_DomainInit(FAST_DOMAIN, &fastTickVal, 0U, 72000000U, TICK_COUNTERMODE_UP));
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_ERROR_TICK_FREQ_ZERO, fChrono_DomainInit(FAST_DOMAIN, &fastTickVal, 0xFFFFFFFFU, 0U, TICK_COUNTERMODE_UP));
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_ERROR_TICK_PTR_ERROR, fChrono_DomainInit(FAST_DOMAIN, NULL, 0xFFFFFFFFU, 72000000U, TICK_COUNTERMODE_UP));
+  
+  TEST_ASSERT_EQUAL_UINT32(0U, fChrono_GetDomainTickTopValue(FAST_DOMAIN));
+  TEST_ASSERT_EQUAL_UINT32(0xFFFFU, fChrono_GetDomainTickTopValue(SLOW_DOMAIN));
+  TEST_ASSERT_EQUAL_UINT32(0U, fChrono_GetDomainTickTopValue(CHRONO_DOMAIN_QTY));
+}
+
+/**
+ * @brief A chrono object started in the fast domain measures its ticks with its frequency.
+ * 
+ */
+TEST(GROUP_14, Chrono_ChronoIsBoundToFastDomain_MeasuresDomainTicks) {
+  
+  sChrono chrono = {0};
+  sChrono defaultChrono = {0};
+  
+  fChrono_StartIn(&chrono, FAST_DOMAIN);
+  fChrono_Start(&defaultChrono);
+  
+  fastTickVal = 72000U;
+  
+  TEST_ASSERT_EQUAL_UINT32(72000U, fChrono_GetDomainTick(FAST_DOMAIN));
+  TEST_ASSERT_EQUAL_UINT32(1000U, fChrono_ElapsedUs(&chrono));
+  TEST_ASSERT_EQUAL_UINT32(1U, fChrono_ElapsedMs(&chrono));
+  TEST_ASSERT_EQUAL_UINT32(0U, fChrono_ElapsedUs(&defaultChrono));
+  
+  fastTickVal = 72000U + 36000U;
+  TEST_ASSERT_EQUAL_UINT32(1500U, fChrono_IntervalUs(&chrono));
+  
+  fChrono_StartTimeoutUsIn(&chrono, FAST_DOMAIN, 10U);
+  fastTickVal += 719U;
+  TEST_ASSERT_FALSE(fChrono_IsTimeout(&chrono));
+  fastTickVal += 1U;
+  TEST_ASSERT_TRUE(fChrono_IsTimeout(&chrono));
+}
+
+/**
+ * @brief A chrono object started in the slow down-counting domain handles its overflow and has no microsecond unit.
+ * 
+ */
+TEST(GROUP_14, Chrono_ChronoIsBoundToSlowDomain_HandlesOverflowOfDomain) {
+  
+  sChrono chrono = {0};
+  
+  slowTickVal = 5U;
+  fChrono_StartIn(&chrono, SLOW_DOMAIN);
+  slowTickVal = 0xFFF5U;
+  
+  TEST_ASSERT_EQUAL_UINT32(15U, fChrono_ElapsedMs(&chrono));
+  TEST_ASSERT_EQUAL_UINT32(0U, fChrono_ElapsedS(&chrono));
+  TEST_ASSERT_EQUAL_UINT32(0U, fChrono_ElapsedUs(&chrono));
+  
+  fChrono_StartTimeoutSIn(&chrono, SLOW_DOMAIN, 2U);
+  slowTickVal -= 1999U;
+  TEST_ASSERT_EQUAL_UINT32(1U, fChrono_LeftMs(&chrono));
+  slowTickVal -= 1U;
+  TEST_ASSERT_TRUE(fChrono_IsTimeout(&chrono));
+}
+
+/**
+ * @brief The timeout of a chrono object in the down-counting domain restarts from its deadline across the overflow.
+ * 
+ */
+TEST(GROUP_14, Chrono_RestartTimeoutMsIsCalledInSlowDomain_DoesNotDrift) {
+  
+  sChrono chrono = {0};
+  
+  slowTickVal = 5U;
+  fChrono_StartTimeoutMsIn(&chrono, SLOW_DOMAIN, 10U);
+  slowTickVal = 0xFFF8U;
+  
+  TEST_ASSERT_TRUE(fChrono_IsTimeout(&chrono));
+  
+  fChrono_RestartTimeoutMs(&chrono, 10U);
+  
+  TEST_ASSERT_FALSE(fChrono_IsTimeout(&chrono));
+  TEST_ASSERT_EQUAL_UINT32(8U, fChrono_LeftMs(&chrono));
+}
+
+/**
+ * @brief Chrono objects that are started without a domain or in an invalid domain use the default domain.
+ * 
+ */
+TEST(GROUP_14, Chrono_ChronoHasInvalidDomain_UsesDefaultDomain) {
+  
+  sChrono chrono = {0};
+  
+  fChrono_StartIn(&chrono, 200U);
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_DOMAIN_DEFAULT, chrono._domain);
+  
+  tickVal = 100U;
+  fastTickVal = 100U;
+  
+  TEST_ASSERT_EQUAL_UINT32(100U, fChrono_ElapsedUs(&chrono));
+  
+  TEST_ASSERT_EQUAL_UINT32(0U, fChrono_GetDomainTick(CHRONO_DOMAIN_QTY));
+}
+
+/**
+ * @brief An uninitialized object whose domain field holds another valid domain still measures in the default domain
+ *        when it is started with fChrono_Start() or fChrono_StartTimeoutX(), and a stopped one is restarted there.
+ * 
+ */
+TEST(GROUP_14, Chrono_GarbageDomainIsStartedWithoutDomain_UsesDefaultDomain) {
+  
+  sChrono chrono;
+  
+  chrono._domain = FAST_DOMAIN;
+  fChrono_Start(&chrono);
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_DOMAIN_DEFAULT, chrono._domain);
+  
+  tickVal = 100U;
+  fastTickVal = 72000U;
+  TEST_ASSERT_EQUAL_UINT32(100U, fChrono_ElapsedUs(&chrono));
+  
+  chrono._domain = FAST_DOMAIN;
+  fChrono_StartTimeoutUs(&chrono, 10U);
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_DOMAIN_DEFAULT, chrono._domain);
+  
+  fChrono_StartIn(&chrono, FAST_DOMAIN);
+  (void)fChrono_Stop(&chrono);
+  fChrono_RestartTimeoutUs(&chrono, 10U);
+  TEST_ASSERT_EQUAL_UINT8(CHRONO_DOMAIN_DEFAULT, chrono._domain);
+  
+  tickVal += 9U;
+  fastTickVal += 72000U;
+  TEST_ASSERT_FALSE(fChrono_IsTimeout(&chrono));
+  tickVal += 1U;
+  TEST_ASSERT_TRUE(fChrono_IsTimeout(&chrono));
+}
+
+/**
+ * @brief Test group runner.
+ * 
+ */
+TEST_GROUP_RUNNER(GROUP_14) {
+
+  RUN_TEST_CASE(GROUP_14, Chrono_DomainInitIsCalledWithInvalidParameters_ReturnError);
+  RUN_TEST_CASE(GROUP_14, Chrono_ChronoIsBoundToFastDomain_MeasuresDomainTicks);
+  RUN_TEST_CASE(GROUP_14, Chrono_ChronoIsBoundToSlowDomain_HandlesOverflowOfDomain);
+  RUN_TEST_CASE(GROUP_14, Chrono_RestartTimeoutMsIsCalledInSlowDomain_DoesNotDrift);
+  RUN_TEST_CASE(GROUP_14, Chrono_ChronoHasInvalidDomain_UsesDefaultDomain);
+  RUN_TEST_CASE(GROUP_14, Chrono_GarbageDomainIsStartedWithoutDomain_UsesDefaultDomain);
+
+}
+
+/** @} */ //End of TEST_GROUP_14
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_15)
+/** @defgroup TEST_GROUP_15
+ *  @{
+ */
+
+#define DAY_US  ((uint64_t)86400000000U)
+
+/**
+ * @brief Advances the simulated tick generator and calls the overflow handler on every wrap, like its interrupt would.
+ * 
+ * @note The tick generator is a 1MHz 32-bit counter, so it wraps about every 71.6 minutes.
+ * 
+ * @param durationUs Simulated time (microseconds)
+ */
+static void SimulateUs(uint64_t durationUs) {
+  
+  uint64_t tick = (uint64_t)tickVal + durationUs;
+  
+  while(tick >= (uint64_t)CHRONO_TICK_TOP_VALUE) {
+    tick -= (uint64_t)CHRONO_TICK_TOP_VALUE;
+    fChrono_TickOverflowHandler();
+  }
+  
+  tickVal = (uint32_t)tick;
+}
+
+/**
+ * @brief Test group object.
+ * 
+ */
+TEST_GROUP(GROUP_15);
+
+/**
+ * @brief Unit test setup.
+ * 
+ */
+TEST_SETUP(GROUP_15) {
+  
+  tickVal = 0xFFFFFF00U;
+  
+  fChrono_Init(&tickVal);
+}
+
+/**
+ * @brief Unit test teardown.
+ * 
+ */
+TEST_TEAR_DOWN(GROUP_15) {
+
+}
+
+/**
+ * @brief Elapsed time stays exact over days of wraps without calling the chronoLong API in between.
+ * 
+ */
+TEST(GROUP_15, ChronoLong_ElapsedIsReadAfterDays_ReturnsCorrectElapsedTime) {
+  
+  sChronoLong chrono = {0};
+  
+  fChronoLong_Start(&chrono);
+  
+  SimulateUs(0x200U);
+  TEST_ASSERT_EQUAL_UINT64(0U, fChronoLong_ElapsedMs(&chrono));
+  
+  SimulateUs((3U * DAY_US) - 0x200U + 999U);
+  TEST_ASSERT_EQUAL_UINT64(259200000U, fChronoLong_ElapsedMs(&chrono));
+  TEST_ASSERT_EQUAL_UINT64(259200U, fChronoLong_ElapsedS(&chrono));
+  
+  SimulateUs(1U);
+  TEST_ASSERT_EQUAL_UINT64(259200001U, fChronoLong_ElapsedMs(&chrono));
+  
+  SimulateUs(400U * DAY_US);
+  TEST_ASSERT_EQUAL_UINT64(403U * 86400U, fChronoLong_ElapsedS(&chrono));
+}
+
+/**
+ * @brief A timeout of days expires at its exact millisecond.
+ * 
+ */
+TEST(GROUP_15, ChronoLong_TimeoutOfDaysIsStarted_ExpiresOnTime) {
+  
+  sChronoLong chrono = {0};
+  
+  fChronoLong_StartTimeoutMs(&chrono, 2U * 86400000U);
+  
+  SimulateUs((2U * DAY_US) - 1000U);
+  TEST_ASSERT_FALSE(fChronoLong_IsTimeout(&chrono));
+  TEST_ASSERT_EQUAL_UINT64(1U, fChronoLong_LeftMs(&chrono));
+  TEST_ASSERT_EQUAL_UINT64(1U, fChronoLong_LeftS(&chrono));
+  
+  SimulateUs(1000U);
+  TEST_ASSERT_TRUE(fChronoLong_IsTimeout(&chrono));
+  TEST_ASSERT_EQUAL_UINT64(0U, fChronoLong_LeftMs(&chrono));
+  TEST_ASSERT_EQUAL_UINT64(0U, fChronoLong_LeftS(&chrono));
+  
+  SimulateUs(DAY_US);
+  TEST_ASSERT_TRUE(fChronoLong_IsTimeout(&chrono));
+}
+
+/**
+ * @brief Reading the object on every wrap doesn't change it or its results.
+ * 
+ */
+TEST(GROUP_15, ChronoLong_ObjectIsReadOnEveryWrap_DoesNotChangeObject) {
+  
+  sChronoLong chrono = {0};
+  sChronoLong copy;
+  
+  fChronoLong_StartTimeoutS(&chrono, 86400U);
+  copy = chrono;
+  
+  for(uint32_t i = 0U; i < 20U; i++) {
+    
+    SimulateUs((uint64_t)CHRONO_TICK_TOP_VALUE);
+    
+    TEST_ASSERT_FALSE(fChronoLong_IsTimeout(&chrono));
+    TEST_ASSERT_EQUAL_UINT64(((uint64_t)(i + 1U) * (uint64_t)CHRONO_TICK_TOP_VALUE) / 1000U, fChronoLong_ElapsedMs(&chrono));
+    TEST_ASSERT_EQUAL_MEMORY(&copy, &chrono, sizeof(chrono));
+  }
+  
+  SimulateUs(DAY_US - (20U * (uint64_t)CHRONO_TICK_TOP_VALUE));
+  TEST_ASSERT_TRUE(fChronoLong_IsTimeout(&chrono));
+}
+
+/**
+ * @brief A stopped object returns zero.
+ * 
+ */
+TEST(GROUP_15, ChronoLong_ObjectIsStopped_ReturnsZero) {
+  
+  sChronoLong chrono = {0};
+  
+  fChronoLong_StartTimeoutS(&chrono, 10U);
+  SimulateUs(DAY_US);
+  fChronoLong_Stop(&chrono);
+  
+  TEST_ASSERT_EQUAL_UINT64(0U, fChronoLong_ElapsedMs(&chrono));
+  TEST_ASSERT_EQUAL_UINT64(0U, fChronoLong_LeftMs(&chrono));
+  TEST_ASSERT_FALSE(fChronoLong_IsTimeout(&chrono));
+}
+
+/**
+ * @brief Test group runner.
+ * 
+ */
+TEST_GROUP_RUNNER(GROUP_15) {
+
+  RUN_TEST_CASE(GROUP_15, ChronoLong_ElapsedIsReadAfterDays_ReturnsCorrectElapsedTime);
+  RUN_TEST_CASE(GROUP_15, ChronoLong_TimeoutOfDaysIsStarted_ExpiresOnTime);
+  RUN_TEST_CASE(GROUP_15, ChronoLong_ObjectIsReadOnEveryWrap_DoesNotChangeObject);
+  RUN_TEST_CASE(GROUP_15, ChronoLong_ObjectIsStopped_ReturnsZero);
+
+}
+
+/** @} */ //End of TEST_GROUP_15
+#endif
+
+/*
+╔══════════════════════════════════════════════════════════════════════════════════╗
+║                            ##### Private Functions #####                         ║
+╚══════════════════════════════════════════════════════════════════════════════════╝
+*/
+
+/**
+ * @brief Run all tests in test group.
+ * 
+ */
+static void RunTests(void) {
+  
+#if(CHRONO_TEST_STATUS == CHRONO_TESTS_DISABLED)
+  (void)(RunTests);
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_1)
+  RUN_TEST_GROUP(GROUP_1);
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_2)
+  RUN_TEST_GROUP(GROUP_2);
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_3)
+  RUN_TEST_GROUP(GROUP_3);
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_4)
+  RUN_TEST_GROUP(GROUP_4);
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_5)
+  RUN_TEST_GROUP(GROUP_5);
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_6)
+  RUN_TEST_GROUP(GROUP_6);
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_7)
+  RUN_TEST_GROUP(GROUP_7);
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_8)
+  RUN_TEST_GROUP(GROUP_8);
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_9)
+  RUN_TEST_GROUP(GROUP_9);
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_10)
+  RUN_TEST_GROUP(GROUP_10);
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_11)
+  RUN_TEST_GROUP(GROUP_11);
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_12)
+  RUN_TEST_GROUP(GROUP_12);
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_13)
+  RUN_TEST_GROUP(GROUP_13);
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_14)
+  RUN_TEST_GROUP(GROUP_14);
+#endif
+
+#if(CHRONO_TEST_GROUP == TEST_GROUP_15)
+  RUN_TEST_GROUP(GROUP_15);
 #endif
 
 }
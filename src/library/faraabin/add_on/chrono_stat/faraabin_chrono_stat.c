@@ -0,0 +1,111 @@
+/**
+  ******************************************************************************
+  * @file           : faraabin_chrono_stat.c
+  * @brief          : Faraabin variable type of the chrono statistics object.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 FaraabinCo.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  *
+  * https://faraabinco.ir/
+  * https://github.com/FaraabinCo
+  *
+  ******************************************************************************
+  @verbatim
+
+  This add-on introduces sChronoStat of the chrono module to Faraabin as a structure variable type. Count, MinUs, MaxUs,
+  MeanUs, VarianceUs2 and the log2 Histogram of each sChronoStat variable are shown as its members, so the host can plot
+  the distribution of intervals and execution times instead of their last values.
+
+  The private fields of sChronoStat are not introduced.
+
+  @code
+  #include "add_on/chrono_stat/faraabin_chrono_stat.h"
+
+  static sChronoStat ExecutionStat;
+
+  FARAABIN_CONTAINER_DEF_STATIC_(Container);
+
+  int main(void) {
+
+    fFaraabin_Init();
+
+    fChronoStat_Reset(&ExecutionStat);
+    fFaraabinChronoStat_Init();
+    FARAABIN_Container_Init_(&Container);
+
+    while(TRUE) {
+      fFaraabin_Run();
+    }
+  }
+
+  FARAABIN_CONTAINER_FUNC_(Container) {
+
+    FARAABIN_VAR_CHRONO_STAT_(ExecutionStat);
+
+    FARAABIN_CONTAINER_FUNC_END_;
+  }
+  @endcode
+
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "faraabin_chrono_stat.h"
+
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private typedef -----------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+/* Variables -----------------------------------------------------------------*/
+FARAABIN_VAR_TYPE_LAYOUT_DEF_(sChronoStat);
+
+/*
+╔══════════════════════════════════════════════════════════════════════════════════╗
+║                          ##### Exported Functions #####                          ║
+╚══════════════════════════════════════════════════════════════════════════════════╝
+*/
+
+/**
+ * @brief Initializes the sChronoStat variable type.
+ *
+ * @note It must be called once after fFaraabin_Init() and before the containers that use FARAABIN_VAR_CHRONO_STAT_().
+ *
+ */
+void fFaraabinChronoStat_Init(void) {
+
+  FARAABIN_VAR_TYPE_STRUCT_INIT_(sChronoStat);
+}
+
+/*
+╔══════════════════════════════════════════════════════════════════════════════════╗
+║                            ##### Private Functions #####                         ║
+╚══════════════════════════════════════════════════════════════════════════════════╝
+*/
+
+/**
+ * @brief Layout table of the public fields of sChronoStat.
+ *
+ */
+FARAABIN_VAR_TYPE_LAYOUT_FUNC_(sChronoStat)
+{
+  FARAABIN_VAR_TYPE_LAYOUT_FUNC_START_(sChronoStat);
+
+  FARAABIN_VAR_TYPE_LAYOUT_MEMBER_(uint32_t, Count, 1);
+  FARAABIN_VAR_TYPE_LAYOUT_MEMBER_(uint32_t, MinUs, 1);
+  FARAABIN_VAR_TYPE_LAYOUT_MEMBER_(uint32_t, MaxUs, 1);
+  FARAABIN_VAR_TYPE_LAYOUT_MEMBER_(uint32_t, MeanUs, 1);
+  FARAABIN_VAR_TYPE_LAYOUT_MEMBER_(uint32_t, VarianceUs2, 1);
+  FARAABIN_VAR_TYPE_LAYOUT_MEMBER_(uint32_t, Histogram, CHRONO_STAT_BIN_QTY);
+
+  FARAABIN_VAR_TYPE_LAYOUT_FUNC_END_(sChronoStat);
+}
+FARAABIN_VAR_TYPE_LAYOUT_SEND_FUNC_(sChronoStat)
+
+/************************ © COPYRIGHT FaraabinCo *****END OF FILE****/
@@ -0,0 +1,65 @@
+/**
+  ******************************************************************************
+  * @file           : faraabin_chrono_stat.h
+  * @brief          : Faraabin variable type of the chrono statistics object.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 FaraabinCo.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  *
+  * https://faraabinco.ir/
+  * https://github.com/FaraabinCo
+  *
+  ******************************************************************************
+  @verbatim
+
+  For more information on how to use this module, please refer to the implementation
+  of the module in faraabin_chrono_stat.c file.
+
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef FARAABIN_CHRONO_STAT_H
+#define FARAABIN_CHRONO_STAT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "faraabin.h"
+#include "chrono_stat.h"
+
+/* Exported defines ----------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/**
+ * @brief Introduces a variable of type sChronoStat inside a container function.
+ *
+ * @note fFaraabinChronoStat_Init() must be called once before the container is initialized.
+ *
+ * @param varName_ Name of the sChronoStat variable.
+ */
+#define FARAABIN_VAR_CHRONO_STAT_(varName_)              FARAABIN_VAR_STRUCT_(varName_, sChronoStat)
+#define FARAABIN_VAR_CHRONO_STAT_WP_(varName_, path_)    FARAABIN_VAR_STRUCT_WP_(varName_, sChronoStat, path_)
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* Exported functions prototypes ---------------------------------------------*/
+void fFaraabinChronoStat_Init(void);
+
+/* Exported variables --------------------------------------------------------*/
+FARAABIN_VAR_TYPE_DEF_EXTERN_(sChronoStat);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FARAABIN_CHRONO_STAT_H */
+
+/************************ © COPYRIGHT FaraabinCo *****END OF FILE****/
@@ -0,0 +1,366 @@
+/**
+  ******************************************************************************
+  * @file           : runtime_dispatcher.c
+  * @brief          : Runtime dispatcher module.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 FaraabinCo.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  *
+  * https://faraabinco.ir/
+  * https://github.com/FaraabinCo
+  *
+  ******************************************************************************
+  @verbatim
+
+  RUN_EVERY_US_() and its friends in runtime_scaler.h create a hidden static chrono object at their call site, so
+  their blocks can't be enumerated, retimed or observed. This module is the registered variant of them:
+  - RUN_EVERY_REGISTER_US_(), RUN_EVERY_REGISTER_MS_() and RUN_EVERY_REGISTER_S_() define a block at file scope.
+    Each block has an sRunEvery object with its name, and a constant descriptor in "run_every" linker section.
+  - fRuntimeDispatcher_Run() walks the section and runs the blocks that are due. Like RUN_EVERY_BASE_(), each interval
+    starts at the deadline of the previous one, and missed intervals are skipped. It returns the time until the next
+    deadline, so the main loop can sleep until then.
+  - Each run updates RunQty, LateUs, LateMaxUs, ExecutionUs and ExecutionMaxUs of the block.
+  - IntervalUs and Enable can be changed at run time, e.g. from Faraabin. Intervals longer than the tick generator can
+    measure, i.e. fChrono_GetMaxMeasurableTimeUs(), are clamped to it.
+
+  sRunEvery is introduced to Faraabin as a structure variable type. When FB_FEATURE_FLAG_SECTION_DICT is enabled, every
+  registered block is a variable of RunEveryContainer without any container function.
+
+  The section is kept in the GCC linker script, in both IAR .icf files and by the "used" attribute for ARM compiler.
+  At least one block must be registered when ARM compiler is used, because it doesn't create the symbols of an empty section.
+
+  @code
+  #include "add_on/runtime_scaler/runtime_dispatcher.h"
+
+  RUN_EVERY_REGISTER_MS_(Blink, 500) {
+
+    //User code to run every 500 milliseconds.
+    //...
+  }
+
+  int main(void) {
+
+    fChrono_Init(tickValue);
+    fFaraabin_Init();
+    fRuntimeDispatcher_Init();
+
+    while(TRUE) {
+      fRuntimeDispatcher_Run();
+      fFaraabin_Run();
+    }
+  }
+  @endcode
+
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "runtime_dispatcher.h"
+
+#include <string.h>
+
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/**
+ * @brief Asserts whether the object is null or not.
+ *
+ * @note If the object is null, ASSERT_NOT_NULL_RET_ macro forces the API to return the value specified by "ret"
+ *
+ */
+#define ASSERT_NOT_NULL_RET_(object, ret) if((object) == NULL){return (ret);}
+#define ASSERT_NOT_NULL_(object) if((object) == NULL){return;}
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static sChrono ExecutionChrono; /*!< Measures the execution time of the running block. */
+
+/* Private function prototypes -----------------------------------------------*/
+static void fDispatcherRunBlock(const sRunEveryDict *dict);
+static timeUs_t fDispatcherClampIntervalUs(sRunEvery * const block);
+
+/* Variables -----------------------------------------------------------------*/
+FARAABIN_VAR_TYPE_LAYOUT_DEF_(sRunEvery);
+
+#if defined(FB_FEATURE_FLAG_SECTION_DICT) && defined(FARAABIN_ENABLE)
+FARAABIN_SECTION_CONTAINER_DEF_(RunEveryContainer);
+#endif
+
+#if defined(__ICCARM__)
+#pragma section = "run_every"
+#elif defined(__CC_ARM) || defined(__ARMCC_VERSION)
+extern const sRunEveryDict run_every$$Base[];
+extern const sRunEveryDict run_every$$Limit[];
+#else
+extern const sRunEveryDict __start_run_every[];
+extern const sRunEveryDict __stop_run_every[];
+#endif
+
+/*
+╔══════════════════════════════════════════════════════════════════════════════════╗
+║                          ##### Exported Functions #####                          ║
+╚══════════════════════════════════════════════════════════════════════════════════╝
+*/
+
+/** @defgroup DISPATCHER_API Dispatcher API in the runtime_dispatcher module
+ *  @brief These functions run and enumerate the registered RUN_EVERY blocks.
+ *  @{
+ */
+
+/**
+ * @brief Introduces the registered blocks to Faraabin.
+ *
+ * @note It must be called once after fFaraabin_Init(). The blocks themselves need no initialization.
+ *
+ */
+void fRuntimeDispatcher_Init(void) {
+
+  FARAABIN_VAR_TYPE_STRUCT_INIT_(sRunEvery);
+
+#if defined(FB_FEATURE_FLAG_SECTION_DICT) && defined(FARAABIN_ENABLE)
+  FARAABIN_Container_Init_(&RunEveryContainer);
+#endif
+}
+
+/**
+ * @brief Runs the registered blocks that are due.
+ *
+ * @note The first call starts the blocks, and they run after their first interval. Each block reads the tick
+ *       once if it is not due.
+ *
+ * @retval nextUs: Time until the next deadline of the enabled blocks (microseconds). It is UINT32_MAX if no block is enabled.
+ */
+timeUs_t fRuntimeDispatcher_Run(void) {
+
+  timeUs_t nextUs = (timeUs_t)UINT32_MAX;
+  const sRunEveryDict *end = fRuntimeDispatcher_GetEnd();
+
+  for(const sRunEveryDict *dict = fRuntimeDispatcher_GetBegin(); dict < end; dict++) {
+
+    sRunEvery * const block = dict->Block;
+
+    if(!block->Enable || (block->IntervalUs == 0U)) {
+      if(block->_run) {
+        (void)fChrono_Stop(&block->_chrono);
+        block->_run = FALSE;
+      }
+    } else {
+      if(!block->_run) {
+        block->_periodUs = fDispatcherClampIntervalUs(block);
+        fChrono_StartTimeoutUs(&block->_chrono, block->_periodUs);
+        block->_run = TRUE;
+      }
+
+      timeUs_t leftUs = fChrono_LeftUs(&block->_chrono);
+      if(leftUs == 0U) {
+        fDispatcherRunBlock(dict);
+        leftUs = fChrono_LeftUs(&block->_chrono);
+      }
+
+      if(leftUs < nextUs) {
+        nextUs = leftUs;
+      }
+    }
+  }
+
+  return nextUs;
+}
+
+/**
+ * @brief Returns the first descriptor in the RUN_EVERY section.
+ *
+ * @retval begin: Pointer to the first descriptor
+ */
+const sRunEveryDict* fRuntimeDispatcher_GetBegin(void) {
+
+#if defined(__ICCARM__)
+  return (const sRunEveryDict*)__section_begin(RUN_EVERY_SECTION_NAME);
+#elif defined(__CC_ARM) || defined(__ARMCC_VERSION)
+  return run_every$$Base;
+#else
+  return __start_run_every;
+#endif
+}
+
+/**
+ * @brief Returns the end of the descriptors in the RUN_EVERY section.
+ *
+ * @retval end: Pointer to one past the last descriptor
+ */
+const sRunEveryDict* fRuntimeDispatcher_GetEnd(void) {
+
+#if defined(__ICCARM__)
+  return (const sRunEveryDict*)__section_end(RUN_EVERY_SECTION_NAME);
+#elif defined(__CC_ARM) || defined(__ARMCC_VERSION)
+  return run_every$$Limit;
+#else
+  return __stop_run_every;
+#endif
+}
+
+/**
+ * @brief Finds a registered block by its name.
+ *
+ * @param name Name of the block, as it is given to RUN_EVERY_REGISTER_x_()
+ * @retval block: Pointer to the object of the block, or NULL if there is no block with this name
+ */
+sRunEvery* fRuntimeDispatcher_Find(const char *name) {
+
+  ASSERT_NOT_NULL_RET_(name, NULL); /* MISRA 2012 Rule 15.5 deviation */
+
+  const sRunEveryDict *end = fRuntimeDispatcher_GetEnd();
+
+  for(const sRunEveryDict *dict = fRuntimeDispatcher_GetBegin(); dict < end; dict++) {
+    if(strcmp(dict->Name, name) == 0) {
+      return dict->Block; /* MISRA 2012 Rule 15.5 deviation */
+    }
+  }
+
+  return NULL;
+}
+
+/** @} */ //End of DISPATCHER_API
+
+/** @defgroup BLOCK_API Objective API in the runtime_dispatcher module
+ *  @brief These functions require the sRunEvery object of a registered block.
+ *  @{
+ */
+
+/**
+ * @brief Changes the interval of a block.
+ *
+ * @note If the block is running, its next deadline is one new interval from now. Writing IntervalUs directly
+ *       applies the new interval at the next deadline instead.
+ *
+ * @param me Pointer to the block object
+ * @param intervalUs New interval (microseconds). Zero stops the block. It is clamped to fChrono_GetMaxMeasurableTimeUs().
+ */
+void fRuntimeDispatcher_SetIntervalUs(sRunEvery * const me, timeUs_t intervalUs) {
+
+  ASSERT_NOT_NULL_(me); /* MISRA 2012 Rule 15.5 deviation */
+
+  me->IntervalUs = intervalUs;
+  timeUs_t periodUs = fDispatcherClampIntervalUs(me);
+
+  if(me->_run) {
+    me->_periodUs = periodUs;
+    fChrono_StartTimeoutUs(&me->_chrono, periodUs);
+  }
+}
+
+/**
+ * @brief Changes the interval of a block.
+ *
+ * @note Refer to fRuntimeDispatcher_SetIntervalUs() for more information.
+ *
+ * @param me Pointer to the block object
+ * @param intervalMs New interval (milliseconds). Zero stops the block.
+ */
+void fRuntimeDispatcher_SetIntervalMs(sRunEvery * const me, timeMs_t intervalMs) {
+
+  timeUs_t intervalUs = (intervalMs <= ((timeMs_t)UINT32_MAX / 1000U)) ? ((timeUs_t)intervalMs * 1000U) : (timeUs_t)UINT32_MAX;
+
+  fRuntimeDispatcher_SetIntervalUs(me, intervalUs);
+}
+
+/**
+ * @brief Clears the run counter, the lateness and the execution time of a block.
+ *
+ * @param me Pointer to the block object
+ */
+void fRuntimeDispatcher_ResetStatistics(sRunEvery * const me) {
+
+  ASSERT_NOT_NULL_(me); /* MISRA 2012 Rule 15.5 deviation */
+
+  me->RunQty = 0U;
+  me->LateUs = 0U;
+  me->LateMaxUs = 0U;
+  me->ExecutionUs = 0U;
+  me->ExecutionMaxUs = 0U;
+}
+
+/** @} */ //End of BLOCK_API
+
+/*
+╔══════════════════════════════════════════════════════════════════════════════════╗
+║                            ##### Private Functions #####                         ║
+╚══════════════════════════════════════════════════════════════════════════════════╝
+*/
+
+/**
+ * @brief Runs a block that is due and updates its statistics.
+ *
+ * @note The timeout is restarted from the deadline before the block runs, so the interval doesn't drift with the
+ *       execution time or the lateness. A change of IntervalUs is applied here.
+ *
+ * @param dict Pointer to the descriptor of the block
+ */
+static void fDispatcherRunBlock(const sRunEveryDict *dict) {
+
+  sRunEvery * const block = dict->Block;
+
+  timeUs_t elapsedUs = fChrono_ElapsedUs(&block->_chrono);
+  block->LateUs = (elapsedUs > block->_periodUs) ? (elapsedUs - block->_periodUs) : 0U;
+  if(block->LateUs > block->LateMaxUs) {
+    block->LateMaxUs = block->LateUs;
+  }
+
+  block->_periodUs = fDispatcherClampIntervalUs(block);
+  fChrono_RestartTimeoutUs(&block->_chrono, block->_periodUs);
+
+  (void)fChrono_Start(&ExecutionChrono);
+  dict->fpRun();
+  block->ExecutionUs = fChrono_ElapsedUs(&ExecutionChrono);
+  if(block->ExecutionUs > block->ExecutionMaxUs) {
+    block->ExecutionMaxUs = block->ExecutionUs;
+  }
+
+  block->RunQty++;
+}
+
+/**
+ * @brief Clamps the interval of a block to the longest time that the tick generator can measure.
+ *
+ * @note Longer timeouts would wrap around in ticks and expire early. IntervalUs is updated, so the clamped
+ *       value is what the user sees.
+ *
+ * @param block Pointer to the block object
+ * @retval intervalUs: Clamped interval (microseconds)
+ */
+static timeUs_t fDispatcherClampIntervalUs(sRunEvery * const block) {
+
+  timeUs_t maxUs = fChrono_GetMaxMeasurableTimeUs();
+
+  if(block->IntervalUs > maxUs) {
+    block->IntervalUs = maxUs;
+  }
+
+  return block->IntervalUs;
+}
+
+/**
+ * @brief Layout table of the fields of sRunEvery that are shown in Faraabin.
+ *
+ */
+FARAABIN_VAR_TYPE_LAYOUT_FUNC_(sRunEvery)
+{
+  FARAABIN_VAR_TYPE_LAYOUT_FUNC_START_(sRunEvery);
+
+  FARAABIN_VAR_TYPE_LAYOUT_MEMBER_(uint32_t, IntervalUs, 1);
+  FARAABIN_VAR_TYPE_LAYOUT_MEMBER_(bool_t, Enable, 1);
+  FARAABIN_VAR_TYPE_LAYOUT_MEMBER_(uint32_t, RunQty, 1);
+  FARAABIN_VAR_TYPE_LAYOUT_MEMBER_(uint32_t, LateUs, 1);
+  FARAABIN_VAR_TYPE_LAYOUT_MEMBER_(uint32_t, LateMaxUs, 1);
+  FARAABIN_VAR_TYPE_LAYOUT_MEMBER_(uint32_t, ExecutionUs, 1);
+  FARAABIN_VAR_TYPE_LAYOUT_MEMBER_(uint32_t, ExecutionMaxUs, 1);
+
+  FARAABIN_VAR_TYPE_LAYOUT_FUNC_END_(sRunEvery);
+}
+FARAABIN_VAR_TYPE_LAYOUT_SEND_FUNC_(sRunEvery)
+
+/************************ © COPYRIGHT FaraabinCo *****END OF FILE****/
@@ -0,0 +1,233 @@
+/**
+  ******************************************************************************
+  * @file           : runtime_dispatcher.h
+  * @brief          : Runtime dispatcher module header file.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 FaraabinCo.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  *
+  * https://faraabinco.ir/
+  * https://github.com/FaraabinCo
+  *
+  ******************************************************************************
+  @verbatim
+
+  For more information on how to use this module, please refer to the implementation
+  of the module in runtime_dispatcher.c file.
+
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef RUNTIME_DISPATCHER_H
+#define RUNTIME_DISPATCHER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "chrono.h"
+#include "faraabin.h"
+
+/* Exported defines ----------------------------------------------------------*/
+/**
+ * @brief Name of the linker section that holds the descriptors of the registered RUN_EVERY blocks.
+ *
+ */
+#define RUN_EVERY_SECTION_NAME  "run_every"
+
+/* Exported macro ------------------------------------------------------------*/
+/**
+ * @brief Places a constant descriptor in the RUN_EVERY section and keeps it from being removed by the linker.
+ *
+ * @note GCC needs the section to be kept in linker script (see STM32F103C8TX_FLASH.ld). IAR needs "keep { section run_every };"
+ *       in the .icf file. ARM compiler keeps the section with "used" attribute and creates run_every$$Base/$$Limit symbols.
+ * @note The alignment is set to the one of a pointer, so the compiler doesn't pad the descriptors in the section and it can be
+ *       walked as an array, e.g. on 64-bit hosts where GCC aligns larger objects to 32 bytes.
+ *
+ */
+#if defined(__ICCARM__)
+#define RUN_EVERY_SECTION_ATTR_   _Pragma("location=\"run_every\"") __root
+#elif defined(__CC_ARM) || defined(__ARMCC_VERSION) || defined(__GNUC__)
+#define RUN_EVERY_SECTION_ATTR_   __attribute__((used, section(RUN_EVERY_SECTION_NAME), aligned(sizeof(void*))))
+#else
+#error "RUN_EVERY section is not supported for this compiler."
+#endif
+
+/**
+ * @brief Introduces a registered RUN_EVERY block to Faraabin.
+ *
+ * @note When FB_FEATURE_FLAG_SECTION_DICT is enabled, each registered block is placed in RunEveryContainer automatically.
+ *       Otherwise, use FARAABIN_VAR_RUN_EVERY_() inside a container function, like any other structure variable.
+ *
+ */
+#if defined(FB_FEATURE_FLAG_SECTION_DICT) && defined(FARAABIN_ENABLE)
+#define RUN_EVERY_FARAABIN_VAR_(name_) FARAABIN_SECTION_VAR_(RunEveryContainer, sRunEvery, name_);
+#else
+#define RUN_EVERY_FARAABIN_VAR_(name_)
+#endif
+
+#define FARAABIN_VAR_RUN_EVERY_(varName_)              FARAABIN_VAR_STRUCT_(varName_, sRunEvery)
+#define FARAABIN_VAR_RUN_EVERY_WP_(varName_, path_)    FARAABIN_VAR_STRUCT_WP_(varName_, sRunEvery, path_)
+
+/** @defgroup RUN_EVERY_REGISTER Registered RUN_EVERY macros
+ *  @{
+ */
+
+/**
+ * @brief Base macro for registering a code block that runs at regular intervals by fRuntimeDispatcher_Run().
+ *
+ * @note It must be used at file scope and is followed by the body of the code block, like a function definition.
+ * @note DO NOT USE this macro directly in your application. Instead, utilize RUN_EVERY_REGISTER_US_(), RUN_EVERY_REGISTER_MS_() or RUN_EVERY_REGISTER_S_().
+ *
+ * @param name_ Name of the code block. It is also the name of its sRunEvery object.
+ * @param intervalUs_ The time interval for executing the code block in microseconds.
+ */
+#define RUN_EVERY_REGISTER_BASE_(name_, intervalUs_) \
+  static void __run_every_func_##name_##__(void);\
+  sRunEvery name_ = {.IntervalUs = (timeUs_t)(intervalUs_), .Enable = TRUE};\
+  RUN_EVERY_SECTION_ATTR_ static const sRunEveryDict __run_every_dict_##name_##__ = \
+  {\
+    .Name = #name_,\
+    .Block = &(name_),\
+    .fpRun = __run_every_func_##name_##__,\
+  };\
+  RUN_EVERY_FARAABIN_VAR_(name_)\
+  static void __run_every_func_##name_##__(void)
+
+/**
+ * @brief Registers a code block that runs every intervalUs_ microseconds.
+ *
+ * @param name_ Name of the code block.
+ * @param intervalUs_ The time interval for running the code block in microseconds.
+ */
+#define RUN_EVERY_REGISTER_US_(name_, intervalUs_) RUN_EVERY_REGISTER_BASE_(name_, (intervalUs_))
+
+/**
+ * @brief Registers a code block that runs every intervalMs_ milliseconds.
+ *
+ * @param name_ Name of the code block.
+ * @param intervalMs_ The time interval for running the code block in milliseconds.
+ */
+#define RUN_EVERY_REGISTER_MS_(name_, intervalMs_) RUN_EVERY_REGISTER_BASE_(name_, (intervalMs_) * 1000U)
+
+/**
+ * @brief Registers a code block that runs every intervalS_ seconds.
+ *
+ * @param name_ Name of the code block.
+ * @param intervalS_ The time interval for running the code block in seconds.
+ */
+#define RUN_EVERY_REGISTER_S_(name_, intervalS_) RUN_EVERY_REGISTER_BASE_(name_, (intervalS_) * 1000000U)
+
+/**
+ * @brief Declares the sRunEvery object of a code block that is registered in another file.
+ *
+ * @param name_ Name of the code block.
+ */
+#define RUN_EVERY_REGISTER_EXTERN_(name_) extern sRunEvery name_
+
+/** @} */ //End of RUN_EVERY_REGISTER
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief Definition of the RUN_EVERY block object.
+  *
+  * @note It is created by RUN_EVERY_REGISTER_x_() macros. The public fields are updated on every run of the block,
+  *       so they can be read directly, e.g. by a debugger or Faraabin.
+  *
+  */
+typedef struct {
+
+  timeUs_t IntervalUs;      /*!< Holds the interval of the block in microseconds. It can be changed at run time and is applied at the next deadline.
+                                 Use fRuntimeDispatcher_SetIntervalUs() to apply it immediately. Zero stops the block.
+                                 Intervals longer than fChrono_GetMaxMeasurableTimeUs() are clamped to it. */
+
+  bool_t Enable;            /*!< Holds the enable status of the block. A disabled block is stopped and starts over when it is enabled again. */
+
+  uint32_t RunQty;          /*!< Holds the number of runs of the block.
+                                 This parameter is set by the dispatcher. Users must not change its value. */
+
+  timeUs_t LateUs;          /*!< Holds how late the last run started after its deadline in microseconds.
+                                 This parameter is set by the dispatcher. Users must not change its value. */
+
+  timeUs_t LateMaxUs;       /*!< Holds the maximum of LateUs.
+                                 This parameter is set by the dispatcher. Users must not change its value. */
+
+  timeUs_t ExecutionUs;     /*!< Holds the execution time of the last run in microseconds.
+                                 This parameter is set by the dispatcher. Users must not change its value. */
+
+  timeUs_t ExecutionMaxUs;  /*!< Holds the maximum of ExecutionUs.
+                                 This parameter is set by the dispatcher. Users must not change its value. */
+
+  bool_t _run;              /*!< Holds whether the block is started, i.e. its timeout is running.
+                                 This parameter is private and is set by the dispatcher. Users must not change its value. */
+
+  timeUs_t _periodUs;       /*!< Holds the interval of the running timeout.
+                                 This parameter is private and is set by the dispatcher. Users must not change its value. */
+
+  sChrono _chrono;          /*!< Holds the chrono object of the block.
+                                 This parameter is private and is set by the dispatcher. Users must not change its value. */
+
+}sRunEvery;
+
+/**
+  * @brief Constant descriptor of a RUN_EVERY block that is placed in the RUN_EVERY section at compile time.
+  *
+  */
+typedef struct {
+
+  const char *Name;       /*!< Name of the block. */
+
+  sRunEvery *Block;       /*!< Pointer to the object of the block. */
+
+  void(*fpRun)(void);     /*!< Pointer to the body of the block. */
+
+}sRunEveryDict;
+
+/* Exported constants --------------------------------------------------------*/
+/* Exported functions prototypes ---------------------------------------------*/
+/** @defgroup DISPATCHER_API Dispatcher API in the runtime_dispatcher module
+ *  @brief These functions run and enumerate the registered RUN_EVERY blocks.
+ *  @{
+ */
+
+void fRuntimeDispatcher_Init(void);
+timeUs_t fRuntimeDispatcher_Run(void);
+const sRunEveryDict* fRuntimeDispatcher_GetBegin(void);
+const sRunEveryDict* fRuntimeDispatcher_GetEnd(void);
+sRunEvery* fRuntimeDispatcher_Find(const char *name);
+
+/** @} */ //End of DISPATCHER_API
+
+/** @defgroup BLOCK_API Objective API in the runtime_dispatcher module
+ *  @brief These functions require the sRunEvery object of a registered block.
+ *  @{
+ */
+
+void fRuntimeDispatcher_SetIntervalUs(sRunEvery * const me, timeUs_t intervalUs);
+void fRuntimeDispatcher_SetIntervalMs(sRunEvery * const me, timeMs_t intervalMs);
+void fRuntimeDispatcher_ResetStatistics(sRunEvery * const me);
+
+/** @} */ //End of BLOCK_API
+
+/* Exported variables --------------------------------------------------------*/
+FARAABIN_VAR_TYPE_DEF_EXTERN_(sRunEvery);
+
+#if defined(FB_FEATURE_FLAG_SECTION_DICT) && defined(FARAABIN_ENABLE)
+extern sFaraabinFobjectContainer RunEveryContainer;
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RUNTIME_DISPATCHER_H */
+
+/************************ © COPYRIGHT FaraabinCo *****END OF FILE****/
@@ -129,6 +129,12 @@
   }
   @endcode
 
+  3- Registered RUN_EVERY blocks:
+    - The static macros above can't be enumerated, retimed or observed, because their chrono objects are hidden at the call site.
+    - RUN_EVERY_REGISTER_US_(), RUN_EVERY_REGISTER_MS_() and RUN_EVERY_REGISTER_S_() of runtime_dispatcher.h register a block at file scope.
+    - fRuntimeDispatcher_Run() runs all registered blocks, and each block keeps its run count, lateness and execution time.
+    - Refer to runtime_dispatcher.c for more information.
+
   Refer to the comments above each macro for more information on usage.
   @mainpage
   */
@@ -189,6 +195,8 @@ extern "C" {
  * @brief Base macro for marking the start of a code block that runs at regular intervals.
  * 
  * @note It is essential to use the RUN_END_ macro to conclude the code block.
+ * @note Each interval starts at the deadline of the previous one, so the code block doesn't drift with the lateness of the loop.
+ *       If the loop falls more than one interval behind, the code block runs once and the missed intervals are skipped.
  * @note DO NOT USE this macro directly in your application. Instead, utilize appropriate wrappers such as RUN_EVERY_US_OBJ_(), RUN_EVERY_US_OBJ_FORCE_(), RUN_EVERY_US_(), RUN_EVERY_US_FORCE_(), etc.
  * 
  * @param name_ Name of the code block.
@@ -204,7 +212,7 @@ extern "C" {
     if((fChrono_IsTimeout((chrono_)) == TRUE) && (interval_ != 0)) {\
         time##ts_##_t name_##_elapsed##ts_ = fChrono_Elapsed##ts_((chrono_));\
         (void)(name_##_elapsed##ts_);\
-        fChrono_StartTimeout##ts_((chrono_), (interval_));
+        fChrono_RestartTimeout##ts_((chrono_), (interval_));
 
 /** @defgroup RUN_EVERY_US Macros with microsecond time scale
   * @ingroup RUN_EVERY
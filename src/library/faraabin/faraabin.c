@@ -161,7 +161,8 @@ bool fFaraabin_IsAllowEvent(void) {
 		return false;
 	}
 	
-	if(LinkHandler.DictSendingMode.SendFlag) {
+	// Non-blocking dictionary sending leaves room in TX buffer for live traffic, so events are only held back in blocking mode.
+	if(LinkHandler.DictSendingMode.SendFlag && LinkHandler.DictSendingMode.IsBlocking) {
 		return false;
 	}
 	
@@ -194,19 +195,11 @@ void fFaraabin_Run(void) {
 	fCpuProfiler_Run();
 #endif
 
-  // Looping over all dictionaries to find databus pointers.
-  // After finding databus pointer, captured data of that databus is sent.
-  uint16_t dictQty = fFaraabinDatabase_GetNumberOfAddedDicts();
-  for(uint16_t i = 0U; i < dictQty; i++) {
+  // Looping over databus dictionaries only, using the database type list.
+  // For each databus, captured data (or full sample blocks in stream state) is sent.
+  for(uint16_t i = fFaraabinDatabase_GetFirstDictOfType((uint8_t)eFO_TYPE_DATABUS); i != FB_DATABASE_INVALID_INDEX; i = fFaraabinDatabase_GetNextDictOfType(i)) {
 
-    uint32_t fobjectPtr = fFaraabinDatabase_GetFobjectPointerFromDict(i);
-    uint8_t *fobjectType = (uint8_t*)fobjectPtr;
-
-    if((eFaraabin_FobjectType)(*fobjectType) == eFO_TYPE_DATABUS) {
-      
-      fFaraabinFobjectDataBus_SendCaptureDataRun((sFaraabinFobjectDataBus*)fobjectPtr);
-
-    }
+    fFaraabinFobjectDataBus_SendCaptureDataRun((sFaraabinFobjectDataBus*)fFaraabinDatabase_GetFobjectPointerFromDict(i));
   }
 }
 
@@ -25,8 +25,13 @@
 #include "faraabin_link_handler.h"
 #include "faraabin_fobject_mcu.h"
 #include "faraabin_config.h"
+#include "faraabin_fobject.h"
 
 /* Private define ------------------------------------------------------------*/
+#define DATABASE_HASH_SIZE      ((uint32_t)FB_MAX_FOBJECT_QTY * 2U) /*!< Size of the open addressing hash table. Load factor is kept below 0.5. */
+#define DATABASE_HASH_EMPTY     (0U)                                /*!< Empty slot marker in the hash table. Slots keep (dict index + 1). */
+#define DATABASE_TYPE_QTY       ((uint16_t)eFO_TYPE_FOBJECT_END)    /*!< Number of fobject types that have an index list. */
+
 /* Private macro -------------------------------------------------------------*/
 /* Private typedef -----------------------------------------------------------*/
 /**
@@ -39,6 +44,16 @@ typedef struct {
 	
   uint16_t DatabaseArrayIndex;
   
+  uint16_t HashTable[DATABASE_HASH_SIZE];         /*!< Open addressing hash set of fobject pointers. Each slot keeps (dict index + 1). */
+  
+  uint16_t NextOfType[FB_MAX_FOBJECT_QTY];        /*!< Index of the next dict with the same fobject type. */
+  
+  uint16_t FirstOfType[DATABASE_TYPE_QTY];        /*!< Index of the first dict of each fobject type. */
+  
+  uint16_t LastOfType[DATABASE_TYPE_QTY];         /*!< Index of the last dict of each fobject type. */
+  
+  uint32_t Generation;                            /*!< Generation number of the database. It is incremented whenever a dict is added. */
+  
 }sFaraabinDatabase;
 
 /* Private variables ---------------------------------------------------------*/
@@ -49,6 +64,8 @@ typedef struct {
 static sFaraabinDatabase FaraabinDatabase;
 
 /* Private function prototypes -----------------------------------------------*/
+static uint32_t fHashSlot(uint32_t fobjectPtr);
+
 /* Variables -----------------------------------------------------------------*/
 /**
  * @brief Faraabin flags singleton.
@@ -67,9 +84,21 @@ sFaraabinFlags FaraabinFlags;
  */
 uint8_t fFaraabinDatabase_Init(void) {
   
-  for(uint16_t i = 1; i < FB_MAX_FOBJECT_QTY; i++) {
+  for(uint16_t i = 0; i < FB_MAX_FOBJECT_QTY; i++) {
     
     FaraabinDatabase.DatabaseArray[i] = 0U;
+    FaraabinDatabase.NextOfType[i] = FB_DATABASE_INVALID_INDEX;
+  }
+  
+  for(uint32_t i = 0; i < DATABASE_HASH_SIZE; i++) {
+    
+    FaraabinDatabase.HashTable[i] = DATABASE_HASH_EMPTY;
+  }
+  
+  for(uint16_t i = 0; i < DATABASE_TYPE_QTY; i++) {
+    
+    FaraabinDatabase.FirstOfType[i] = FB_DATABASE_INVALID_INDEX;
+    FaraabinDatabase.LastOfType[i] = FB_DATABASE_INVALID_INDEX;
   }
   
   FaraabinDatabase.DatabaseArrayIndex = 0U;
@@ -104,6 +133,9 @@ uint8_t fFaraabinDatabase_Init(void) {
 #ifdef FB_FEATURE_FLAG_ALLOW_SEND_DICT_BLOCKING
   FaraabinFlags.Features.Bitfield.AllowSendDickBlocking = 1U;
 #endif
+#ifdef FB_FEATURE_FLAG_DICT_STRING_TABLE
+  FaraabinFlags.Features.Bitfield.DictStringTable = 1U;
+#endif
 
   FaraabinFlags.Status.Bitfield.McuReset = 1U;
   
@@ -113,6 +145,10 @@ uint8_t fFaraabinDatabase_Init(void) {
 /**
  * @brief Adds a new dictionary to Faraabin database.
  * 
+ * @note Dicts can be added at any time. Dicts added while the whole dictionary is being sent, or after it,
+ *       are pushed to the host by link handler as incremental updates.
+ *       Type of the fobject must be set before it is added, because the dict is put in the list of its type.
+ * 
  * @param fobjectPtr Pointer of the fobject.
  * @return result Returns 0 if dict is added successfully, 1 if fobject is already in the database and 2 if database is full.
  */
@@ -137,14 +173,6 @@ uint8_t fFaraabinDatabase_AddDict(uint32_t fobjectPtr) {
 		return 1;
 	}
 	
-	if(LinkHandler.DictSendingMode.SendFlag) {
-		
-		FaraabinFlags.Status.Bitfield.UnexpectedDict = 1U;
-    fFaraabinFobjectMcu_GetFobject()->_init = false;
-		
-		return 1;
-	}
-  
   if(FaraabinDatabase.DatabaseArrayIndex >= (uint16_t)((uint16_t)FB_MAX_FOBJECT_QTY - (uint16_t)1)) {
     
     FaraabinFlags.Status.Bitfield.DictOverflow = 1U;
@@ -153,14 +181,42 @@ uint8_t fFaraabinDatabase_AddDict(uint32_t fobjectPtr) {
     return 1;
   }
   
-  FaraabinDatabase.DatabaseArray[FaraabinDatabase.DatabaseArrayIndex] = fobjectPtr;
+  uint16_t dictIndex = FaraabinDatabase.DatabaseArrayIndex;
+  
+  FaraabinDatabase.DatabaseArray[dictIndex] = fobjectPtr;
+  FaraabinDatabase.HashTable[fHashSlot(fobjectPtr)] = dictIndex + 1U;
+  
+  uint8_t type = *((uint8_t*)fobjectPtr);
+  if(type < DATABASE_TYPE_QTY) {
+    
+    if(FaraabinDatabase.LastOfType[type] == FB_DATABASE_INVALID_INDEX) {
+      FaraabinDatabase.FirstOfType[type] = dictIndex;
+    } else {
+      FaraabinDatabase.NextOfType[FaraabinDatabase.LastOfType[type]] = dictIndex;
+    }
+    FaraabinDatabase.LastOfType[type] = dictIndex;
+  }
+  
   FaraabinFlags.Status.Bitfield.NewDict = 1U;
   
   FaraabinDatabase.DatabaseArrayIndex++;
+  FaraabinDatabase.Generation++;
   
   return 0;
 }
 
+/**
+ * @brief Gets the generation number of the database.
+ * 
+ * @note Generation is incremented whenever a dict is added. Host compares it with the generation of its own copy
+ *       of the dictionary to detect missed updates.
+ * 
+ * @return generation Generation number of the database.
+ */
+uint32_t fFaraabinDatabase_GetGeneration(void) {
+  return FaraabinDatabase.Generation;
+}
+
 /**
  * @brief Gets the number of added fobject to database.
  * 
@@ -178,14 +234,7 @@ uint16_t fFaraabinDatabase_GetNumberOfAddedDicts(void) {
  */
 bool fFaraabinDatabase_IsDictExist(uint32_t fobjectPtr) {
 	
-	for(uint32_t i = 0; i < FB_MAX_FOBJECT_QTY; i++) {\
-		
-		if(FaraabinDatabase.DatabaseArray[i] == fobjectPtr) {
-			return true;
-		}
-	}
-	
-	return false;
+	return (FaraabinDatabase.HashTable[fHashSlot(fobjectPtr)] != DATABASE_HASH_EMPTY);
 }
 
 /**
@@ -204,6 +253,36 @@ uint32_t fFaraabinDatabase_GetFobjectPointerFromDict(uint16_t dictIndex) {
   return FaraabinDatabase.DatabaseArray[dictIndex];
 }
 
+/**
+ * @brief Gets the index of the first dict with the given fobject type.
+ * 
+ * @param fobjectType Type of the fobject from eFaraabin_FobjectType.
+ * @return dictIndex Index of the dict in database. FB_DATABASE_INVALID_INDEX if there is no fobject of this type.
+ */
+uint16_t fFaraabinDatabase_GetFirstDictOfType(uint8_t fobjectType) {
+  
+  if(fobjectType >= DATABASE_TYPE_QTY) {
+    return FB_DATABASE_INVALID_INDEX;
+  }
+  
+  return FaraabinDatabase.FirstOfType[fobjectType];
+}
+
+/**
+ * @brief Gets the index of the next dict with the same fobject type.
+ * 
+ * @param dictIndex Index of the current dict in database.
+ * @return dictIndex Index of the next dict in database. FB_DATABASE_INVALID_INDEX at the end of the list.
+ */
+uint16_t fFaraabinDatabase_GetNextDictOfType(uint16_t dictIndex) {
+  
+  if(dictIndex >= FaraabinDatabase.DatabaseArrayIndex) {
+    return FB_DATABASE_INVALID_INDEX;
+  }
+  
+  return FaraabinDatabase.NextOfType[dictIndex];
+}
+
 /**
  * @brief Returns enable status of all feature flags as a uint32_t variable.
  * 
@@ -240,5 +319,33 @@ uint32_t fFaraabinDatabase_GetRamUsage(void) {
 ===============================================================================
                     ##### fb_database.c Private Functions #####
 ===============================================================================*/
+/**
+ * @brief Finds the hash table slot of a fobject pointer.
+ * 
+ * @note Linear probing is used. Since dicts are never removed and the table is twice the size of the database,
+ *       the probe always ends on the matching slot or on an empty one.
+ * 
+ * @param fobjectPtr Pointer of the fobject.
+ * @return slot Index of the slot that holds the pointer, or the empty slot where it can be inserted.
+ */
+static uint32_t fHashSlot(uint32_t fobjectPtr) {
+  
+  uint32_t hash = fobjectPtr * 2654435761U;
+  uint32_t slot = (uint32_t)(((uint64_t)hash * DATABASE_HASH_SIZE) >> 32U);
+  
+  while(FaraabinDatabase.HashTable[slot] != DATABASE_HASH_EMPTY) {
+    
+    if(FaraabinDatabase.DatabaseArray[FaraabinDatabase.HashTable[slot] - 1U] == fobjectPtr) {
+      break;
+    }
+    
+    slot++;
+    if(slot >= DATABASE_HASH_SIZE) {
+      slot = 0U;
+    }
+  }
+  
+  return slot;
+}
 
 /************************ © COPYRIGHT FaraabinCo *****END OF FILE****/
@@ -35,6 +35,8 @@ extern "C" {
   #error "Maximum Fobjects quantity is 65534"
 #endif
 
+#define FB_DATABASE_INVALID_INDEX   (0xFFFFU) /*!< Returned by database type lists when there is no more dict. */
+
 /* Exported macro ------------------------------------------------------------*/
 /* Exported types ------------------------------------------------------------*/
 /**
@@ -56,7 +58,7 @@ typedef struct {
   
   uint32_t AllowSendDickBlocking : 1;  /*!< Reserved feature flag for future use. */
 	
-  uint32_t ReservedFlag09     : 1;  /*!< Reserved feature flag for future use. */
+  uint32_t DictStringTable    : 1;  /*!< Specifies whether strings of dictionary frames are interned in a string table. */
   uint32_t ReservedFlag10     : 1;  /*!< Reserved feature flag for future use. */
   uint32_t ReservedFlag11     : 1;  /*!< Reserved feature flag for future use. */
   uint32_t ReservedFlag12     : 1;  /*!< Reserved feature flag for future use. */
@@ -180,6 +182,16 @@ uint8_t fFaraabinDatabase_Init(void);
  */
 uint8_t fFaraabinDatabase_AddDict(uint32_t fobjectPtr);
 
+/**
+ * @brief Gets the generation number of the database.
+ * 
+ * @note Generation is incremented whenever a dict is added. Host compares it with the generation of its own copy
+ *       of the dictionary to detect missed updates.
+ * 
+ * @return generation Generation number of the database.
+ */
+uint32_t fFaraabinDatabase_GetGeneration(void);
+
 /**
  * @brief Gets the number of added fobject to database.
  * 
@@ -203,6 +215,22 @@ bool fFaraabinDatabase_IsDictExist(uint32_t fobjectPtr);
  */
 uint32_t fFaraabinDatabase_GetFobjectPointerFromDict(uint16_t dictIndex);
 
+/**
+ * @brief Gets the index of the first dict with the given fobject type.
+ * 
+ * @param fobjectType Type of the fobject from eFaraabin_FobjectType.
+ * @return dictIndex Index of the dict in database. FB_DATABASE_INVALID_INDEX if there is no fobject of this type.
+ */
+uint16_t fFaraabinDatabase_GetFirstDictOfType(uint8_t fobjectType);
+
+/**
+ * @brief Gets the index of the next dict with the same fobject type.
+ * 
+ * @param dictIndex Index of the current dict in database.
+ * @return dictIndex Index of the next dict in database. FB_DATABASE_INVALID_INDEX at the end of the list.
+ */
+uint16_t fFaraabinDatabase_GetNextDictOfType(uint16_t dictIndex);
+
 /**
  * @brief Returns enable status of all feature flags as a uint32_t variable.
  * 
@@ -58,6 +58,18 @@ static void __FARAABIN_CONTAINER_FUNC_##containerName_(void) {\
 #define FARAABIN_CONTAINER_FUNC_END_ }
 #define FARAABIN_Container_Init_WithPath(pContainer_, path_)
 #define FARAABIN_Container_Init_(pContainer_)
+#define FARAABIN_SECTION_CONTAINER_DEF_(containerName_)
+#define FARAABIN_SECTION_CONTAINER_DEF_STATIC_(containerName_)
+#endif
+
+#if !defined(FB_FEATURE_FLAG_SECTION_DICT) || !defined(FARAABIN_ENABLE)
+#define FARAABIN_SECTION_VAR_DICT_(containerName_, varType_, varName_, pVar_, arrayQty_, isPtr_, fpAccessCb_, path_)
+#define FARAABIN_SECTION_VAR_(containerName_, varType_, varName_)
+#define FARAABIN_SECTION_VAR_WP_(containerName_, varType_, varName_, path_)
+#define FARAABIN_SECTION_VAR_CB_WP_(containerName_, varType_, varName_, fpAccessCb_, path_)
+#define FARAABIN_SECTION_VAR_ARRAY_(containerName_, varType_, varName_)
+#define FARAABIN_SECTION_VAR_ARRAY_WP_(containerName_, varType_, varName_, path_)
+#define FARAABIN_SECTION_VAR_ARRAY_CB_WP_(containerName_, varType_, varName_, fpAccessCb_, path_)
 #endif
 
 #if !defined(FARAABIN_ENABLE)
@@ -87,7 +99,12 @@ static void __FARAABIN_CONTAINER_FUNC_##containerName_(void) {\
 #define FARAABIN_DataBus_AttachVariable_UserDefined_Enum_(pDatabus_, pVar_)
 #define FARAABIN_DataBus_AttachVariable_UserDefined_Struct_(pDatabus_, pVar_)
 #define FARAABIN_DataBus_AttachCodeBlock_(pDatabus_, pCodeblock_)
+#define FARAABIN_DataBus_AttachVariableSlice_(pDatabus_, pFirst_, stride_, qty_, primitiveId_)
 #define FARAABIN_DataBus_DetachAllChannels_(pDatabus_)
+#define FARAABIN_DataBus_SetChannelAggregate_(pDatabus_, channel_, mode_)
+#define FARAABIN_DataBus_SetChannelReport_(pDatabus_, channel_, mode_, deadband_)
+#define FARAABIN_DataBus_SetChannelBlockFifo_(pDatabus_, channel_, buffer_)
+#define FARAABIN_DataBus_PushBlockSample_(pDatabus_, channel_)
 #define FARAABIN_DataBus_Run_(pDatabus_)
 #endif
 
@@ -129,6 +146,10 @@ static void __FARAABIN_CONTAINER_FUNC_##containerName_(void) {\
 #define FARAABIN_FUNCTION_END_()  return 0
 #define FARAABIN_Function_LoopStartMs_(interval_)
 #define FARAABIN_Function_LoopEnd_()
+#define FARAABIN_Function_SetSchedule_(priority_, sliceBudgetUs_)
+#define FARAABIN_Function_CoroutineBegin_()
+#define FARAABIN_Function_Yield_()
+#define FARAABIN_Function_CoroutineEnd_()
 #endif
 
 #if !defined(FB_FEATURE_FLAG_MCU_CLI) || !defined(FARAABIN_ENABLE)
@@ -149,6 +170,16 @@ void __faraabin_vartype_member_func_##typeName_(void) {\
 #define FARAABIN_VAR_TYPE_STRUCT_FUNC_START_(typeName_)
 #define FARAABIN_VAR_TYPE_STRUCT_FUNC_END_(typeName_) }
 #define FARAABIN_VAR_TYPE_STRUCT_MEMBER_(memberType_, memberName_, memberArrayQty_)
+#define FARAABIN_VAR_TYPE_LAYOUT_DEF_(typeName_)
+#define FARAABIN_VAR_TYPE_LAYOUT_FUNC_(typeName_) \
+void __faraabin_vartype_layout_func_##typeName_(void) {\
+  (void)__faraabin_vartype_layout_func_##typeName_;
+#define FARAABIN_VAR_TYPE_LAYOUT_FUNC_START_(typeName_)
+#define FARAABIN_VAR_TYPE_LAYOUT_FUNC_END_(typeName_) }
+#define FARAABIN_VAR_TYPE_LAYOUT_MEMBER_(memberType_, memberName_, memberArrayQty_)
+#define FARAABIN_VAR_TYPE_LAYOUT_SEND_FUNC_(typeName_)
+#define FARAABIN_VAR_TYPE_FIND_MEMBER_(typeName_, memberName_) (NULL)
+#define FARAABIN_VAR_TYPE_NEXT_CHANGED_MEMBER_(typeName_, snapshotA_, snapshotB_, fromIndex_) (0xFFFFU)
 #define FARAABIN_VAR_TYPE_ENUM_INIT_WP_(typeName_, path_)
 #define FARAABIN_VAR_TYPE_ENUM_INIT_(typeName_)
 #define FARAABIN_VAR_TYPE_ENUM_FUNC_(typeName_)\
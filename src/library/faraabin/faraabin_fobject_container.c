@@ -73,6 +73,19 @@
 
   @endcode
 
+  When FB_FEATURE_FLAG_SECTION_DICT is enabled, variables can also be registered at compile time.
+  Each FARAABIN_SECTION_VAR_x_() places a constant descriptor in "faraabin_dict" linker section.
+  Dictionary of these variables is streamed directly from flash and needs no container function.
+
+  @code
+
+  FARAABIN_SECTION_CONTAINER_DEF_(SectionContainer);
+
+  static float32_t TestVariable;
+  FARAABIN_SECTION_VAR_(SectionContainer, float32_t, TestVariable);
+
+  @endcode
+
   @endverbatim
  */
 
@@ -82,13 +95,27 @@
 #include "faraabin_fobject.h"
 #include "faraabin_database.h"
 #include "faraabin_link_serializer.h"
+#include "faraabin_config.h"
 
 /* Private define ------------------------------------------------------------*/
 /* Private macro -------------------------------------------------------------*/
 /* Private typedef -----------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+static uint16_t fCountSectionVars(const sFaraabinFobjectContainer *me);
+
 /* Variables -----------------------------------------------------------------*/
+#ifdef FB_FEATURE_FLAG_SECTION_DICT
+#if defined(__ICCARM__)
+#pragma section = "faraabin_dict"
+#elif defined(__CC_ARM) || defined(__ARMCC_VERSION)
+extern const sFaraabinSectionVarDict faraabin_dict$$Base[];
+extern const sFaraabinSectionVarDict faraabin_dict$$Limit[];
+#else
+extern const sFaraabinSectionVarDict __start_faraabin_dict[];
+extern const sFaraabinSectionVarDict __stop_faraabin_dict[];
+#endif
+#endif
 
 /*
 ===============================================================================
@@ -107,12 +134,14 @@ uint8_t fFaraabinFobjectContainer_Init(sFaraabinFobjectContainer *me) {
 		return 1;
 	}
   
+  me->_type = (uint8_t)eFO_TYPE_CONTAINER;
+  
   if(fFaraabinDatabase_AddDict((uint32_t)me) != 0U) {
     return 1;
   }
 	
 	me->_init = false;
-  me->_type = (uint8_t)eFO_TYPE_CONTAINER;
+  me->_sectionVarQty = fCountSectionVars(me);
   
   me->Enable = true;
 	me->_init = true;
@@ -124,10 +153,67 @@ uint8_t fFaraabinFobjectContainer_Init(sFaraabinFobjectContainer *me) {
   return 0;
 }
 
+/**
+ * @brief Returns the first variable descriptor in faraabin dictionary section.
+ * 
+ * @return begin Pointer to the first descriptor.
+ */
+const sFaraabinSectionVarDict* fFaraabinFobjectContainer_GetSectionVarBegin(void) {
+  
+#if !defined(FB_FEATURE_FLAG_SECTION_DICT)
+  return NULL;
+#elif defined(__ICCARM__)
+  return (const sFaraabinSectionVarDict*)__section_begin(FB_SECTION_DICT_NAME);
+#elif defined(__CC_ARM) || defined(__ARMCC_VERSION)
+  return faraabin_dict$$Base;
+#else
+  return __start_faraabin_dict;
+#endif
+}
+
+/**
+ * @brief Returns the end of variable descriptors in faraabin dictionary section.
+ * 
+ * @return end Pointer to one past the last descriptor.
+ */
+const sFaraabinSectionVarDict* fFaraabinFobjectContainer_GetSectionVarEnd(void) {
+  
+#if !defined(FB_FEATURE_FLAG_SECTION_DICT)
+  return NULL;
+#elif defined(__ICCARM__)
+  return (const sFaraabinSectionVarDict*)__section_end(FB_SECTION_DICT_NAME);
+#elif defined(__CC_ARM) || defined(__ARMCC_VERSION)
+  return faraabin_dict$$Limit;
+#else
+  return __stop_faraabin_dict;
+#endif
+}
+
 /*
 ===============================================================================
             ##### faraabin_fobject_container.c Private Functions #####
 ===============================================================================*/
-
+/**
+ * @brief Counts the variable descriptors of a container in faraabin dictionary section.
+ * 
+ * @note This is done once in initialization, so the number of dictionary frames of the container is known
+ *       without generating its dictionary.
+ * 
+ * @param me Pointer to the Container.
+ * @return qty Number of variable descriptors.
+ */
+static uint16_t fCountSectionVars(const sFaraabinFobjectContainer *me) {
+  
+  uint16_t qty = 0U;
+  const sFaraabinSectionVarDict *end = fFaraabinFobjectContainer_GetSectionVarEnd();
+  
+  for(const sFaraabinSectionVarDict *var = fFaraabinFobjectContainer_GetSectionVarBegin(); var < end; var++) {
+    if(var->Container == me) {
+      qty++;
+    }
+  }
+  
+  return qty;
+}
 
 /************************ © COPYRIGHT FaraabinCo *****END OF FILE****/
@@ -31,6 +31,12 @@ extern "C" {
 #include "faraabin_type.h"
 
 /* Exported defines ----------------------------------------------------------*/
+/**
+ * @brief Name of the linker section that keeps constant variable descriptors of containers.
+ * 
+ */
+#define FB_SECTION_DICT_NAME      "faraabin_dict"
+
 /* Exported macro ------------------------------------------------------------*/
 /* Exported types ------------------------------------------------------------*/
 /**
@@ -55,8 +61,36 @@ typedef struct {
   
   void(*fpContainerFunc)(uint8_t reqSeq);  /*!< Function pointer to the container function. */
   
+  uint16_t _sectionVarQty;                /*!< Number of variable descriptors of this container in faraabin dictionary section. */
+  
 }sFaraabinFobjectContainer;
 
+/**
+ * @brief Constant descriptor of a variable that is placed in faraabin dictionary section at compile time.
+ * 
+ * @note These descriptors are streamed directly from flash when dictionary of their container is sent.
+ * 
+ */
+typedef struct {
+  
+  const sFaraabinFobjectContainer *Container; /*!< Pointer to the container that owns this variable. */
+  
+  const char *Name;                           /*!< Name of the variable. */
+  
+  const char *Path;                           /*!< Path given to the variable. */
+  
+  const void *VarPtr;                         /*!< Pointer to the variable. */
+  
+  const void *VarTypePtr;                     /*!< Pointer to the variable type fobject. */
+  
+  uint32_t VarArrayQty;                       /*!< Number of elements if the variable is array. If not it is equal to '1'. */
+  
+  const void *AccessCallBack;                 /*!< Pointer to the access callback function of the variable. */
+  
+  bool _isPtr;                                /*!< Specifies a variable is whether pointer. */
+  
+}sFaraabinSectionVarDict;
+
 /* Exported constants --------------------------------------------------------*/
 /* Exported functions prototypes ---------------------------------------------*/
 /**
@@ -67,6 +101,20 @@ typedef struct {
  */
 uint8_t fFaraabinFobjectContainer_Init(sFaraabinFobjectContainer *me);
 
+/**
+ * @brief Returns the first variable descriptor in faraabin dictionary section.
+ * 
+ * @return begin Pointer to the first descriptor.
+ */
+const sFaraabinSectionVarDict* fFaraabinFobjectContainer_GetSectionVarBegin(void);
+
+/**
+ * @brief Returns the end of variable descriptors in faraabin dictionary section.
+ * 
+ * @return end Pointer to one past the last descriptor.
+ */
+const sFaraabinSectionVarDict* fFaraabinFobjectContainer_GetSectionVarEnd(void);
+
 /* Exported variables --------------------------------------------------------*/
 
 #ifdef __cplusplus
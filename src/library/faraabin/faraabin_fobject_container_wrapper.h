@@ -112,6 +112,92 @@ extern "C" {
  */
 #define FARAABIN_Container_Init_(pContainer_) FARAABIN_Container_Init_WithPath_(pContainer_, RootPath____)
 
+/**
+ * @brief Defines a container that has no container function. Its variables are registered at compile time
+ *        with FARAABIN_SECTION_VAR_x_() macros and streamed directly from flash.
+ * 
+ * @param containerName_ Name of the Container.
+ */
+#define FARAABIN_SECTION_CONTAINER_DEF_(containerName_) \
+  sFaraabinFobjectContainer containerName_ = \
+  {\
+    .Name = #containerName_,\
+    .fpContainerFunc = NULL,\
+  }
+
+/**
+ * @brief Defines a static container that has no container function.
+ * 
+ * @param containerName_ Name of the Container.
+ */
+#define FARAABIN_SECTION_CONTAINER_DEF_STATIC_(containerName_) \
+  static sFaraabinFobjectContainer containerName_ = \
+  {\
+    .Name = #containerName_,\
+    .fpContainerFunc = NULL,\
+  }
+
+#ifdef FB_FEATURE_FLAG_SECTION_DICT
+
+/**
+ * @brief Places a constant descriptor in faraabin dictionary section and keeps it from being removed by the linker.
+ * 
+ * @note GCC needs the section to be kept in linker script (see STM32F103C8TX_FLASH.ld). IAR needs "keep { section faraabin_dict };"
+ *       in the .icf file. ARM compiler keeps the section with "used" attribute and creates faraabin_dict$$Base/$$Limit symbols.
+ * 
+ */
+#if defined(__ICCARM__)
+#define FB_SECTION_DICT_ATTR_     _Pragma("location=\"faraabin_dict\"") __root
+#elif defined(__CC_ARM) || defined(__ARMCC_VERSION) || defined(__GNUC__)
+#define FB_SECTION_DICT_ATTR_     __attribute__((used, section(FB_SECTION_DICT_NAME)))
+#else
+#error "Faraabin section dictionary is not supported for this compiler."
+#endif
+
+/**
+ * @brief Helpers for creating a unique name for each descriptor in faraabin dictionary section.
+ * 
+ */
+#define FB_SECTION_DICT_CONCAT_(a_, b_)   a_##b_
+#define FB_SECTION_DICT_UNIQUE_(a_, b_)   FB_SECTION_DICT_CONCAT_(a_, b_)
+
+/**
+ * @brief This is the main macro for placing a constant variable descriptor in faraabin dictionary section.
+ * 
+ * @note It must be used at file scope and at most once per line. Container can also have a container function.
+ * 
+ */
+#define FARAABIN_SECTION_VAR_DICT_(containerName_, varType_, varName_, pVar_, arrayQty_, isPtr_, fpAccessCb_, path_) \
+  FB_SECTION_DICT_ATTR_ static const sFaraabinSectionVarDict FB_SECTION_DICT_UNIQUE_(__faraabin_section_var_, __LINE__) = \
+  {\
+    .Container = &(containerName_),\
+    .Name = #varName_,\
+    .Path = path_,\
+    .VarPtr = pVar_,\
+    .VarTypePtr = &__faraabin_vartype_##varType_,\
+    .VarArrayQty = arrayQty_,\
+    .AccessCallBack = (const void*)(fpAccessCb_),\
+    ._isPtr = isPtr_,\
+  }
+
+/**
+ * @brief Registers variables of a container in faraabin dictionary section.
+ * 
+ * @param containerName_ Name of the container that owns the variable.
+ * @param varType_ Type of the variable. It can be any primitive or user defined type that has a var type fobject.
+ * @param varName_ Name of the variable.
+ * @param fpAccessCb_ Pointer to the access callback function.
+ * @param path_ Path given to the variable.
+ */
+#define FARAABIN_SECTION_VAR_(containerName_, varType_, varName_)                             FARAABIN_SECTION_VAR_DICT_(containerName_, varType_, varName_, &(varName_), 1U, false, NULL, NULL)
+#define FARAABIN_SECTION_VAR_WP_(containerName_, varType_, varName_, path_)                   FARAABIN_SECTION_VAR_DICT_(containerName_, varType_, varName_, &(varName_), 1U, false, NULL, path_)
+#define FARAABIN_SECTION_VAR_CB_WP_(containerName_, varType_, varName_, fpAccessCb_, path_)   FARAABIN_SECTION_VAR_DICT_(containerName_, varType_, varName_, &(varName_), 1U, false, fpAccessCb_, path_)
+#define FARAABIN_SECTION_VAR_ARRAY_(containerName_, varType_, varName_)                       FARAABIN_SECTION_VAR_DICT_(containerName_, varType_, varName_, &(varName_), (sizeof(varName_) / sizeof(varType_)), false, NULL, NULL)
+#define FARAABIN_SECTION_VAR_ARRAY_WP_(containerName_, varType_, varName_, path_)             FARAABIN_SECTION_VAR_DICT_(containerName_, varType_, varName_, &(varName_), (sizeof(varName_) / sizeof(varType_)), false, NULL, path_)
+#define FARAABIN_SECTION_VAR_ARRAY_CB_WP_(containerName_, varType_, varName_, fpAccessCb_, path_) FARAABIN_SECTION_VAR_DICT_(containerName_, varType_, varName_, &(varName_), (sizeof(varName_) / sizeof(varType_)), false, fpAccessCb_, path_)
+
+#endif
+
 /**
  * @brief For support of legacy macros
  * 
@@ -56,8 +56,22 @@
 #include "faraabin_internal.h"
 
 #include <stdlib.h>
+#include <string.h>
+#include <math.h>
 
 /* Private define ------------------------------------------------------------*/
+/**
+ * @brief Size of the header of each channel in block value frame: type(1), pointer(4), item size(2) and sample quantity(2).
+ * 
+ */
+#define DB_BLOCK_CH_HEADER_SIZE (9U)
+
+/**
+ * @brief Size of the header of each channel in stream value frame: type(1), pointer(4) and item size(2).
+ * 
+ */
+#define DB_STREAM_CH_HEADER_SIZE (7U)
+
 /* Private macro -------------------------------------------------------------*/
 /**
  * @brief Increments the number of items in databus queue.
@@ -71,17 +85,27 @@
  */
 #define DECREMENT_COUNT_() me->QueueItemCount--
 
+/**
+ * @brief Wraps an index of the databus queue that is less than two times of the queue size.
+ * 
+ * @note Power of two queues are wrapped with a mask, other sizes with compare and subtract. No division is used.
+ * 
+ * @param index_ Index to be wrapped.
+ */
+#define WRAP_INDEX_(index_) \
+  ((me->_queueMask != 0U) ? ((index_) & me->_queueMask) : (((index_) >= me->BufferCaptureSize) ? ((index_) - me->BufferCaptureSize) : (index_)))
+
 /**
  * @brief Increments rear (tail) index of the databus queue.
  * 
  */
-#define INCREMENT_REAR_INDEX_()    me->_queueRearIndex = (me->_queueRearIndex + 1) % me->BufferCaptureSize
+#define INCREMENT_REAR_INDEX_()    me->_queueRearIndex = WRAP_INDEX_(me->_queueRearIndex + 1U)
 
 /**
  * @brief Increments front (head) index of the databus queue.
  * 
  */
-#define INCREMENT_FRONT_INDEX_()   me->_queueFrontIndex   = (me->_queueFrontIndex + 1) % me->BufferCaptureSize
+#define INCREMENT_FRONT_INDEX_()   me->_queueFrontIndex   = WRAP_INDEX_(me->_queueFrontIndex + 1U)
 
 /**
  * @brief Write an item in the databus capture buffer.
@@ -89,14 +113,7 @@
  * @param index_ Index of the item in capture buffer.
  * @param item_ Item to be added to the capture buffer.
  */
-#define WRITE_ELEMENT_(index_, item_) \
-  do { \
-    offset = (index_) * sizeof(sFaraabinFobjectDataBus_CaptureValue); \
-    for(uint32_t i=0; i<sizeof(sFaraabinFobjectDataBus_CaptureValue); i++) { \
-      uint8_t *tmp = (uint8_t*)me->_pBufferCapture;\
-      tmp[offset + i] = (item_)[i]; \
-    } \
-  }while(0)
+#define WRITE_ELEMENT_(index_, item_) me->_pBufferCapture[(index_)] = *(item_)
 
 /**
  * @brief Reads an item from capture buffer.
@@ -104,25 +121,27 @@
  * @param index_ Index of the item in capture buffer.
  * @param item_ Placeholder of the item to copy the read value.
  */
-#define READ_ELEMENT_(index_, item_) \
-  do { \
-    offset = (index_) * sizeof(sFaraabinFobjectDataBus_CaptureValue); \
-    for(uint32_t i=0; i<sizeof(sFaraabinFobjectDataBus_CaptureValue); i++) { \
-      uint8_t *tmp = (uint8_t*)me->_pBufferCapture;\
-      item_[i] = tmp[offset + i]; \
-    } \
-  }while(0)
+#define READ_ELEMENT_(index_, item_) *(item_) = me->_pBufferCapture[(index_)]
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
 static void fQueueClear(sFaraabinFobjectDataBus * const me);
-static void fQueueInsert(sFaraabinFobjectDataBus * const me, uint8_t *item);
-static uint8_t fQueueRead(sFaraabinFobjectDataBus * const me, uint32_t num, uint8_t *item);
+static void fQueueInsert(sFaraabinFobjectDataBus * const me, sFaraabinFobjectDataBus_CaptureValue *item);
+static uint8_t fQueueRead(sFaraabinFobjectDataBus * const me, uint32_t num, sFaraabinFobjectDataBus_CaptureValue *item);
 
 static void fRunCapture(sFaraabinFobjectDataBus *me);
 static void fDetectChannelTrig(sFaraabinFobjectDataBus *me);
 
+static void fRunAggregate(sFaraabinFobjectDataBus *me);
+static void fResetAggregate(sFaraabinFobjectDataBus_Channel *ch);
+static uint8_t fGetPrimitiveSize(uint8_t primitiveId);
+static bool fReadValueF64(uint8_t primitiveId, uint8_t *src, float64_t *value);
+static uint16_t fPrepareStreamReport(sFaraabinFobjectDataBus *me);
+static bool fIsChannelChanged(sFaraabinFobjectDataBus_Channel *ch);
+static void fResetChannelMode(sFaraabinFobjectDataBus *me, sFaraabinFobjectDataBus_Channel *ch);
+static void fSendBlockData(sFaraabinFobjectDataBus *me);
+
 static void fFreeAllocatedMemory(sFaraabinFobjectDataBus * const me);
 
 /* Variables -----------------------------------------------------------------*/
@@ -144,12 +163,13 @@ uint8_t fFaraabinFobjectDataBus_Init(sFaraabinFobjectDataBus *me) {
 		return 1;
 	}
   
+  me->_type = (uint8_t)eFO_TYPE_DATABUS;
+  
   if(fFaraabinDatabase_AddDict((uint32_t)me) != 0U) {
     return 1;
   }
 	
 	me->_init = false;
-	me->_type = (uint8_t)eFO_TYPE_DATABUS;
   
   if(me->ChannelQty == 0U) {
     return 1;
@@ -176,6 +196,20 @@ uint8_t fFaraabinFobjectDataBus_Init(sFaraabinFobjectDataBus *me) {
     me->_pBufferChannels[i].VariableDataType = 0U;
     me->_pBufferChannels[i].PrimitiveVariableId = 0U;
     me->_pBufferChannels[i].Enable = false;
+    me->_pBufferChannels[i].SliceStride = 0U;
+    me->_pBufferChannels[i].SliceQty = 0U;
+    me->_pBufferChannels[i].AggregateMode = (uint8_t)eDATABUS_CH_AGGREGATE_NONE;
+    fResetAggregate(&me->_pBufferChannels[i]);
+    me->_pBufferChannels[i]._blockFifo._pBuffer = NULL;
+    me->_pBufferChannels[i]._blockFifo._mask = 0U;
+    me->_pBufferChannels[i]._blockFifo._head = 0U;
+    me->_pBufferChannels[i]._blockFifo._tail = 0U;
+    me->_pBufferChannels[i]._blockFifo._sendQty = 0U;
+    me->_pBufferChannels[i]._blockFifo.OverflowCnt = 0U;
+    me->_pBufferChannels[i].ReportMode = (uint8_t)eDATABUS_CH_REPORT_ALWAYS;
+    me->_pBufferChannels[i].Deadband = 0.0;
+    me->_pBufferChannels[i]._lastReported.U64 = 0U;
+    me->_pBufferChannels[i]._isReportDue = false;
     
   }
   
@@ -202,6 +236,12 @@ uint8_t fFaraabinFobjectDataBus_Init(sFaraabinFobjectDataBus *me) {
   me->QueueItemCount = 0U;
   me->_queueFrontIndex = 0U;
   me->_queueRearIndex = 0U;
+  me->_queueMask = 0U;
+  if((me->BufferCaptureSize > 1U) && ((me->BufferCaptureSize & (me->BufferCaptureSize - 1U)) == 0U)) {
+    me->_queueMask = me->BufferCaptureSize - 1U;
+  }
+  me->_captureSendCursor._index = 0U;
+  me->_captureSendCursor._remaining = 0U;
   
   me->CurrentState = eDATABUS_STATE_OFF;
   
@@ -210,6 +250,12 @@ uint8_t fFaraabinFobjectDataBus_Init(sFaraabinFobjectDataBus *me) {
   
   me->AttachedItemsQty = 0U;
   me->AvailableItemsQty = 0U;
+  me->_aggregatedItemsQty = 0U;
+  me->_blockItemsQty = 0U;
+  me->_blockChIndex = 0U;
+  me->_reportItemsQty = 0U;
+  me->_keepaliveCnt = 0U;
+  me->_isReportForced = true;
   me->CaptureSendingQty = 0U;
 
   fChrono_Start(&me->_chronoCycle);
@@ -277,10 +323,25 @@ void fFaraabinFobjectDataBus_Run(sFaraabinFobjectDataBus *me)  {
     }
     
     case eDATABUS_STATE_STREAM: {
+      
+      if(me->_aggregatedItemsQty != 0U) {
+        fRunAggregate(me);
+      }
 			
       RUN_EVERY_QTY_OBJ_(me->StreamDivideBy, me->_streamDivbyCnt) {
         
-        fFaraabinLinkSerializer_DataBusSendValue((uint32_t)me, &me->Seq, 0, false);
+        if(fPrepareStreamReport(me) != 0U) {
+          fFaraabinLinkSerializer_DataBusSendValue((uint32_t)me, &me->Seq, 0, false);
+        }
+        
+        if(me->_aggregatedItemsQty != 0U) {
+          
+          fFaraabinLinkSerializer_DataBusSendAggregateValue((uint32_t)me, &me->Seq, 0, false);
+          
+          for(uint16_t i = 0U; i < me->ChannelQty; i++) {
+            fResetAggregate(&me->_pBufferChannels[i]);
+          }
+        }
         
         RUN_END_;
       }
@@ -401,7 +462,7 @@ void fFaraabinFobjectDataBus_SendCaptureDataRun(sFaraabinFobjectDataBus *me) {
 
         sFaraabinFobjectDataBus_CaptureValue tmp_capture;
         
-        uint8_t ret = fQueueRead(me, me->CaptureSendingCnt, (uint8_t*)&tmp_capture);
+        uint8_t ret = fFaraabinFobjectDataBus_CaptureCursorNext(me, &me->_captureSendCursor, &tmp_capture);
         if(ret == 0U) {
           
           fFaraabinLinkSerializer_DataBusSendCaptureValue(
@@ -431,6 +492,15 @@ void fFaraabinFobjectDataBus_SendCaptureDataRun(sFaraabinFobjectDataBus *me) {
 
       break;
     }
+    
+    case eDATABUS_STATE_STREAM: {
+      
+      if(me->_blockItemsQty != 0U) {
+        fSendBlockData(me);
+      }
+      
+      break;
+    }
 
     default: {
 
@@ -637,6 +707,14 @@ void fFaraabinFobjectDataBus_StartStream(sFaraabinFobjectDataBus *me) {
     return;
   }
   
+  for(uint16_t i = 0U; i < me->ChannelQty; i++) {
+    fResetAggregate(&me->_pBufferChannels[i]);
+    me->_pBufferChannels[i]._blockFifo._tail = me->_pBufferChannels[i]._blockFifo._head;
+  }
+  
+  me->_keepaliveCnt = 0U;
+  me->_isReportForced = true;
+  
   me->CurrentState = eDATABUS_STATE_STREAM;
   
 }
@@ -809,7 +887,50 @@ uint8_t fFaraabinFobjectDataBus_GetCaptureData(sFaraabinFobjectDataBus *me, uint
     return FARAABIN_DB_CHANNEL_INDEX_GREATER_THAN_MAX;
   }
   
-  return fQueueRead(me, index, (uint8_t*)&value);
+  return fQueueRead(me, index, value);
+}
+
+/**
+ * @brief Starts a sequential read of the captured data from the oldest item.
+ * 
+ * @param me Pointer to the databus fobject.
+ * @param cursor Pointer to the cursor.
+ * @return result Could be one of items in FARAABIN_DB_RET group.
+ */
+uint8_t fFaraabinFobjectDataBus_CaptureCursorBegin(sFaraabinFobjectDataBus *me, sFaraabinFobjectDataBus_CaptureCursor *cursor) {
+
+  if(!me->_init) {
+    return FARAABIN_DB_NOT_INIT;
+  }
+  
+  cursor->_index = me->_queueFrontIndex;
+  cursor->_remaining = me->QueueItemCount;
+  
+  return FARAABIN_DB_OK;
+}
+
+/**
+ * @brief Reads the next captured item and advances the cursor.
+ * 
+ * @note Prefer this function over fFaraabinFobjectDataBus_GetCaptureData() when uploading the whole capture buffer.
+ * 
+ * @param me Pointer to the databus fobject.
+ * @param cursor Pointer to the cursor started by fFaraabinFobjectDataBus_CaptureCursorBegin().
+ * @param value Pointer to the captured value.
+ * @return result FARAABIN_DB_QUEUE_EMPTY when all items are read. Could be one of items in FARAABIN_DB_RET group.
+ */
+uint8_t fFaraabinFobjectDataBus_CaptureCursorNext(sFaraabinFobjectDataBus *me, sFaraabinFobjectDataBus_CaptureCursor *cursor, sFaraabinFobjectDataBus_CaptureValue *value) {
+  
+  if(cursor->_remaining == 0U) {
+    return FARAABIN_DB_QUEUE_EMPTY;
+  }
+  
+  READ_ELEMENT_(cursor->_index, value);
+  
+  cursor->_index = WRAP_INDEX_(cursor->_index + 1U);
+  cursor->_remaining--;
+  
+  return FARAABIN_DB_OK;
 }
 
 /**
@@ -883,6 +1004,8 @@ uint8_t fFaraabinFobjectDataBus_AttachVariableToChannel(
   me->_pBufferChannels[channel].VariableDataType = varTypeArchitecture;
   me->_pBufferChannels[channel].PrimitiveVariableId = varPrimitiveId;
   me->_pBufferChannels[channel].Enable = true;
+  
+  fResetChannelMode(me, &me->_pBufferChannels[channel]);
 
   me->AttachedItemsQty++;
   me->AvailableItemsQty++;
@@ -890,6 +1013,87 @@ uint8_t fFaraabinFobjectDataBus_AttachVariableToChannel(
   return FARAABIN_DB_OK;
 }
 
+/**
+ * @brief Attaches a strided slice of a buffer to the first free channel of the databus.
+ * 
+ * @note Elements are read in place at sliceBase + k * stride (k = 0 .. qty - 1) and streamed as a packed vector,
+ *       so one field of a struct array or every k-th element of a buffer can be streamed without a shadow copy.
+ * @note Capture modes (timer and trigger) only sample the first element of the slice.
+ * @note Stride and quantity of slice channels are reported in eFO_DB_PROP_ID_SETTING_CH_SLICE frame, not in the setting frame.
+ * 
+ * @param me Pointer to the databus fobject.
+ * @param sliceBase Pointer to the first element of the slice.
+ * @param elemSize Size of each element in bytes.
+ * @param stride Distance between two consecutive elements in bytes. Must not be less than elemSize.
+ * @param qty Number of elements in the slice. qty * elemSize must not exceed 65535 bytes and the stream frame
+ *            of the slice must fit TX buffer.
+ * @param varTypeArchitecture Architecture of the element type.
+ * @param varPrimitiveId ID of the element type if it is primitive.
+ * @return result Could be one of items in FARAABIN_DB_RET group.
+ */
+uint8_t fFaraabinFobjectDataBus_AttachVariableSlice(sFaraabinFobjectDataBus *me, uint32_t sliceBase, uint16_t elemSize, uint16_t stride, uint16_t qty, uint8_t varTypeArchitecture, uint8_t varPrimitiveId) {
+	
+	if(!FaraabinInit___) {
+		FaraabinFlags.Status.Bitfield.UninitializedFaraabin = 1;
+		return 1;
+	}
+
+  if(!me->_init) {
+    return FARAABIN_DB_NOT_INIT;
+  }
+
+  for(uint16_t i = 0U; i < me->ChannelQty; i++) {
+
+    if(me->_pBufferChannels[i].ItemFobjectPtr == 0U) {
+
+      return fFaraabinFobjectDataBus_AttachVariableSliceToChannel(me, i, sliceBase, elemSize, stride, qty, varTypeArchitecture, varPrimitiveId);
+    }
+  }
+
+  return FARAABIN_DB_IS_FULL;
+}
+
+/**
+ * @brief Attaches a strided slice of a buffer to a specific channel of the databus.
+ * 
+ * @param me Pointer to the databus fobject.
+ * @param channel Channel number of the databus.
+ * @param sliceBase Pointer to the first element of the slice.
+ * @param elemSize Size of each element in bytes.
+ * @param stride Distance between two consecutive elements in bytes. Must not be less than elemSize.
+ * @param qty Number of elements in the slice. qty * elemSize must not exceed 65535 bytes and the stream frame
+ *            of the slice must fit TX buffer.
+ * @param varTypeArchitecture Architecture of the element type.
+ * @param varPrimitiveId ID of the element type if it is primitive.
+ * @return result Could be one of items in FARAABIN_DB_RET group.
+ */
+uint8_t fFaraabinFobjectDataBus_AttachVariableSliceToChannel(sFaraabinFobjectDataBus *me, uint16_t channel, uint32_t sliceBase, uint16_t elemSize, uint16_t stride, uint16_t qty, uint8_t varTypeArchitecture, uint8_t varPrimitiveId) {
+  
+  if((qty == 0U) || (elemSize == 0U) || (stride < elemSize)) {
+    return FARAABIN_DB_SLICE_ERROR;
+  }
+  
+  // Packed vector of the slice is sent with a 16-bit size and must fit TX buffer in a single frame.
+  uint32_t packedSize = (uint32_t)elemSize * qty;
+  if(packedSize > UINT16_MAX) {
+    return FARAABIN_DB_SLICE_ERROR;
+  }
+  
+  if(fFaraabinLinkSerializer_GetFrameSizeMax(DB_STREAM_CH_HEADER_SIZE + packedSize) > fFaraabinLinkSerializer_GetTxSize()) {
+    return FARAABIN_DB_SLICE_ERROR;
+  }
+  
+  uint8_t result = fFaraabinFobjectDataBus_AttachVariableToChannel(me, channel, sliceBase, elemSize, varTypeArchitecture, varPrimitiveId, (uint8_t)eFO_TYPE_VAR);
+  if(result != FARAABIN_DB_OK) {
+    return result;
+  }
+  
+  me->_pBufferChannels[channel].SliceStride = stride;
+  me->_pBufferChannels[channel].SliceQty = qty;
+  
+  return FARAABIN_DB_OK;
+}
+
 /**
  * @brief Attaches an entity item to a channel of the databus.
  * 
@@ -930,6 +1134,8 @@ uint8_t fFaraabinFobjectDataBus_AttachEntityNumericalToChannel(sFaraabinFobjectD
   me->_pBufferChannels[channel].VariableDataType = varTypeArchitecture;
   me->_pBufferChannels[channel].PrimitiveVariableId = varPrimitiveId;
   me->_pBufferChannels[channel].Enable = true;
+  
+  fResetChannelMode(me, &me->_pBufferChannels[channel]);
 
   me->AttachedItemsQty++;
   me->AvailableItemsQty++;
@@ -937,6 +1143,46 @@ uint8_t fFaraabinFobjectDataBus_AttachEntityNumericalToChannel(sFaraabinFobjectD
   return FARAABIN_DB_OK;
 }
 
+/**
+ * @brief Attaches one member of a structure variable to a channel of the databus.
+ * 
+ * @note The member is looked up by name in the constant layout table of the variable type,
+ *       so no dictionary callback is needed. Only members of primitive types can be attached.
+ * 
+ * @param me Pointer to the databus fobject.
+ * @param channel Channel number of the databus.
+ * @param structPtr Pointer to the structure variable.
+ * @param varType Pointer to the varType fobject of the structure (with a layout table).
+ * @param memberName Name of the member.
+ * @return result Could be one of items in FARAABIN_DB_RET group.
+ */
+uint8_t fFaraabinFobjectDataBus_AttachStructMemberToChannel(sFaraabinFobjectDataBus *me, uint16_t channel, uint32_t structPtr, const sFaraabinFobjectVarType *varType, const char *memberName) {
+  
+  const sFaraabinFobjectVarType_Member *member;
+  
+  if((structPtr == 0U) || (varType == NULL)) {
+    return FARAABIN_DB_ACTION_WITH_NULL_REFERENCE;
+  }
+  
+  member = fFaraabinFobjectVarType_FindMember(varType, memberName);
+  if(member == NULL) {
+    return FARAABIN_DB_OBJECT_NOT_FOUND;
+  }
+  
+  if(member->VarType->DataType != eVAR_DATA_TYPE_PRIMITIVE) {
+    return FARAABIN_DB_OBJECT_NOT_FOUND;
+  }
+  
+  return fFaraabinFobjectDataBus_AttachVariableToChannel(
+    me,
+    channel,
+    structPtr + member->Offset,
+    member->Size,
+    (uint8_t)eVAR_DATA_TYPE_PRIMITIVE,
+    member->VarType->PrimitiveId,
+    (uint8_t)eFO_TYPE_VAR);
+}
+
 /**
  * @brief Attaches a code block fobject to a free channel of the databus so the code block can sends its data and events through it.
  * 
@@ -1007,6 +1253,8 @@ uint8_t fFaraabinFobjectDataBus_AttachCodeBlockToChannel(sFaraabinFobjectDataBus
   me->_pBufferChannels[channel].ItemFobjectType = (uint8_t)eFO_TYPE_CODE_BLOCK;
   me->_pBufferChannels[channel].ItemFobjectParam = 0U;
   me->_pBufferChannels[channel].Enable = true;
+  
+  fResetChannelMode(me, &me->_pBufferChannels[channel]);
 
   me->AttachedItemsQty++;
   me->AvailableItemsQty++;
@@ -1052,6 +1300,8 @@ uint8_t fFaraabinFobjectDataBus_DetachFromChannel(sFaraabinFobjectDataBus *me, u
   me->_pBufferChannels[channel].ItemFobjectPtr = 0U;
   me->_pBufferChannels[channel].ItemFobjectType = 0U;
   me->_pBufferChannels[channel].Enable = false;
+  
+  fResetChannelMode(me, &me->_pBufferChannels[channel]);
 
   me->AttachedItemsQty--;
   me->AvailableItemsQty--;
@@ -1089,10 +1339,291 @@ uint8_t fFaraabinFobjectDataBus_DetachAllChannels(sFaraabinFobjectDataBus *me) {
 
   me->AttachedItemsQty = 0U;
   me->AvailableItemsQty = 0U;
+  me->_aggregatedItemsQty = 0U;
+  me->_blockItemsQty = 0U;
+  me->_reportItemsQty = 0U;
+
+  return FARAABIN_DB_OK;
+}
+
+/**
+ * @brief Sets the aggregation mode of a databus channel in stream state.
+ * 
+ * @note In aggregation mode the channel is sampled on every call of fFaraabinFobjectDataBus_Run() and
+ *       min/max/mean (and optionally RMS) of each StreamDivideBy window are streamed instead of the last sample.
+ *       Only channels attached to a single primitive numerical variable can be aggregated.
+ * 
+ * @param me Pointer to the databus fobject.
+ * @param channel Channel number of the databus.
+ * @param mode Aggregation mode. Could be one of eFaraabinFobjectDataBus_ChAggregate values.
+ * @return result Could be one of items in FARAABIN_DB_RET group.
+ */
+uint8_t fFaraabinFobjectDataBus_SetChannelAggregate(sFaraabinFobjectDataBus *me, uint16_t channel, eFaraabinFobjectDataBus_ChAggregate mode) {
+	
+	if(!FaraabinInit___) {
+		FaraabinFlags.Status.Bitfield.UninitializedFaraabin = 1;
+		return 1;
+	}
+
+  if(!me->_init) {
+    return FARAABIN_DB_NOT_INIT;
+  }
+
+  if(channel >= me->ChannelQty) {
+    return FARAABIN_DB_CHANNEL_INDEX_GREATER_THAN_MAX;
+  }
+  
+  sFaraabinFobjectDataBus_Channel *ch = &me->_pBufferChannels[channel];
+  
+  if(ch->ItemFobjectPtr == 0U) {
+    return FARAABIN_DB_ACTION_WITH_NULL_REFERENCE;
+  }
+  
+  if((uint32_t)mode > (uint32_t)eDATABUS_CH_AGGREGATE_ENVELOPE_RMS) {
+    return FARAABIN_DB_PARAM_ERROR;
+  }
+  
+  if(mode != eDATABUS_CH_AGGREGATE_NONE) {
+    
+    if((ch->ItemFobjectType != (uint8_t)eFO_TYPE_VAR) && (ch->ItemFobjectType != (uint8_t)eFO_TYPE_ENTITY_NUMERICAL)) {
+      return FARAABIN_DB_CHANNEL_NOT_AGGREGATABLE;
+    }
+    
+    if(ch->VariableDataType != (uint8_t)eVAR_DATA_TYPE_PRIMITIVE) {
+      return FARAABIN_DB_CHANNEL_NOT_AGGREGATABLE;
+    }
+    
+    if((ch->_blockFifo._mask != 0U) || (ch->SliceQty != 0U) || (ch->ReportMode != (uint8_t)eDATABUS_CH_REPORT_ALWAYS)) {
+      return FARAABIN_DB_CHANNEL_NOT_AGGREGATABLE;
+    }
+    
+    if((ch->PrimitiveVariableId == (uint8_t)eVAR_DATA_TYPE_PRIMITIVE_BOOL) ||
+       (fGetPrimitiveSize(ch->PrimitiveVariableId) != ch->ItemFobjectParam)) {
+      return FARAABIN_DB_CHANNEL_NOT_AGGREGATABLE;
+    }
+  }
+  
+  FARAABIN_CRITICIAL_ENTER_;
+  
+  if((ch->AggregateMode == (uint8_t)eDATABUS_CH_AGGREGATE_NONE) && (mode != eDATABUS_CH_AGGREGATE_NONE)) {
+    me->_aggregatedItemsQty++;
+  } else if((ch->AggregateMode != (uint8_t)eDATABUS_CH_AGGREGATE_NONE) && (mode == eDATABUS_CH_AGGREGATE_NONE)) {
+    me->_aggregatedItemsQty--;
+  } else {
+    // Do nothing.
+  }
+  
+  ch->AggregateMode = (uint8_t)mode;
+  fResetAggregate(ch);
+  
+  FARAABIN_CRITICIAL_EXIT_;
+  
+  return FARAABIN_DB_OK;
+}
+
+/**
+ * @brief Sets the report mode of a databus channel in stream state.
+ * 
+ * @note In report by exception modes the channel is only packed into the stream frame when it has changed since
+ *       the last report, or every KeepaliveDivideBy stream frames. Deadband modes need a primitive numerical item.
+ * 
+ * @param me Pointer to the databus fobject.
+ * @param channel Channel number of the databus.
+ * @param mode Report mode. Could be one of eFaraabinFobjectDataBus_ChReport values.
+ * @param deadband Absolute (or relative ratio) deadband. Must not be negative or NaN. Ignored in other modes.
+ * @return result Could be one of items in FARAABIN_DB_RET group.
+ */
+uint8_t fFaraabinFobjectDataBus_SetChannelReport(sFaraabinFobjectDataBus *me, uint16_t channel, eFaraabinFobjectDataBus_ChReport mode, float64_t deadband) {
+	
+	if(!FaraabinInit___) {
+		FaraabinFlags.Status.Bitfield.UninitializedFaraabin = 1;
+		return 1;
+	}
+
+  if(!me->_init) {
+    return FARAABIN_DB_NOT_INIT;
+  }
+
+  if(channel >= me->ChannelQty) {
+    return FARAABIN_DB_CHANNEL_INDEX_GREATER_THAN_MAX;
+  }
+  
+  sFaraabinFobjectDataBus_Channel *ch = &me->_pBufferChannels[channel];
+  
+  if(ch->ItemFobjectPtr == 0U) {
+    return FARAABIN_DB_ACTION_WITH_NULL_REFERENCE;
+  }
+  
+  if((uint32_t)mode > (uint32_t)eDATABUS_CH_REPORT_DEADBAND_REL) {
+    return FARAABIN_DB_PARAM_ERROR;
+  }
+  
+  if(mode != eDATABUS_CH_REPORT_ALWAYS) {
+    
+    if((ch->ItemFobjectType != (uint8_t)eFO_TYPE_VAR) && (ch->ItemFobjectType != (uint8_t)eFO_TYPE_ENTITY_NUMERICAL)) {
+      return FARAABIN_DB_CHANNEL_NOT_REPORTABLE;
+    }
+    
+    if((ch->ItemFobjectParam > sizeof(ch->_lastReported)) || (ch->SliceQty != 0U)) {
+      return FARAABIN_DB_CHANNEL_NOT_REPORTABLE;
+    }
+    
+    if((ch->AggregateMode != (uint8_t)eDATABUS_CH_AGGREGATE_NONE) || (ch->_blockFifo._mask != 0U)) {
+      return FARAABIN_DB_CHANNEL_NOT_REPORTABLE;
+    }
+    
+    if(mode != eDATABUS_CH_REPORT_ON_CHANGE) {
+      
+      float64_t tmp;
+      if((ch->VariableDataType != (uint8_t)eVAR_DATA_TYPE_PRIMITIVE) ||
+         (fGetPrimitiveSize(ch->PrimitiveVariableId) != ch->ItemFobjectParam) ||
+         (!fReadValueF64(ch->PrimitiveVariableId, (uint8_t*)ch->ItemFobjectPtr, &tmp))) {
+        return FARAABIN_DB_CHANNEL_NOT_REPORTABLE;
+      }
+      
+      // Also rejects NaN, which would never trigger a report.
+      if(!(deadband >= 0.0)) {
+        return FARAABIN_DB_PARAM_ERROR;
+      }
+    }
+  }
+  
+  FARAABIN_CRITICIAL_ENTER_;
+  
+  if((ch->ReportMode == (uint8_t)eDATABUS_CH_REPORT_ALWAYS) && (mode != eDATABUS_CH_REPORT_ALWAYS)) {
+    me->_reportItemsQty++;
+  } else if((ch->ReportMode != (uint8_t)eDATABUS_CH_REPORT_ALWAYS) && (mode == eDATABUS_CH_REPORT_ALWAYS)) {
+    me->_reportItemsQty--;
+  } else {
+    // Do nothing.
+  }
+  
+  ch->ReportMode = (uint8_t)mode;
+  ch->Deadband = deadband;
+  
+  // Next stream frame reports the new baseline of all channels.
+  me->_isReportForced = true;
+  
+  FARAABIN_CRITICIAL_EXIT_;
+  
+  return FARAABIN_DB_OK;
+}
+
+/**
+ * @brief Puts a databus channel in block sampling mode.
+ * 
+ * @note In block mode samples are pushed by fFaraabinFobjectDataBus_PushBlockSample() and sent in blocks
+ *       of half of the FIFO capacity from fFaraabin_Run() while the databus is in stream state.
+ *       Frame of a block (half of sampleQty * elemSize bytes) must fit faraabin TX buffer.
+ *       Passing NULL buffer or zero sampleQty returns the channel to normal stream mode.
+ * 
+ * @param me Pointer to the databus fobject.
+ * @param channel Channel number of the databus.
+ * @param buffer Pointer to the sample buffer. Its size must be sampleQty * elemSize bytes.
+ * @param elemSize Size of each sample in bytes. Must be equal to the size of the attached item.
+ * @param sampleQty Capacity of the FIFO in samples. Must be a power of two between 2 and 32768.
+ * @return result Could be one of items in FARAABIN_DB_RET group.
+ */
+uint8_t fFaraabinFobjectDataBus_SetChannelBlockFifo(sFaraabinFobjectDataBus *me, uint16_t channel, uint8_t *buffer, uint16_t elemSize, uint16_t sampleQty) {
+	
+	if(!FaraabinInit___) {
+		FaraabinFlags.Status.Bitfield.UninitializedFaraabin = 1;
+		return 1;
+	}
 
+  if(!me->_init) {
+    return FARAABIN_DB_NOT_INIT;
+  }
+
+  if(channel >= me->ChannelQty) {
+    return FARAABIN_DB_CHANNEL_INDEX_GREATER_THAN_MAX;
+  }
+  
+  sFaraabinFobjectDataBus_Channel *ch = &me->_pBufferChannels[channel];
+  
+  if(ch->ItemFobjectPtr == 0U) {
+    return FARAABIN_DB_ACTION_WITH_NULL_REFERENCE;
+  }
+  
+  bool enable = (buffer != NULL) && (sampleQty != 0U);
+  
+  if(enable) {
+    
+    if((ch->ItemFobjectType != (uint8_t)eFO_TYPE_VAR) && (ch->ItemFobjectType != (uint8_t)eFO_TYPE_ENTITY_NUMERICAL)) {
+      return FARAABIN_DB_BLOCK_FIFO_ERROR;
+    }
+    
+    if((elemSize != ch->ItemFobjectParam) || (ch->SliceQty != 0U)) {
+      return FARAABIN_DB_BLOCK_FIFO_ERROR;
+    }
+    
+    if((sampleQty < 2U) || (sampleQty > 32768U) || ((sampleQty & (sampleQty - 1U)) != 0U)) {
+      return FARAABIN_DB_BLOCK_FIFO_ERROR;
+    }
+    
+    // Each block is half of the FIFO and must fit TX buffer in a single frame.
+    uint32_t blockSize = DB_BLOCK_CH_HEADER_SIZE + ((uint32_t)(sampleQty >> 1U) * elemSize);
+    if(fFaraabinLinkSerializer_GetFrameSizeMax(blockSize) > fFaraabinLinkSerializer_GetTxSize()) {
+      return FARAABIN_DB_BLOCK_FIFO_ERROR;
+    }
+  }
+  
+  FARAABIN_CRITICIAL_ENTER_;
+  
+  fResetChannelMode(me, ch);
+  
+  if(enable) {
+    
+    ch->_blockFifo._pBuffer = buffer;
+    ch->_blockFifo._head = 0U;
+    ch->_blockFifo._tail = 0U;
+    ch->_blockFifo._sendQty = 0U;
+    ch->_blockFifo.OverflowCnt = 0U;
+    ch->_blockFifo._mask = sampleQty - 1U;
+    
+    me->_blockItemsQty++;
+  }
+  
+  FARAABIN_CRITICIAL_EXIT_;
+  
   return FARAABIN_DB_OK;
 }
 
+/**
+ * @brief Pushes the current value of the item attached to a block mode channel into its FIFO.
+ * 
+ * @note This function is safe to be called from an ISR while fFaraabin_Run() is draining the FIFO.
+ * 
+ * @param me Pointer to the databus fobject.
+ * @param channel Channel number of the databus.
+ */
+void fFaraabinFobjectDataBus_PushBlockSample(sFaraabinFobjectDataBus *me, uint16_t channel) {
+  
+  if((me->CurrentState != eDATABUS_STATE_STREAM) || (channel >= me->ChannelQty)) {
+    return;
+  }
+  
+  sFaraabinFobjectDataBus_Channel *ch = &me->_pBufferChannels[channel];
+  sFaraabinFobjectDataBus_ChBlockFifo *fifo = &ch->_blockFifo;
+  
+  if((fifo->_mask == 0U) || (!ch->Enable)) {
+    return;
+  }
+  
+  uint16_t head = fifo->_head;
+  if((uint16_t)(head - fifo->_tail) > fifo->_mask) {
+    fifo->OverflowCnt++;
+    return;
+  }
+  
+  uint16_t size = ch->ItemFobjectParam;
+  memcpy(&fifo->_pBuffer[(uint32_t)(head & fifo->_mask) * size], (const void*)ch->ItemFobjectPtr, size);
+  
+  // Sample must be stored before the consumer sees the new head.
+  FARAABIN_MEMORY_BARRIER_;
+  fifo->_head = head + 1U;
+}
+
 /**
  * @brief Runs the interface for sending codeblock data through databus.
  * 
@@ -1157,7 +1688,7 @@ void fFaraabinFobjectDataBus_RunCodeBlock(uint32_t cbPtr, uint32_t startTick, ui
         tmp.U32[1] = endTick;
         tmp_capture.CapturedValue = tmp.U64;
         
-        fQueueInsert(db, (uint8_t*)&(tmp_capture));
+        fQueueInsert(db, &tmp_capture);
         
         FARAABIN_CRITICIAL_EXIT_;
 
@@ -1878,7 +2409,7 @@ static void fRunCapture(sFaraabinFobjectDataBus *me) {
           for(uint16_t j = 0; j < me->_pBufferChannels[i].ItemFobjectParam; j++) {
             dst[j] = src[j];
           }
-          fQueueInsert(me, (uint8_t*)&(tmp_capture));
+          fQueueInsert(me, &tmp_capture);
         }
     
         break;
@@ -1895,6 +2426,349 @@ static void fRunCapture(sFaraabinFobjectDataBus *me) {
   FARAABIN_CRITICIAL_EXIT_;
 }
 
+/**
+ * @brief Accumulates the current value of aggregated channels into their stream window.
+ * 
+ * @param me Pointer to the databus fobject.
+ */
+static void fRunAggregate(sFaraabinFobjectDataBus *me) {
+  
+  for(uint16_t i = 0U; i < me->ChannelQty; i++) {
+    
+    sFaraabinFobjectDataBus_Channel *ch = &me->_pBufferChannels[i];
+    
+    if(ch->AggregateMode == (uint8_t)eDATABUS_CH_AGGREGATE_NONE) {
+      continue;
+    }
+    
+    if(!ch->Enable) {
+      continue;
+    }
+    
+    float64_t value = 0.0;
+    if(!fReadValueF64(ch->PrimitiveVariableId, (uint8_t*)ch->ItemFobjectPtr, &value)) {
+      continue;
+    }
+    
+    if(ch->_aggregate.Cnt == 0U) {
+      
+      ch->_aggregate.Min = value;
+      ch->_aggregate.Max = value;
+      
+    } else {
+      
+      if(value < ch->_aggregate.Min) {
+        ch->_aggregate.Min = value;
+      }
+      if(value > ch->_aggregate.Max) {
+        ch->_aggregate.Max = value;
+      }
+    }
+    
+    ch->_aggregate.Sum += value;
+    if(ch->AggregateMode == (uint8_t)eDATABUS_CH_AGGREGATE_ENVELOPE_RMS) {
+      ch->_aggregate.SumSq += value * value;
+    }
+    
+    if(ch->_aggregate.Cnt < UINT16_MAX) {
+      ch->_aggregate.Cnt++;
+    }
+  }
+}
+
+/**
+ * @brief Returns a databus channel to normal stream mode.
+ * 
+ * @param me Pointer to the databus fobject.
+ * @param ch Pointer to the databus channel.
+ */
+static void fResetChannelMode(sFaraabinFobjectDataBus *me, sFaraabinFobjectDataBus_Channel *ch) {
+  
+  ch->SliceStride = 0U;
+  ch->SliceQty = 0U;
+  
+  if(ch->ReportMode != (uint8_t)eDATABUS_CH_REPORT_ALWAYS) {
+    ch->ReportMode = (uint8_t)eDATABUS_CH_REPORT_ALWAYS;
+    me->_reportItemsQty--;
+  }
+  
+  if(ch->AggregateMode != (uint8_t)eDATABUS_CH_AGGREGATE_NONE) {
+    ch->AggregateMode = (uint8_t)eDATABUS_CH_AGGREGATE_NONE;
+    me->_aggregatedItemsQty--;
+  }
+  
+  if(ch->_blockFifo._mask != 0U) {
+    ch->_blockFifo._mask = 0U;
+    ch->_blockFifo._pBuffer = NULL;
+    me->_blockItemsQty--;
+  }
+}
+
+/**
+ * @brief Sends full blocks of the block mode channels.
+ * 
+ * @note At most one frame is serialized per call and it is never flushed here, so this function does not block.
+ *       The frame carries half of the FIFO capacity of every channel that has at least that many pending samples and
+ *       still fits the free space of TX buffer. Other channels wait for the next call. Channels are visited from the one
+ *       after the first channel of the last frame, so a fast channel can't starve the others.
+ * 
+ * @param me Pointer to the databus fobject.
+ */
+static void fSendBlockData(sFaraabinFobjectDataBus *me) {
+  
+  uint32_t freeSpace = fFaraabinLinkSerializer_GetTxFreeSpace();
+  uint32_t payloadSize = 0U;
+  uint16_t firstCh = me->ChannelQty;
+  
+  for(uint16_t n = 0U; n < me->ChannelQty; n++) {
+    
+    uint16_t i = (uint16_t)((me->_blockChIndex + n) % me->ChannelQty);
+    sFaraabinFobjectDataBus_Channel *ch = &me->_pBufferChannels[i];
+    sFaraabinFobjectDataBus_ChBlockFifo *fifo = &ch->_blockFifo;
+    fifo->_sendQty = 0U;
+    
+    if(fifo->_mask == 0U) {
+      continue;
+    }
+    
+    uint16_t blockQty = (uint16_t)((fifo->_mask + 1U) >> 1U);
+    if((uint16_t)(fifo->_head - fifo->_tail) < blockQty) {
+      continue;
+    }
+    
+    uint32_t blockSize = DB_BLOCK_CH_HEADER_SIZE + ((uint32_t)blockQty * ch->ItemFobjectParam);
+    if(fFaraabinLinkSerializer_GetFrameSizeMax(payloadSize + blockSize) > freeSpace) {
+      continue;
+    }
+    
+    payloadSize += blockSize;
+    fifo->_sendQty = blockQty;
+    
+    if(firstCh == me->ChannelQty) {
+      firstCh = i;
+    }
+  }
+  
+  if(firstCh == me->ChannelQty) {
+    return;
+  }
+  
+  me->_blockChIndex = (uint16_t)((firstCh + 1U) % me->ChannelQty);
+  
+  fFaraabinLinkSerializer_DataBusSendBlockValue((uint32_t)me, &me->Seq, 0, false);
+  
+  // Samples must be read before the producer can overwrite them.
+  FARAABIN_MEMORY_BARRIER_;
+  
+  for(uint16_t i = 0U; i < me->ChannelQty; i++) {
+    
+    sFaraabinFobjectDataBus_ChBlockFifo *fifo = &me->_pBufferChannels[i]._blockFifo;
+    fifo->_tail = fifo->_tail + fifo->_sendQty;
+    fifo->_sendQty = 0U;
+  }
+}
+
+/**
+ * @brief Marks the channels that must be packed into the next stream frame.
+ * 
+ * @note Channels in report by exception modes are marked only if they have changed since their last report,
+ *       on keepalive or when a full report is forced. Their last reported value is updated here.
+ * 
+ * @param me Pointer to the databus fobject.
+ * @return qty Number of channels marked for the stream frame.
+ */
+static uint16_t fPrepareStreamReport(sFaraabinFobjectDataBus *me) {
+  
+  bool isFullReport = me->_isReportForced;
+  me->_isReportForced = false;
+  
+  if(me->_reportItemsQty != 0U) {
+    
+    me->_keepaliveCnt++;
+    if((me->KeepaliveDivideBy != 0U) && (me->_keepaliveCnt >= me->KeepaliveDivideBy)) {
+      isFullReport = true;
+    }
+  }
+  
+  if(isFullReport) {
+    me->_keepaliveCnt = 0U;
+  }
+  
+  uint16_t qty = 0U;
+  
+  for(uint16_t i = 0U; i < me->ChannelQty; i++) {
+    
+    sFaraabinFobjectDataBus_Channel *ch = &me->_pBufferChannels[i];
+    ch->_isReportDue = false;
+    
+    if((ch->ItemFobjectPtr == 0U) || (!ch->Enable)) {
+      continue;
+    }
+    
+    if((ch->AggregateMode != (uint8_t)eDATABUS_CH_AGGREGATE_NONE) || (ch->_blockFifo._mask != 0U)) {
+      continue;
+    }
+    
+    if(ch->ReportMode == (uint8_t)eDATABUS_CH_REPORT_ALWAYS) {
+      
+      ch->_isReportDue = true;
+      
+    } else if(isFullReport || fIsChannelChanged(ch)) {
+      
+      uint8_t *src = (uint8_t*)ch->ItemFobjectPtr;
+      for(uint16_t j = 0U; j < ch->ItemFobjectParam; j++) {
+        ch->_lastReported.Byte[j] = src[j];
+      }
+      
+      ch->_isReportDue = true;
+      
+    } else {
+      // Do nothing.
+    }
+    
+    if(ch->_isReportDue) {
+      qty++;
+    }
+  }
+  
+  return qty;
+}
+
+/**
+ * @brief Checks if a report by exception channel has changed since its last report.
+ * 
+ * @param ch Pointer to the databus channel.
+ * @return result 'true' if the channel must be reported.
+ */
+static bool fIsChannelChanged(sFaraabinFobjectDataBus_Channel *ch) {
+  
+  uint8_t *src = (uint8_t*)ch->ItemFobjectPtr;
+  
+  if(ch->ReportMode == (uint8_t)eDATABUS_CH_REPORT_ON_CHANGE) {
+    
+    for(uint16_t j = 0U; j < ch->ItemFobjectParam; j++) {
+      if(ch->_lastReported.Byte[j] != src[j]) {
+        return true;
+      }
+    }
+    
+    return false;
+  }
+  
+  float64_t value = 0.0;
+  float64_t last = 0.0;
+  
+  if((!fReadValueF64(ch->PrimitiveVariableId, src, &value)) ||
+     (!fReadValueF64(ch->PrimitiveVariableId, ch->_lastReported.Byte, &last))) {
+    return true;
+  }
+  
+  float64_t band = ch->Deadband;
+  if(ch->ReportMode == (uint8_t)eDATABUS_CH_REPORT_DEADBAND_REL) {
+    band *= fabs(last);
+  }
+  
+  // NaN never compares greater, so a change to or from NaN is checked separately.
+  bool isValueNan = (value != value);
+  bool isLastNan = (last != last);
+  if(isValueNan || isLastNan) {
+    return (isValueNan != isLastNan);
+  }
+  
+  return (fabs(value - last) > band);
+}
+
+/**
+ * @brief Resets the stream window aggregate of a databus channel.
+ * 
+ * @param ch Pointer to the databus channel.
+ */
+static void fResetAggregate(sFaraabinFobjectDataBus_Channel *ch) {
+  
+  ch->_aggregate.Min = 0.0;
+  ch->_aggregate.Max = 0.0;
+  ch->_aggregate.Sum = 0.0;
+  ch->_aggregate.SumSq = 0.0;
+  ch->_aggregate.Cnt = 0U;
+}
+
+/**
+ * @brief Gets the size of a primitive variable type in bytes.
+ * 
+ * @param primitiveId ID of the primitive type. Could be one of eFaraabinFobjectVarType_PrimitiveId values.
+ * @return size Size of the type in bytes. '0' if the ID is unknown.
+ */
+static uint8_t fGetPrimitiveSize(uint8_t primitiveId) {
+  
+  switch((eFaraabinFobjectVarType_PrimitiveId)primitiveId) {
+    
+    case eVAR_DATA_TYPE_PRIMITIVE_BOOL:
+    case eVAR_DATA_TYPE_PRIMITIVE_UINT8:
+    case eVAR_DATA_TYPE_PRIMITIVE_INT8: {
+      return 1U;
+    }
+    
+    case eVAR_DATA_TYPE_PRIMITIVE_UINT16:
+    case eVAR_DATA_TYPE_PRIMITIVE_INT16: {
+      return 2U;
+    }
+    
+    case eVAR_DATA_TYPE_PRIMITIVE_UINT32:
+    case eVAR_DATA_TYPE_PRIMITIVE_INT32:
+    case eVAR_DATA_TYPE_PRIMITIVE_FLOAT32: {
+      return 4U;
+    }
+    
+    case eVAR_DATA_TYPE_PRIMITIVE_UINT64:
+    case eVAR_DATA_TYPE_PRIMITIVE_INT64:
+    case eVAR_DATA_TYPE_PRIMITIVE_FLOAT64: {
+      return 8U;
+    }
+    
+    default: {
+      return 0U;
+    }
+  }
+}
+
+/**
+ * @brief Reads a primitive numerical value as float64_t.
+ * 
+ * @param primitiveId ID of the primitive type. Could be one of eFaraabinFobjectVarType_PrimitiveId values.
+ * @param src Pointer to the raw bytes of the value.
+ * @param value Pointer for copying the read value.
+ * @return result 'true' if value is read, 'false' if the type is not numerical.
+ */
+static bool fReadValueF64(uint8_t primitiveId, uint8_t *src, float64_t *value) {
+  
+  uByte8 tmp = {0x00};
+  
+  uint8_t size = fGetPrimitiveSize(primitiveId);
+  for(uint8_t i = 0U; i < size; i++) {
+    tmp.Byte[i] = src[i];
+  }
+  
+  switch((eFaraabinFobjectVarType_PrimitiveId)primitiveId) {
+    
+    case eVAR_DATA_TYPE_PRIMITIVE_UINT8:   *value = (float64_t)tmp.Byte[0];          break;
+    case eVAR_DATA_TYPE_PRIMITIVE_INT8:    *value = (float64_t)(int8_t)tmp.Byte[0];  break;
+    case eVAR_DATA_TYPE_PRIMITIVE_UINT16:  *value = (float64_t)tmp.U16[0];           break;
+    case eVAR_DATA_TYPE_PRIMITIVE_INT16:   *value = (float64_t)tmp.I16[0];           break;
+    case eVAR_DATA_TYPE_PRIMITIVE_UINT32:  *value = (float64_t)tmp.U32[0];           break;
+    case eVAR_DATA_TYPE_PRIMITIVE_INT32:   *value = (float64_t)tmp.I32[0];           break;
+    case eVAR_DATA_TYPE_PRIMITIVE_UINT64:  *value = (float64_t)tmp.U64;              break;
+    case eVAR_DATA_TYPE_PRIMITIVE_INT64:   *value = (float64_t)tmp.I64;              break;
+    case eVAR_DATA_TYPE_PRIMITIVE_FLOAT32: *value = (float64_t)tmp.F32[0];           break;
+    case eVAR_DATA_TYPE_PRIMITIVE_FLOAT64: *value = tmp.F64;                         break;
+    
+    default: {
+      return false;
+    }
+  }
+  
+  return true;
+}
+
 /**
  * @brief Clears the databus queue.
  * 
@@ -1914,9 +2788,8 @@ static void fQueueClear(sFaraabinFobjectDataBus * const me) {
  * @param me Pointer to the databus fobject.
  * @param item Item to be inserted.
  */
-static void fQueueInsert(sFaraabinFobjectDataBus * const me, uint8_t *item) {
+static void fQueueInsert(sFaraabinFobjectDataBus * const me, sFaraabinFobjectDataBus_CaptureValue *item) {
   
-  uint32_t offset;
   uint8_t over_write = 0;
   
   if(me->QueueItemCount >= me->BufferCaptureSize) {
@@ -1941,9 +2814,8 @@ static void fQueueInsert(sFaraabinFobjectDataBus * const me, uint8_t *item) {
  * @param item Pointer to a buffer for copying the read item.
  * @return result Could be one of items in FARAABIN_DB_RET group.
  */
-static uint8_t fQueueRead(sFaraabinFobjectDataBus * const me, uint32_t num, uint8_t *item) {
+static uint8_t fQueueRead(sFaraabinFobjectDataBus * const me, uint32_t num, sFaraabinFobjectDataBus_CaptureValue *item) {
   
-  uint32_t offset;
   uint32_t index;
   
   if(me->QueueItemCount == 0U) {
@@ -1954,7 +2826,7 @@ static uint8_t fQueueRead(sFaraabinFobjectDataBus * const me, uint32_t num, uint
     return FARAABIN_DB_CHANNEL_INDEX_GREATER_THAN_MAX;
   }
   
-  index = (num + me->_queueFrontIndex) % me->BufferCaptureSize;
+  index = WRAP_INDEX_(num + me->_queueFrontIndex);
   
   READ_ELEMENT_(index, item);
   
@@ -29,6 +29,7 @@ extern "C" {
 
 /* Includes ------------------------------------------------------------------*/
 #include "faraabin_type.h"
+#include "faraabin_fobject_vartype.h"
 
 #include "chrono.h"
 
@@ -45,6 +46,11 @@ extern "C" {
 #define FARAABIN_DB_CODEBLOCK_CALLBACK_NOT_EMPTY    (uint8_t)(5U) /*!< Codeblock attached to databus has no callback. */
 #define FARAABIN_DB_NOT_INIT                        (uint8_t)(5U) /*!< Databus not initialized error. */
 #define FARAABIN_DB_QUEUE_EMPTY                     (uint8_t)(6U) /*!< Databus queue is empty. */
+#define FARAABIN_DB_CHANNEL_NOT_AGGREGATABLE        (uint8_t)(7U) /*!< Item attached to the databus channel is not a numerical scalar. */
+#define FARAABIN_DB_BLOCK_FIFO_ERROR                (uint8_t)(8U) /*!< Block FIFO buffer doesn't match the channel, its capacity is not a power of two or its block doesn't fit TX buffer. */
+#define FARAABIN_DB_SLICE_ERROR                     (uint8_t)(9U) /*!< Slice stride is less than element size, slice is empty or its packed size exceeds 65535 bytes. */
+#define FARAABIN_DB_CHANNEL_NOT_REPORTABLE          (uint8_t)(10U) /*!< Report mode is not supported for the item attached to the databus channel. */
+#define FARAABIN_DB_PARAM_ERROR                     (uint8_t)(11U) /*!< Requested mode is out of range of its enum. */
 
 /** @} */ //End of FARAABIN_DB_RET
 
@@ -119,6 +125,72 @@ typedef enum {
   
 }eFaraabinFobjectDataBus_ChTrigType;
 
+/**
+ * @brief Databus channel aggregation mode in stream state.
+ * 
+ */
+typedef enum {
+  
+  eDATABUS_CH_AGGREGATE_NONE = 0,     /*!< Channel value is sampled only when stream frame is sent. */
+  eDATABUS_CH_AGGREGATE_ENVELOPE,     /*!< Min, max and mean of the channel over each StreamDivideBy window are sent. */
+  eDATABUS_CH_AGGREGATE_ENVELOPE_RMS, /*!< Same as eDATABUS_CH_AGGREGATE_ENVELOPE plus RMS of the window. */
+  
+}eFaraabinFobjectDataBus_ChAggregate;
+
+/**
+ * @brief Databus channel report mode in stream state.
+ * 
+ */
+typedef enum {
+  
+  eDATABUS_CH_REPORT_ALWAYS = 0,        /*!< Channel is sent in every stream frame. */
+  eDATABUS_CH_REPORT_ON_CHANGE,         /*!< Channel is sent when any byte of it changes. Suitable for enums and bools. */
+  eDATABUS_CH_REPORT_DEADBAND_ABS,      /*!< Channel is sent when it moves more than Deadband from the last reported value. */
+  eDATABUS_CH_REPORT_DEADBAND_REL,      /*!< Channel is sent when it moves more than Deadband * |last reported value|. */
+  
+}eFaraabinFobjectDataBus_ChReport;
+
+/**
+ * @brief Running aggregate of a databus channel over one stream window.
+ * 
+ */
+typedef struct {
+  
+  float64_t Min;    /*!< Minimum value in the window. */
+  
+  float64_t Max;    /*!< Maximum value in the window. */
+  
+  float64_t Sum;    /*!< Sum of the values in the window. */
+  
+  float64_t SumSq;  /*!< Sum of the squared values in the window. Only updated in RMS mode. */
+  
+  uint16_t Cnt;     /*!< Number of samples accumulated in the window. */
+  
+}sFaraabinFobjectDataBus_ChAggregateValue;
+
+/**
+ * @brief Single producer single consumer sample FIFO of a databus channel in block mode.
+ * 
+ * @note Producer is fFaraabinFobjectDataBus_PushBlockSample() (usually called from an ISR) and
+ *       consumer is fFaraabin_Run(). Head and tail are free running counters and are only written by their own side.
+ * 
+ */
+typedef struct {
+  
+  uint8_t *_pBuffer;        /*!< Pointer to the sample buffer given by the user. */
+  
+  uint16_t _mask;           /*!< Capacity of the FIFO minus one. '0' if the channel is not in block mode. */
+  
+  volatile uint16_t _head;  /*!< Free running write counter. Only written by the producer. */
+  
+  volatile uint16_t _tail;  /*!< Free running read counter. Only written by the consumer. */
+  
+  uint16_t _sendQty;        /*!< Number of samples serialized from this FIFO in the current block frame. */
+  
+  uint32_t OverflowCnt;     /*!< Number of samples dropped because the FIFO was full. */
+  
+}sFaraabinFobjectDataBus_ChBlockFifo;
+
 /**
  * @brief Databus channel object.
  * 
@@ -137,6 +209,24 @@ typedef struct {
   
   bool Enable;                  /*!< Enable status of the channel. */
   
+  uint16_t SliceStride;         /*!< Distance in bytes between elements of a slice channel. ItemFobjectParam holds the element size. */
+  
+  uint16_t SliceQty;            /*!< Number of elements of a slice channel. '0' if the channel streams a contiguous item. Capture only samples the first element. */
+  
+  uint8_t AggregateMode;        /*!< Aggregation mode of the channel in stream state. Could be one of eFaraabinFobjectDataBus_ChAggregate values. */
+  
+  sFaraabinFobjectDataBus_ChAggregateValue _aggregate; /*!< Running aggregate of the current stream window. */
+  
+  sFaraabinFobjectDataBus_ChBlockFifo _blockFifo; /*!< Sample FIFO of the channel in block mode. */
+  
+  uint8_t ReportMode;           /*!< Report mode of the channel in stream state. Could be one of eFaraabinFobjectDataBus_ChReport values. */
+  
+  float64_t Deadband;           /*!< Absolute or relative deadband of the channel in deadband report modes. */
+  
+  uByte8 _lastReported;         /*!< Raw bytes of the last reported value of the channel. */
+  
+  bool _isReportDue;            /*!< Internal flag that marks the channel for the stream frame being sent. */
+  
 }sFaraabinFobjectDataBus_Channel;
 
 /**
@@ -155,6 +245,18 @@ typedef struct {
   
 }sFaraabinFobjectDataBus_CaptureValue;
 
+/**
+ * @brief Sequential reader of the databus capture queue.
+ * 
+ */
+typedef struct {
+  
+  uint32_t _index;      /*!< Index of the next item in the capture buffer. */
+  
+  uint32_t _remaining;  /*!< Number of items left to read. */
+  
+}sFaraabinFobjectDataBus_CaptureCursor;
+
 /**
  * @brief Databus fobject definition.
  * 
@@ -189,6 +291,20 @@ typedef struct {
   
   uint16_t _streamDivbyCnt;                                                 /*!< Internal counter for stream prescaler. */
   
+  uint16_t _aggregatedItemsQty;                                             /*!< Number of channels with an aggregation mode other than eDATABUS_CH_AGGREGATE_NONE. */
+  
+  uint16_t _blockItemsQty;                                                  /*!< Number of channels in block sampling mode. */
+  
+  uint16_t _blockChIndex;                                                   /*!< Channel that block sending starts from in the next call. */
+  
+  uint16_t KeepaliveDivideBy;                                               /*!< Number of stream frames after which report by exception channels are sent unchanged. '0' disables keepalive. */
+  
+  uint16_t _keepaliveCnt;                                                   /*!< Internal counter for keepalive of report by exception channels. */
+  
+  uint16_t _reportItemsQty;                                                 /*!< Number of channels with a report mode other than eDATABUS_CH_REPORT_ALWAYS. */
+  
+  bool _isReportForced;                                                     /*!< Internal flag for sending all channels in the next stream frame. */
+  
   sFaraabinFobjectDataBus_CaptureValue *_pBufferCapture;                    /*!< Pointer to the capture buffer. */
 
   bool _isBufferCaptureStatic;                                              /*!< Memory allocation status of the capture buffer. */
@@ -249,6 +365,10 @@ typedef struct {
                                
   uint32_t _queueRearIndex;                                                 /*!< Rear index of the databus queue. */
   
+  uint32_t _queueMask;                                                      /*!< BufferCaptureSize - 1 if it is a power of two, otherwise '0'. */
+  
+  sFaraabinFobjectDataBus_CaptureCursor _captureSendCursor;                 /*!< Cursor of the capture queue while sending captured items. */
+  
 }sFaraabinFobjectDataBus;
 
 /* Exported constants --------------------------------------------------------*/
@@ -368,6 +488,27 @@ uint32_t fFaraabinFobjectDataBus_GetCaptureDataQty(sFaraabinFobjectDataBus *me);
  */
 uint8_t fFaraabinFobjectDataBus_GetCaptureData(sFaraabinFobjectDataBus *me, uint32_t index, sFaraabinFobjectDataBus_CaptureValue *value);
 
+/**
+ * @brief Starts a sequential read of the captured data from the oldest item.
+ * 
+ * @param me Pointer to the databus fobject.
+ * @param cursor Pointer to the cursor.
+ * @return result Could be one of items in FARAABIN_DB_RET group.
+ */
+uint8_t fFaraabinFobjectDataBus_CaptureCursorBegin(sFaraabinFobjectDataBus *me, sFaraabinFobjectDataBus_CaptureCursor *cursor);
+
+/**
+ * @brief Reads the next captured item and advances the cursor.
+ * 
+ * @note Prefer this function over fFaraabinFobjectDataBus_GetCaptureData() when uploading the whole capture buffer.
+ * 
+ * @param me Pointer to the databus fobject.
+ * @param cursor Pointer to the cursor started by fFaraabinFobjectDataBus_CaptureCursorBegin().
+ * @param value Pointer to the captured value.
+ * @return result FARAABIN_DB_QUEUE_EMPTY when all items are read. Could be one of items in FARAABIN_DB_RET group.
+ */
+uint8_t fFaraabinFobjectDataBus_CaptureCursorNext(sFaraabinFobjectDataBus *me, sFaraabinFobjectDataBus_CaptureCursor *cursor, sFaraabinFobjectDataBus_CaptureValue *value);
+
 /**
  * @brief Attaches a variable to a free channel in databus.
  * 
@@ -389,6 +530,40 @@ uint8_t fFaraabinFobjectDataBus_AttachVariable(sFaraabinFobjectDataBus *me, uint
  */
 uint8_t fFaraabinFobjectDataBus_AttachVariableToChannel(sFaraabinFobjectDataBus *me, uint16_t channel, uint32_t varPtr, uint16_t varSize, uint8_t varTypeArchitecture, uint8_t varPrimitiveId, uint8_t fobjectType);
 
+/**
+ * @brief Attaches a strided slice of a buffer to the first free channel of the databus.
+ * 
+ * @note Elements are read in place at sliceBase + k * stride (k = 0 .. qty - 1) and streamed as a packed vector,
+ *       so one field of a struct array or every k-th element of a buffer can be streamed without a shadow copy.
+ * @note Capture modes (timer and trigger) only sample the first element of the slice.
+ * @note Stride and quantity of slice channels are reported in eFO_DB_PROP_ID_SETTING_CH_SLICE frame, not in the setting frame.
+ * 
+ * @param me Pointer to the databus fobject.
+ * @param sliceBase Pointer to the first element of the slice.
+ * @param elemSize Size of each element in bytes.
+ * @param stride Distance between two consecutive elements in bytes. Must not be less than elemSize.
+ * @param qty Number of elements in the slice. qty * elemSize must not exceed 65535 bytes.
+ * @param varTypeArchitecture Architecture of the element type.
+ * @param varPrimitiveId ID of the element type if it is primitive.
+ * @return result Could be one of items in FARAABIN_DB_RET group.
+ */
+uint8_t fFaraabinFobjectDataBus_AttachVariableSlice(sFaraabinFobjectDataBus *me, uint32_t sliceBase, uint16_t elemSize, uint16_t stride, uint16_t qty, uint8_t varTypeArchitecture, uint8_t varPrimitiveId);
+
+/**
+ * @brief Attaches a strided slice of a buffer to a specific channel of the databus.
+ * 
+ * @param me Pointer to the databus fobject.
+ * @param channel Channel number of the databus.
+ * @param sliceBase Pointer to the first element of the slice.
+ * @param elemSize Size of each element in bytes.
+ * @param stride Distance between two consecutive elements in bytes. Must not be less than elemSize.
+ * @param qty Number of elements in the slice. qty * elemSize must not exceed 65535 bytes.
+ * @param varTypeArchitecture Architecture of the element type.
+ * @param varPrimitiveId ID of the element type if it is primitive.
+ * @return result Could be one of items in FARAABIN_DB_RET group.
+ */
+uint8_t fFaraabinFobjectDataBus_AttachVariableSliceToChannel(sFaraabinFobjectDataBus *me, uint16_t channel, uint32_t sliceBase, uint16_t elemSize, uint16_t stride, uint16_t qty, uint8_t varTypeArchitecture, uint8_t varPrimitiveId);
+
 /**
  * @brief Attaches an entity item to a channel of the databus.
  * 
@@ -455,6 +630,76 @@ void fFaraabinFobjectDataBus_RunCodeBlock(uint32_t cbPtr, uint32_t startTick, ui
  */
 uint8_t fFaraabinFobjectDataBus_AttachEntityNumericalToChannel(sFaraabinFobjectDataBus *me, uint16_t channel, uint32_t varPtr, uint16_t varSize, uint8_t varTypeArchitecture, uint8_t varPrimitiveId);
 
+/**
+ * @brief Attaches one member of a structure variable to a channel of the databus.
+ * 
+ * @note The member is looked up by name in the constant layout table of the variable type,
+ *       so no dictionary callback is needed. Only members of primitive types can be attached.
+ * 
+ * @param me Pointer to the databus fobject.
+ * @param channel Channel number of the databus.
+ * @param structPtr Pointer to the structure variable.
+ * @param varType Pointer to the varType fobject of the structure (with a layout table).
+ * @param memberName Name of the member.
+ * @return result Could be one of items in FARAABIN_DB_RET group.
+ */
+uint8_t fFaraabinFobjectDataBus_AttachStructMemberToChannel(sFaraabinFobjectDataBus *me, uint16_t channel, uint32_t structPtr, const sFaraabinFobjectVarType *varType, const char *memberName);
+
+/**
+ * @brief Sets the aggregation mode of a databus channel in stream state.
+ * 
+ * @note In aggregation mode the channel is sampled on every call of fFaraabinFobjectDataBus_Run() and
+ *       min/max/mean (and optionally RMS) of each StreamDivideBy window are streamed instead of the last sample.
+ *       Only channels attached to a single primitive numerical variable can be aggregated.
+ * 
+ * @param me Pointer to the databus fobject.
+ * @param channel Channel number of the databus.
+ * @param mode Aggregation mode. Could be one of eFaraabinFobjectDataBus_ChAggregate values.
+ * @return result Could be one of items in FARAABIN_DB_RET group.
+ */
+uint8_t fFaraabinFobjectDataBus_SetChannelAggregate(sFaraabinFobjectDataBus *me, uint16_t channel, eFaraabinFobjectDataBus_ChAggregate mode);
+
+/**
+ * @brief Sets the report mode of a databus channel in stream state.
+ * 
+ * @note In report by exception modes the channel is only packed into the stream frame when it has changed since
+ *       the last report, or every KeepaliveDivideBy stream frames. Deadband modes need a primitive numerical item.
+ * 
+ * @param me Pointer to the databus fobject.
+ * @param channel Channel number of the databus.
+ * @param mode Report mode. Could be one of eFaraabinFobjectDataBus_ChReport values.
+ * @param deadband Absolute (or relative ratio) deadband. Must not be negative or NaN. Ignored in other modes.
+ * @return result Could be one of items in FARAABIN_DB_RET group.
+ */
+uint8_t fFaraabinFobjectDataBus_SetChannelReport(sFaraabinFobjectDataBus *me, uint16_t channel, eFaraabinFobjectDataBus_ChReport mode, float64_t deadband);
+
+/**
+ * @brief Puts a databus channel in block sampling mode.
+ * 
+ * @note In block mode samples are pushed by fFaraabinFobjectDataBus_PushBlockSample() and sent in blocks
+ *       of half of the FIFO capacity from fFaraabin_Run() while the databus is in stream state.
+ *       Frame of a block (half of sampleQty * elemSize bytes) must fit faraabin TX buffer.
+ *       Passing NULL buffer or zero sampleQty returns the channel to normal stream mode.
+ * 
+ * @param me Pointer to the databus fobject.
+ * @param channel Channel number of the databus.
+ * @param buffer Pointer to the sample buffer. Its size must be sampleQty * elemSize bytes.
+ * @param elemSize Size of each sample in bytes. Must be equal to the size of the attached item.
+ * @param sampleQty Capacity of the FIFO in samples. Must be a power of two between 2 and 32768.
+ * @return result Could be one of items in FARAABIN_DB_RET group.
+ */
+uint8_t fFaraabinFobjectDataBus_SetChannelBlockFifo(sFaraabinFobjectDataBus *me, uint16_t channel, uint8_t *buffer, uint16_t elemSize, uint16_t sampleQty);
+
+/**
+ * @brief Pushes the current value of the item attached to a block mode channel into its FIFO.
+ * 
+ * @note This function is safe to be called from an ISR while fFaraabin_Run() is draining the FIFO.
+ * 
+ * @param me Pointer to the databus fobject.
+ * @param channel Channel number of the databus.
+ */
+void fFaraabinFobjectDataBus_PushBlockSample(sFaraabinFobjectDataBus *me, uint16_t channel);
+
 /* Exported variables --------------------------------------------------------*/
 
 #ifdef __cplusplus
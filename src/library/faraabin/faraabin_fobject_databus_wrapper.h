@@ -45,6 +45,7 @@ extern "C" {
   sFaraabinFobjectDataBus databusName_ = {\
     .Name = #databusName_,\
     .StreamDivideBy = 1,\
+    .KeepaliveDivideBy = 10,\
     .TimerDivideBy = 1,\
     .TimerWindowMs = 100,\
     .TrigDivideBy = 1,\
@@ -246,6 +247,21 @@ extern "C" {
  */
 #define FARAABIN_DataBus_AttachCodeBlock_(pDatabus_, pCodeblock_)  fFaraabinFobjectDataBus_AttachCodeBlock(pDatabus_, (uint32_t)pCodeblock_)
 
+/**
+ * @brief Attaches a strided slice of a buffer to the first free channel of the databus.
+ * 
+ * @note For streaming one field of a struct array pass &array[0].field and sizeof(array[0]) as stride.
+ *       For streaming every k-th item of a buffer pass &buffer[0] and k * sizeof(buffer[0]) as stride.
+ * 
+ * @param pDatabus_ Pointer to databus
+ * @param pFirst_ Pointer to the first element of the slice
+ * @param stride_ Distance between two consecutive elements in bytes
+ * @param qty_ Number of elements
+ * @param primitiveId_ Primitive type of the elements. Could be one of eFaraabinFobjectVarType_PrimitiveId values.
+ */
+#define FARAABIN_DataBus_AttachVariableSlice_(pDatabus_, pFirst_, stride_, qty_, primitiveId_) \
+  fFaraabinFobjectDataBus_AttachVariableSlice(pDatabus_, (uint32_t)(pFirst_), sizeof(*(pFirst_)), stride_, qty_, eVAR_DATA_TYPE_PRIMITIVE, primitiveId_)
+
 /**
  * @brief Detaches fobjects from all channels.
  * 
@@ -253,6 +269,45 @@ extern "C" {
  */
 #define FARAABIN_DataBus_DetachAllChannels_(pDatabus_) fFaraabinFobjectDataBus_DetachAllChannels(pDatabus_)
 
+/**
+ * @brief Sets the stream aggregation mode (min/max/mean envelope) of a databus channel.
+ * 
+ * @param pDatabus_ Pointer to databus
+ * @param channel_ Channel number
+ * @param mode_ Aggregation mode. Could be one of eFaraabinFobjectDataBus_ChAggregate values.
+ */
+#define FARAABIN_DataBus_SetChannelAggregate_(pDatabus_, channel_, mode_) fFaraabinFobjectDataBus_SetChannelAggregate(pDatabus_, channel_, mode_)
+
+/**
+ * @brief Sets the report mode (report by exception with deadband) of a databus channel.
+ * 
+ * @param pDatabus_ Pointer to databus
+ * @param channel_ Channel number
+ * @param mode_ Report mode. Could be one of eFaraabinFobjectDataBus_ChReport values.
+ * @param deadband_ Absolute or relative deadband for deadband modes.
+ */
+#define FARAABIN_DataBus_SetChannelReport_(pDatabus_, channel_, mode_, deadband_) fFaraabinFobjectDataBus_SetChannelReport(pDatabus_, channel_, mode_, deadband_)
+
+/**
+ * @brief Puts a databus channel in block sampling mode.
+ * 
+ * @note Buffer must be an array of the same type as the item attached to the channel, with a power of two length.
+ * 
+ * @param pDatabus_ Pointer to databus
+ * @param channel_ Channel number
+ * @param buffer_ Sample buffer array
+ */
+#define FARAABIN_DataBus_SetChannelBlockFifo_(pDatabus_, channel_, buffer_) \
+  fFaraabinFobjectDataBus_SetChannelBlockFifo(pDatabus_, channel_, (uint8_t*)(buffer_), sizeof((buffer_)[0]), (uint16_t)(sizeof(buffer_) / sizeof((buffer_)[0])))
+
+/**
+ * @brief Pushes the current value of the item attached to a block mode channel into its FIFO. Could be called from an ISR.
+ * 
+ * @param pDatabus_ Pointer to databus
+ * @param channel_ Channel number
+ */
+#define FARAABIN_DataBus_PushBlockSample_(pDatabus_, channel_) fFaraabinFobjectDataBus_PushBlockSample(pDatabus_, channel_)
+
 /**
  * @brief Runs the databus.
  * 
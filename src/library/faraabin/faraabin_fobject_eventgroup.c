@@ -67,12 +67,12 @@ uint8_t fFaraabinFobjectEventGroup_Init(sFaraabinFobjectEventGroup *me) {
 		return 1;
 	}
 
+	me->_type = (uint8_t)eFO_TYPE_EVENT_GROUP;
+	
   if(fFaraabinDatabase_AddDict((uint32_t)me) != 0U) {
     return 1;
   }
   
-	me->_type = (uint8_t)eFO_TYPE_EVENT_GROUP;
-	
 	me->Enable = true;
   me->_init = true;
   return 0;
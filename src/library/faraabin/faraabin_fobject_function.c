@@ -184,12 +184,12 @@ uint8_t fFaraabinFobjectFunctionGroupType_Init(sFaraabinFobjectFunctionGroupType
 		return 1;
 	}
   
+	me->_type = (uint8_t)eFO_TYPE_FUNCTION_GROUP_TYPE;
+	
   if(fFaraabinDatabase_AddDict((uint32_t)me) != 0U) {
     return 1;
   }
   
-	me->_type = (uint8_t)eFO_TYPE_FUNCTION_GROUP_TYPE;
-	
   me->_init = true;
   return 0;
 }
@@ -66,7 +66,9 @@ typedef enum {
 	eFN_EVENT_INFO_USER_DATA_RECEIVED = 0,
 	
   eFN_EVENT_INFO_RUN,
-  eFN_EVENT_INFO_STOP,
+  eFN_EVENT_INFO_STOP,          /*!< Parameter is 17 bytes little endian: [0] result, [1..4] execution time in us, [5..8] YieldCnt,
+                                     [9..12] OverrunCnt, [13..16] MaxRunUs. Older versions sent only bytes [0..4], so hosts must
+                                     use the parameter size to detect the statistics and ignore any bytes they do not know. */
   eFN_EVENT_INFO_PAUSE,
   eFN_EVENT_INFO_RESUME,
   
@@ -74,6 +76,8 @@ typedef enum {
   eFN_EVENT_ERROR_CMD_IS_RUNNING_NOW,
   eFN_EVENT_ERROR_MAX_CONCURRENT_CMD_REACHED,
   eFN_EVENT_ERROR_CMD_NOT_FOUND,
+  eFN_EVENT_ERROR_ARG_TOO_LARGE,
+  eFN_EVENT_ERROR_ARG_POOL_EXHAUSTED,
   
 }eFaraabinFobjectFunction_SystemEventId;
 
@@ -125,6 +129,10 @@ typedef struct {
   FaraabinFobjectFunctionHandler FunctionPtr;       /*!< Pointer to the function handler of the fobject. */
   
   sChrono _chrono;                                  /*!< Private chrono used for time measurements. */
+  
+  uint8_t Priority;                                 /*!< Scheduling priority. The function engine gives (Priority + 1) slices to the function in each pass. */
+  
+  timeUs_t SliceBudgetUs;                           /*!< Budget of each slice in micro-seconds. '0' means FB_FUNCTION_SLICE_BUDGET_US. */
 
 }sFaraabinFobjectFunction;
 
@@ -29,6 +29,7 @@ extern "C" {
 
 /* Includes ------------------------------------------------------------------*/
 #include "faraabin_fobject_function.h"
+#include "faraabin_function_engine.h"
 
 #include "faraabin_config.h"
 #include "add_on/runtime_scaler/runtime_scaler.h"
@@ -220,6 +221,56 @@ extern "C" {
     return FUNCTION_CONTINUE;\
   }
 
+/**
+ * @brief Sets the scheduling parameters of the current function in function engine.
+ * 
+ * @param priority_ Priority of the function. The engine gives (priority_ + 1) slices to the function in each pass.
+ * @param sliceBudgetUs_ Budget of each slice in micro-seconds. Slices taking longer are reported as overrun.
+ */
+#define FARAABIN_Function_SetSchedule_(priority_, sliceBudgetUs_) \
+  do {\
+    __funcPtr__->Priority = (priority_);\
+    __funcPtr__->SliceBudgetUs = (sliceBudgetUs_);\
+  } while(0)
+
+/**
+ * @brief Tags the start of the resumable part of a function declared using FARAABIN_FUNCTION_().
+ * 
+ * @note This is a protothread style coroutine. Execution is resumed from the last FARAABIN_Function_Yield_()
+ *       in the next slice, so local variables that must survive a yield have to be declared static.
+ *       Resume point is kept by the function engine for each execution, so the same coroutine can run on several objects concurrently.
+ *       Do not use this macro in functions declared using FARAABIN_FUNCTION_LOOP_().
+ * 
+ */
+#define FARAABIN_Function_CoroutineBegin_() \
+  uint16_t *__resume__ = fFaraabinFunctionEngine_GetResumePoint();\
+  if(isFirstRun) {\
+    *__resume__ = 0U;\
+  }\
+  switch(*__resume__) {\
+    case 0U:
+
+/**
+ * @brief Yields the CPU back to function engine. The function is resumed from here in the next slice.
+ * 
+ */
+#define FARAABIN_Function_Yield_() \
+  do {\
+    *__resume__ = (uint16_t)__LINE__;\
+    return FUNCTION_CONTINUE;\
+    case __LINE__:;\
+  } while(0)
+
+/**
+ * @brief Tags the end of the resumable part of a function started with FARAABIN_Function_CoroutineBegin_().
+ * 
+ */
+#define FARAABIN_Function_CoroutineEnd_() \
+    default:\
+      break;\
+  }\
+  *__resume__ = 0U
+
 #endif
 
 /* Exported types ------------------------------------------------------------*/
@@ -55,13 +55,14 @@ sFaraabinFobjectMcu faraabin_mcu__; /*!< Singleton MCU Fobject of the Faraabin.
  */
 uint8_t fFaraabinFobjectMcu_Init(void) {
   
+	faraabin_mcu__._type = (uint8_t)eFO_TYPE_MCU;
+	
 	FaraabinInit___ = true;
   if(fFaraabinDatabase_AddDict((uint32_t)&faraabin_mcu__) != 0U) {
     return 1;
   }
 	FaraabinInit___ = false;
 	
-	faraabin_mcu__._type = (uint8_t)eFO_TYPE_MCU;
   faraabin_mcu__._init = FALSE;
 	
 	faraabin_mcu__.Enable = TRUE;
@@ -68,6 +68,8 @@ typedef enum {
   
   eMCU_EVENT_ERROR_RESET_FUNC_NOT_IMPLEMENTED,
   
+  eMCU_EVENT_INFO_DICT_UPDATE_END,
+  
 }eFaraabinFobjectMcu_SystemEventId;
 
 /**
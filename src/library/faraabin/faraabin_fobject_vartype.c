@@ -94,6 +94,41 @@
   
   To declare the type of a member in structures, users need to use the exact keywords listed above.
 
+  Structures can also be declared with a constant layout table instead of a dictionary function.
+  Each member gets an offsetof-based entry (name, varType, offset, size, count) in flash, which is
+  used to send the member dictionary and lets users work on single members without extra callbacks.
+  The macros in faraabin_fobject_vartype_cg.h generate these tables. They can also be written by hand:
+
+  @code
+
+  FARAABIN_VAR_TYPE_LAYOUT_DEF_(sUserDefinedType);
+
+  FARAABIN_VAR_TYPE_LAYOUT_FUNC_(sUserDefinedType) {
+    FARAABIN_VAR_TYPE_LAYOUT_FUNC_START_(sUserDefinedType);
+
+    FARAABIN_VAR_TYPE_LAYOUT_MEMBER_(float32_t, a, 1);
+    FARAABIN_VAR_TYPE_LAYOUT_MEMBER_(uint8_t, b, 10);
+    FARAABIN_VAR_TYPE_LAYOUT_MEMBER_(float64_t, c, 1);
+
+    FARAABIN_VAR_TYPE_LAYOUT_FUNC_END_(sUserDefinedType);
+  }
+  FARAABIN_VAR_TYPE_LAYOUT_SEND_FUNC_(sUserDefinedType)
+
+  void Example(sUserDefinedType *old, sUserDefinedType *now) {
+
+    // Table lookup of a member.
+    const sFaraabinFobjectVarType_Member *b = FARAABIN_VAR_TYPE_FIND_MEMBER_(sUserDefinedType, "b");
+
+    // Walking the members that changed between two snapshots.
+    uint16_t i = FARAABIN_VAR_TYPE_NEXT_CHANGED_MEMBER_(sUserDefinedType, old, now, 0U);
+    while(i != FB_VARTYPE_MEMBER_NONE) {
+      //...
+      i = FARAABIN_VAR_TYPE_NEXT_CHANGED_MEMBER_(sUserDefinedType, old, now, i + 1U);
+    }
+  }
+
+  @endcode
+
   @endverbatim
  */
 
@@ -104,6 +139,7 @@
 #include "faraabin_fobject.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 /* Private define ------------------------------------------------------------*/
 /* Private macro -------------------------------------------------------------*/
@@ -133,18 +169,110 @@ uint8_t fFaraabinFobjectVarType_Init(sFaraabinFobjectVarType *me) {
 		return 1;
 	}
   
+  me->_type = (uint8_t)eFO_TYPE_VAR_TYPE;
+  
   if(fFaraabinDatabase_AddDict((uint32_t)me) != 0U) {
     return 1;
   }
   
 	me->_init = false;
-  me->_type = (uint8_t)eFO_TYPE_VAR_TYPE;
 	
   me->Enable = true;
   me->_init = true;
   return 0;
 }
 
+/**
+ * @brief Returns the number of members in the layout table of a variable type.
+ * 
+ * @param me Pointer to the fobject.
+ * @return qty Number of members. Zero if the type has no layout table.
+ */
+uint16_t fFaraabinFobjectVarType_GetMemberQty(const sFaraabinFobjectVarType *me) {
+  
+  uint16_t qty = 0U;
+  
+  if((me == NULL) || (me->fpGetMember == NULL)) {
+    return 0U;
+  }
+  
+  while(me->fpGetMember(qty) != NULL) {
+    qty++;
+  }
+  
+  return qty;
+}
+
+/**
+ * @brief Returns the layout entry of a member by its index.
+ * 
+ * @param me Pointer to the fobject.
+ * @param index Index of the member in declaration order.
+ * @return member Pointer to the constant layout entry or NULL if not found.
+ */
+const sFaraabinFobjectVarType_Member* fFaraabinFobjectVarType_GetMember(const sFaraabinFobjectVarType *me, uint16_t index) {
+  
+  if((me == NULL) || (me->fpGetMember == NULL)) {
+    return NULL;
+  }
+  
+  return me->fpGetMember(index);
+}
+
+/**
+ * @brief Returns the layout entry of a member by its name.
+ * 
+ * @param me Pointer to the fobject.
+ * @param name Name of the member.
+ * @return member Pointer to the constant layout entry or NULL if not found.
+ */
+const sFaraabinFobjectVarType_Member* fFaraabinFobjectVarType_FindMember(const sFaraabinFobjectVarType *me, const char *name) {
+  
+  const sFaraabinFobjectVarType_Member *member;
+  
+  if((me == NULL) || (me->fpGetMember == NULL) || (name == NULL)) {
+    return NULL;
+  }
+  
+  for(uint16_t i = 0U; (member = me->fpGetMember(i)) != NULL; i++) {
+    
+    if(strcmp(member->Name, name) == 0) {
+      return member;
+    }
+  }
+  
+  return NULL;
+}
+
+/**
+ * @brief Finds the next member that differs between two snapshots of a structure.
+ * 
+ * @note Members are compared byte by byte over their Size, so padding between members is never compared.
+ * 
+ * @param me Pointer to the fobject.
+ * @param snapshotA Pointer to the first snapshot.
+ * @param snapshotB Pointer to the second snapshot.
+ * @param fromIndex Index of the member to start the comparison from.
+ * @return index Index of the first changed member at or after fromIndex, or FB_VARTYPE_MEMBER_NONE.
+ */
+uint16_t fFaraabinFobjectVarType_NextChangedMember(const sFaraabinFobjectVarType *me, const void *snapshotA, const void *snapshotB, uint16_t fromIndex) {
+  
+  const sFaraabinFobjectVarType_Member *member;
+  
+  if((me == NULL) || (me->fpGetMember == NULL) || (snapshotA == NULL) || (snapshotB == NULL)) {
+    return FB_VARTYPE_MEMBER_NONE;
+  }
+  
+  for(uint16_t i = fromIndex; (member = me->fpGetMember(i)) != NULL; i++) {
+    
+    if(memcmp((const uint8_t*)snapshotA + member->Offset, (const uint8_t*)snapshotB + member->Offset, member->Size) != 0) {
+      return i;
+    }
+  }
+  
+  return FB_VARTYPE_MEMBER_NONE;
+}
+
 /*
 ===============================================================================
             ##### faraabin_fobject_var_type.c Private Functions #####
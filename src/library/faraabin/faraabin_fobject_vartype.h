@@ -35,6 +35,8 @@ extern "C" {
 #include "faraabin_type.h"
 
 /* Exported defines ----------------------------------------------------------*/
+#define FB_VARTYPE_MEMBER_NONE  (0xFFFFU)  /*!< Returned by member lookups when there is no (more) member. */
+
 /* Exported macro ------------------------------------------------------------*/
 /* Exported types ------------------------------------------------------------*/
 /**
@@ -71,6 +73,12 @@ typedef enum {
   
 }eFaraabinFobjectVarType_PrimitiveId;
 
+/**
+ * @brief Layout entry of a structure member. See sFaraabinFobjectVarType_Member below.
+ * 
+ */
+typedef struct sFaraabinFobjectVarType_Member sFaraabinFobjectVarType_Member;
+
 /**
  * @brief Faraabin variable type fobject.
  * 
@@ -97,8 +105,32 @@ typedef struct {
   
   void(*fpSendMember)(uint32_t fobjectPtr, uint8_t reqSeq); /*!< Function pointer for sending each member dictionary of the variable type. */
   
+  const sFaraabinFobjectVarType_Member*(*fpGetMember)(uint16_t index); /*!< Returns the constant layout entry of each member (NULL after the last one). Only set for types defined by layout macros. */
+  
+  uint8_t PrimitiveId;                                      /*!< ID of the primitive type (eFaraabinFobjectVarType_PrimitiveId). NONE for user-defined types. */
+  
 }sFaraabinFobjectVarType;
 
+/**
+ * @brief Constant layout entry of a structure member.
+ * 
+ * @note These entries are generated at compile time by FARAABIN_VAR_TYPE_LAYOUT_MEMBER_()
+ *       (or sm_()/sma_() in faraabin_fobject_vartype_cg.h) and are placed in flash.
+ */
+struct sFaraabinFobjectVarType_Member {
+  
+  const char *Name;                                         /*!< Name of the member. */
+  
+  const sFaraabinFobjectVarType *VarType;                   /*!< VarType fobject of the member. Its PrimitiveId gives the primitive ID of the member. */
+  
+  uint16_t Offset;                                          /*!< Offset of the member from the start of the structure (offsetof). */
+  
+  uint16_t Size;                                            /*!< Size of the member in bytes, including all elements of an array. */
+  
+  uint16_t ArrayQty;                                        /*!< Number of elements if the member is an array, otherwise 1. */
+  
+};
+
 /* Exported constants --------------------------------------------------------*/
 /* Exported functions prototypes ---------------------------------------------*/
 /**
@@ -109,6 +141,43 @@ typedef struct {
  * @return InitStat Returns zero on success, 1 on failure.
  */
 uint8_t fFaraabinFobjectVarType_Init(sFaraabinFobjectVarType *me);
+
+/**
+ * @brief Returns the number of members in the layout table of a variable type.
+ * 
+ * @param me Pointer to the fobject.
+ * @return qty Number of members. Zero if the type has no layout table.
+ */
+uint16_t fFaraabinFobjectVarType_GetMemberQty(const sFaraabinFobjectVarType *me);
+
+/**
+ * @brief Returns the layout entry of a member by its index.
+ * 
+ * @param me Pointer to the fobject.
+ * @param index Index of the member in declaration order.
+ * @return member Pointer to the constant layout entry or NULL if not found.
+ */
+const sFaraabinFobjectVarType_Member* fFaraabinFobjectVarType_GetMember(const sFaraabinFobjectVarType *me, uint16_t index);
+
+/**
+ * @brief Returns the layout entry of a member by its name.
+ * 
+ * @param me Pointer to the fobject.
+ * @param name Name of the member.
+ * @return member Pointer to the constant layout entry or NULL if not found.
+ */
+const sFaraabinFobjectVarType_Member* fFaraabinFobjectVarType_FindMember(const sFaraabinFobjectVarType *me, const char *name);
+
+/**
+ * @brief Finds the next member that differs between two snapshots of a structure.
+ * 
+ * @param me Pointer to the fobject.
+ * @param snapshotA Pointer to the first snapshot.
+ * @param snapshotB Pointer to the second snapshot.
+ * @param fromIndex Index of the member to start the comparison from.
+ * @return index Index of the first changed member at or after fromIndex, or FB_VARTYPE_MEMBER_NONE.
+ */
+uint16_t fFaraabinFobjectVarType_NextChangedMember(const sFaraabinFobjectVarType *me, const void *snapshotA, const void *snapshotB, uint16_t fromIndex);
   
 /* Exported variables --------------------------------------------------------*/
 
@@ -21,6 +21,10 @@
  * This file and its macros automate the user-defined type definition in Faraabin.
  * They allow users to define the data type structure and introduce it to Faraabin simultaneously.
  * 
+ * With TYPE_DICT defined, each structure generates a constant, offsetof-based layout table
+ * (member name, varType, offset, size and count) which is used to send its dictionary
+ * and to look up its members. See faraabin_fobject_vartype.c.
+ * 
  * @endverbatim
  */
 
@@ -46,13 +50,14 @@ extern "C"{
 
 #if defined(TYPE_DICT)
 
-    #define typedef_struct_(typeName_)                          FARAABIN_VAR_TYPE_DEF_(typeName_);\
-                                                                static FARAABIN_VAR_TYPE_STRUCT_FUNC_(typeName_) {\
-                                                                FARAABIN_VAR_TYPE_STRUCT_FUNC_START_(typeName_);
+    #define typedef_struct_(typeName_)                          FARAABIN_VAR_TYPE_LAYOUT_DEF_(typeName_);\
+                                                                FARAABIN_VAR_TYPE_LAYOUT_FUNC_(typeName_) {\
+                                                                FARAABIN_VAR_TYPE_LAYOUT_FUNC_START_(typeName_);
                                                                   
-    #define sm_(memberTypeName_, memberName_)                   FARAABIN_VAR_TYPE_STRUCT_MEMBER_(memberTypeName_, memberName_, 1)
-    #define sma_(memberTypeName_, memberName_, arraySize_)      FARAABIN_VAR_TYPE_STRUCT_MEMBER_(memberTypeName_, memberName_, arraySize_)
-    #define typedef_struct_end_(typeName_)                      FARAABIN_VAR_TYPE_STRUCT_FUNC_END_(typeName_);}
+    #define sm_(memberTypeName_, memberName_)                   FARAABIN_VAR_TYPE_LAYOUT_MEMBER_(memberTypeName_, memberName_, 1)
+    #define sma_(memberTypeName_, memberName_, arraySize_)      FARAABIN_VAR_TYPE_LAYOUT_MEMBER_(memberTypeName_, memberName_, arraySize_)
+    #define typedef_struct_end_(typeName_)                      FARAABIN_VAR_TYPE_LAYOUT_FUNC_END_(typeName_);}\
+                                                                FARAABIN_VAR_TYPE_LAYOUT_SEND_FUNC_(typeName_)
 
     #define typedef_enum_(typeName_)                            FARAABIN_VAR_TYPE_DEF_(typeName_);\
                                                                 static FARAABIN_VAR_TYPE_ENUM_FUNC_(typeName_) {\
@@ -32,7 +32,21 @@ extern "C" {
 
 #include "faraabin_config.h"
 
+#include <stddef.h>
+
 /* Exported defines ----------------------------------------------------------*/
+#define FB_VARTYPE_PRIMITIVE_ID_bool_t     eVAR_DATA_TYPE_PRIMITIVE_BOOL     /*!< Primitive ID of bool_t. */
+#define FB_VARTYPE_PRIMITIVE_ID_uint8_t    eVAR_DATA_TYPE_PRIMITIVE_UINT8    /*!< Primitive ID of uint8_t. */
+#define FB_VARTYPE_PRIMITIVE_ID_int8_t     eVAR_DATA_TYPE_PRIMITIVE_INT8     /*!< Primitive ID of int8_t. */
+#define FB_VARTYPE_PRIMITIVE_ID_uint16_t   eVAR_DATA_TYPE_PRIMITIVE_UINT16   /*!< Primitive ID of uint16_t. */
+#define FB_VARTYPE_PRIMITIVE_ID_int16_t    eVAR_DATA_TYPE_PRIMITIVE_INT16    /*!< Primitive ID of int16_t. */
+#define FB_VARTYPE_PRIMITIVE_ID_uint32_t   eVAR_DATA_TYPE_PRIMITIVE_UINT32   /*!< Primitive ID of uint32_t. */
+#define FB_VARTYPE_PRIMITIVE_ID_int32_t    eVAR_DATA_TYPE_PRIMITIVE_INT32    /*!< Primitive ID of int32_t. */
+#define FB_VARTYPE_PRIMITIVE_ID_uint64_t   eVAR_DATA_TYPE_PRIMITIVE_UINT64   /*!< Primitive ID of uint64_t. */
+#define FB_VARTYPE_PRIMITIVE_ID_int64_t    eVAR_DATA_TYPE_PRIMITIVE_INT64    /*!< Primitive ID of int64_t. */
+#define FB_VARTYPE_PRIMITIVE_ID_float32_t  eVAR_DATA_TYPE_PRIMITIVE_FLOAT32  /*!< Primitive ID of float32_t. */
+#define FB_VARTYPE_PRIMITIVE_ID_float64_t  eVAR_DATA_TYPE_PRIMITIVE_FLOAT64  /*!< Primitive ID of float64_t. */
+
 /* Exported macro ------------------------------------------------------------*/
 #ifdef FARAABIN_ENABLE
 
@@ -48,6 +62,7 @@ extern "C" {
     __faraabin_vartype_##typeName_.Path = "System";\
     __faraabin_vartype_##typeName_.Size = sizeof(typeName_);\
     __faraabin_vartype_##typeName_.DataType = eVAR_DATA_TYPE_PRIMITIVE;\
+    __faraabin_vartype_##typeName_.PrimitiveId = (uint8_t)FB_VARTYPE_PRIMITIVE_ID_##typeName_;\
     __faraabin_vartype_##typeName_.fpSendMember = NULL;\
     uint8_t ret = fFaraabinFobjectVarType_Init(&(__faraabin_vartype_##typeName_));\
     (void)ret;\
@@ -123,6 +138,7 @@ extern "C" {
     __faraabin_vartype_##typeName_.Path = (char*)path_;\
     __faraabin_vartype_##typeName_.Size = sizeof(typeName_);\
     __faraabin_vartype_##typeName_.DataType = eVAR_DATA_TYPE_USER_DEFINED_STRUCT;\
+    __faraabin_vartype_##typeName_.PrimitiveId = (uint8_t)eVAR_DATA_TYPE_PRIMITIVE_NONE;\
     __faraabin_vartype_##typeName_.fpSendMember = __faraabin_vartype_member_func_##typeName_;\
     uint8_t ret = fFaraabinFobjectVarType_Init(&(__faraabin_vartype_##typeName_));\
     (void)ret;\
@@ -158,7 +174,7 @@ extern "C" {
  * 
  * @param typeName_ Name of the variable type.
  */
-#define FARAABIN_VAR_TYPE_STRUCT_FUNC_START_(typeName_) typeName_ *__faraabin_type_ptr
+#define FARAABIN_VAR_TYPE_STRUCT_FUNC_START_(typeName_) typeName_ *__faraabin_type_ptr = NULL
 
 /**
  * @brief This macro can be used as an end tag inside FARAABIN_VAR_TYPE_STRUCT_FUNC_()
@@ -186,6 +202,108 @@ extern "C" {
     #memberName_,\
     reqSeq)
 
+/**
+ * @brief Defines a user-defined structure type globally, along with its constant layout table.
+ * 
+ * @note The layout table is implemented by FARAABIN_VAR_TYPE_LAYOUT_FUNC_() and the member dictionary
+ *       is sent from that table, so FARAABIN_VAR_TYPE_STRUCT_FUNC_() is not needed for this type.
+ *       The type is initialized with FARAABIN_VAR_TYPE_STRUCT_INIT_() as usual.
+ * 
+ * @param typeName_ Name of the data type.
+ */
+#define FARAABIN_VAR_TYPE_LAYOUT_DEF_(typeName_) \
+  static const sFaraabinFobjectVarType_Member* __faraabin_vartype_layout_func_##typeName_(uint16_t index);\
+  sFaraabinFobjectVarType __faraabin_vartype_##typeName_ = {.fpGetMember = __faraabin_vartype_layout_func_##typeName_};\
+  void __faraabin_vartype_member_func_##typeName_(uint32_t structPtr, uint8_t reqSeq)
+
+/**
+ * @brief Declares the layout table function of a structure type.
+ * 
+ * @note The function returns the constant layout entry of the member at the given index
+ *       and NULL after the last member.
+ * 
+ * @param typeName_ Name of the variable type.
+ */
+#define FARAABIN_VAR_TYPE_LAYOUT_FUNC_(typeName_) \
+  static const sFaraabinFobjectVarType_Member* __faraabin_vartype_layout_func_##typeName_(uint16_t index)
+
+/**
+ * @brief Start tag inside FARAABIN_VAR_TYPE_LAYOUT_FUNC_() before declaring members using FARAABIN_VAR_TYPE_LAYOUT_MEMBER_().
+ * 
+ * @param typeName_ Name of the variable type.
+ */
+#define FARAABIN_VAR_TYPE_LAYOUT_FUNC_START_(typeName_) \
+  typedef typeName_ __faraabin_layout_t;\
+  uint16_t __faraabin_member_index = 0U
+
+/**
+ * @brief End tag inside FARAABIN_VAR_TYPE_LAYOUT_FUNC_() after declaring all members.
+ * 
+ * @param typeName_ Name of the variable type.
+ */
+#define FARAABIN_VAR_TYPE_LAYOUT_FUNC_END_(typeName_) \
+  (void)__faraabin_member_index;\
+  return NULL
+
+/**
+ * @brief Declares each member (field) of the structure inside the layout table function.
+ * 
+ * @note Each member generates one constant entry in flash. All values are compile-time constants.
+ * 
+ * @param memberType_ Type of the member inside the structure. It can be a primitive type or
+ *                    a user-defined type that has been already introduced to faraabin.
+ * @param memberName_ Name of the structure member.
+ * @param memberArrayQty_ Number of elements if corresponding member is an array.
+ */
+#define FARAABIN_VAR_TYPE_LAYOUT_MEMBER_(memberType_, memberName_, memberArrayQty_) \
+  {\
+    static const sFaraabinFobjectVarType_Member __faraabin_member = {\
+      .Name = #memberName_,\
+      .VarType = &(__faraabin_vartype_##memberType_),\
+      .Offset = (uint16_t)offsetof(__faraabin_layout_t, memberName_),\
+      .Size = (uint16_t)sizeof(((__faraabin_layout_t*)0)->memberName_),\
+      .ArrayQty = (uint16_t)(memberArrayQty_)\
+    };\
+    if(index == __faraabin_member_index) {\
+      return &__faraabin_member;\
+    }\
+    __faraabin_member_index++;\
+  }
+
+/**
+ * @brief Implements the member dictionary function of a structure type from its layout table.
+ * 
+ * @note Place it after FARAABIN_VAR_TYPE_LAYOUT_FUNC_() without a trailing semicolon.
+ * 
+ * @param typeName_ Name of the variable type.
+ */
+#define FARAABIN_VAR_TYPE_LAYOUT_SEND_FUNC_(typeName_) \
+  FARAABIN_VAR_TYPE_STRUCT_FUNC_(typeName_) {\
+    fFaraabinLinkSerializer_VarTypeLayoutDict(structPtr, reqSeq);\
+  }
+
+/**
+ * @brief Looks up a member of a structure type by its name.
+ * 
+ * @param typeName_ Name of the variable type.
+ * @param memberName_ Name of the member as a string.
+ * @return member Pointer to the constant layout entry or NULL.
+ */
+#define FARAABIN_VAR_TYPE_FIND_MEMBER_(typeName_, memberName_) \
+  fFaraabinFobjectVarType_FindMember(&(__faraabin_vartype_##typeName_), (memberName_))
+
+/**
+ * @brief Finds the next member that differs between two snapshots of a structure type.
+ * 
+ * @param typeName_ Name of the variable type.
+ * @param snapshotA_ Pointer to the first snapshot.
+ * @param snapshotB_ Pointer to the second snapshot.
+ * @param fromIndex_ Index of the member to start from.
+ * @return index Index of the changed member or FB_VARTYPE_MEMBER_NONE.
+ */
+#define FARAABIN_VAR_TYPE_NEXT_CHANGED_MEMBER_(typeName_, snapshotA_, snapshotB_, fromIndex_) \
+  fFaraabinFobjectVarType_NextChangedMember(&(__faraabin_vartype_##typeName_), (snapshotA_), (snapshotB_), (fromIndex_))
+
 /**
  * @brief Initiates an enumeration variable type.
  * 
@@ -201,6 +319,7 @@ extern "C" {
     __faraabin_vartype_##typeName_.Path = (char*)path_;\
     __faraabin_vartype_##typeName_.Size = sizeof(typeName_);\
     __faraabin_vartype_##typeName_.DataType = eVAR_DATA_TYPE_USER_DEFINED_ENUM;\
+    __faraabin_vartype_##typeName_.PrimitiveId = (uint8_t)eVAR_DATA_TYPE_PRIMITIVE_NONE;\
     __faraabin_vartype_##typeName_.fpSendMember = __faraabin_vartype_member_func_##typeName_;\
     uint8_t ret = fFaraabinFobjectVarType_Init(&(__faraabin_vartype_##typeName_));\
     (void)ret;\
@@ -29,6 +29,16 @@
 #include <stdlib.h>
 
 /* Private define ------------------------------------------------------------*/
+#define ARG_POOL_INVALID_BLOCK  (0xFFFFU)  /*!< Returned by argument pool when no contiguous free blocks are found. */
+
+#if (FB_MAX_CONCURRENT_FUNCTION >= FB_FENGINE_INVALID_HANDLE)
+  #error "Maximum concurrent functions quantity is 254"
+#endif
+
+#if (FB_FUNCTION_PARAM_BUFFER_SIZE > (FB_FUNCTION_ARG_POOL_BLOCK_SIZE * FB_FUNCTION_ARG_POOL_BLOCK_QTY))
+  #error "Function argument pool is smaller than FB_FUNCTION_PARAM_BUFFER_SIZE"
+#endif
+
 /* Private macro -------------------------------------------------------------*/
 /* Private typedef -----------------------------------------------------------*/
 /**
@@ -39,10 +49,16 @@ typedef struct {
 
   sFaraabinFobjectFunction* Function;           /*!< Pointer to the function fobject. */
   
-  uint8_t Param[FB_FUNCTION_PARAM_BUFFER_SIZE]; /*!< Function arguments buffer. */
+  uint8_t *Param;                               /*!< Function arguments buffer allocated from the argument pool. */
+  
+  uint16_t _paramBlockIndex;                    /*!< Index of the first argument pool block owned by this item. */
+  
+  uint16_t _paramBlockQty;                      /*!< Number of argument pool blocks owned by this item. */
   
   bool IsFirstRun;                              /*!< Is first run flag. */
   
+  uint16_t _resume;                             /*!< Resume point of a coroutine function in this execution. '0' means start of the coroutine. */
+  
   sChrono _chrono;                              /*!< Internal chrono for time measurement puroposes. */
   
   uint8_t _result;                              /*!< Function execution result. */
@@ -57,15 +73,39 @@ typedef struct {
   
   bool IsRunning;                               /*!< Is function running flag. */
   
+  sFaraabinFunctionEngine_Stats Stats;          /*!< Scheduling statistics of this execution. */
+  
+  uint8_t _prev;                                /*!< Handle of the previous item in active list. */
+  
+  uint8_t _next;                                /*!< Handle of the next item in active list or free list. */
+  
 }sFaraabinFunctionEngine_Item;
 
 /* Private variables ---------------------------------------------------------*/
 static sFaraabinFunctionEngine_Item FunctionsList[FB_MAX_CONCURRENT_FUNCTION];
+static uint8_t FreeHead;
+static uint8_t ActiveHead;
+static uint8_t ActiveTail;
+static uint16_t ActiveQty;
+static uint16_t RunningQty;
+static uint8_t RunCursor;
+static sFaraabinFunctionEngine_Item *CurrentItem;
+static uint16_t OrphanResume;
+
+static uint8_t ArgPoolArena[FB_FUNCTION_ARG_POOL_BLOCK_SIZE * FB_FUNCTION_ARG_POOL_BLOCK_QTY];
+static bool ArgPoolBlockUsed[FB_FUNCTION_ARG_POOL_BLOCK_QTY];
+static uint16_t ArgPoolUsedBlocks;
+static uint16_t ArgPoolHighWaterBlocks;
 
 /* Private function prototypes -----------------------------------------------*/
-static sFaraabinFunctionEngine_Item* fFindFunction(uint32_t functionPtr, uint32_t objectPtr);
+static sFaraabinFunctionEngine_Item* fFindFunction(uint32_t functionPtr, uint32_t objectPtr, uint8_t handle);
 static sFaraabinFunctionEngine_Item* fFindRunningFunction(uint32_t functionPtr, uint32_t objectPtr);
-static uint8_t fFaraabinFn_GetFreeIndex(void);
+static uint8_t fAcquireItem(void);
+static void fReleaseItem(sFaraabinFunctionEngine_Item *item);
+static void fSetRunning(sFaraabinFunctionEngine_Item *item, bool isRunning);
+static bool fRunSlice(sFaraabinFunctionEngine_Item *item);
+static uint16_t fArgPoolAlloc(uint16_t blockQty);
+static void fArgPoolFree(sFaraabinFunctionEngine_Item *item);
 
 /* Variables -----------------------------------------------------------------*/
 
@@ -83,67 +123,94 @@ uint8_t fFaraabinFunctionEngine_Init(void) {
   for(uint16_t i = 0; i < FB_MAX_CONCURRENT_FUNCTION; i++) {
     
     FunctionsList[i].Function = NULL;
-    if(memset(FunctionsList[i].Param, 0x00, sizeof(FunctionsList[i].Param)) == NULL) {
-      return 1;
-    }
+    FunctionsList[i].Param = NULL;
+    FunctionsList[i]._paramBlockIndex = 0U;
+    FunctionsList[i]._paramBlockQty = 0U;
     FunctionsList[i].IsFirstRun = false;
+    FunctionsList[i]._resume = 0U;
     FunctionsList[i]._result = 0U;
     FunctionsList[i].fpUserTerminalCallback = NULL;
     FunctionsList[i].Status = eFN_STATUS_STOP;
     FunctionsList[i].ObjectPtr = 0U;
     FunctionsList[i].IsBusy = false;
     FunctionsList[i].IsRunning = false;
+    if(memset(&(FunctionsList[i].Stats), 0x00, sizeof(FunctionsList[i].Stats)) == NULL) {
+      return 1;
+    }
+    FunctionsList[i]._prev = FB_FENGINE_INVALID_HANDLE;
+    FunctionsList[i]._next = ((i + 1U) < FB_MAX_CONCURRENT_FUNCTION) ? (uint8_t)(i + 1U) : FB_FENGINE_INVALID_HANDLE;
     
     fChrono_Stop(&FunctionsList[i]._chrono);
 
   }
   
+  FreeHead = 0U;
+  ActiveHead = FB_FENGINE_INVALID_HANDLE;
+  ActiveTail = FB_FENGINE_INVALID_HANDLE;
+  ActiveQty = 0U;
+  RunningQty = 0U;
+  RunCursor = FB_FENGINE_INVALID_HANDLE;
+  CurrentItem = NULL;
+  OrphanResume = 0U;
+  
+  for(uint16_t i = 0; i < FB_FUNCTION_ARG_POOL_BLOCK_QTY; i++) {
+    ArgPoolBlockUsed[i] = false;
+  }
+  ArgPoolUsedBlocks = 0U;
+  ArgPoolHighWaterBlocks = 0U;
+  
   return 0;
 }
 
 /**
  * @brief Runs Faraabin function engine.
  * 
+ * @note Running functions are resumed in round-robin order starting from the one after the last function
+ *       that was served in the previous pass. Each function gets (Priority + 1) consecutive slices per pass.
+ *       The pass ends as soon as FB_FUNCTION_ENGINE_PASS_BUDGET_US is consumed, so a long function can not
+ *       starve the rest of the application loop. Remaining functions are served first in the next pass.
+ * 
  */
 void fFaraabinFunctionEngine_Run(void) {
   
-  // Run Function
-  for(uint16_t i = 0; i < FB_MAX_CONCURRENT_FUNCTION; i++) {
+  tick_t passStartTick = fChrono_GetTick();
+  uint8_t handle = (RunCursor != FB_FENGINE_INVALID_HANDLE) ? RunCursor : ActiveHead;
+  uint16_t qty = ActiveQty;
+  
+  for(uint16_t n = 0; (n < qty) && (handle != FB_FENGINE_INVALID_HANDLE); n++) {
     
-    sFaraabinFunctionEngine_Item *item = &(FunctionsList[i]);
+    sFaraabinFunctionEngine_Item *item = &(FunctionsList[handle]);
     
-    if(item->IsRunning == false) {
-      continue;
-    }
+    handle = item->_next;
     
-    if(item->Function->FunctionPtr != NULL) {
+    if((item->IsRunning == true) && (item->Function->FunctionPtr != NULL)) {
       
-			if(item->IsFirstRun) {
-				fChrono_Start(&(item->_chrono));
-			}
-      uint8_t res = item->Function->FunctionPtr(item->ObjectPtr, (char*)item->Param, item->IsFirstRun);
-      item->IsFirstRun = false;
+      uint16_t slices = (uint16_t)item->Function->Priority + 1U;
       
-      if(res != FUNCTION_CONTINUE) {
+      while(slices > 0U) {
         
-        item->IsBusy = false;
-        item->IsRunning = false;
-          
-				uByte4 executeUs;
-				executeUs.U32 = fChrono_ElapsedUs(&(item->_chrono));
-				
-				uint8_t arg[5];
-				arg[0] = res;
-				arg[1] = executeUs.Byte[0];
-				arg[2] = executeUs.Byte[1];
-				arg[3] = executeUs.Byte[2];
-				arg[4] = executeUs.Byte[3];
-				
-        Faraabin_EventSystemExtended_ParamEnd_((uint32_t)item->Function, item->ObjectPtr, &(item->Function->Seq), true, eFN_EVENT_INFO_STOP, arg, sizeof(arg));
+        slices--;
         
+        if(!fRunSlice(item)) {
+          break;
+        }
+        
+        if(fChrono_TimeSpanUs(passStartTick, fChrono_GetTick()) >= FB_FUNCTION_ENGINE_PASS_BUDGET_US) {
+          break;
+        }
       }
     }
+    
+    if(handle == FB_FENGINE_INVALID_HANDLE) {
+      handle = ActiveHead;
+    }
+    
+    if(fChrono_TimeSpanUs(passStartTick, fChrono_GetTick()) >= FB_FUNCTION_ENGINE_PASS_BUDGET_US) {
+      break;
+    }
   }
+  
+  RunCursor = handle;
 }
 
 /**
@@ -153,34 +220,60 @@ void fFaraabinFunctionEngine_Run(void) {
  * @param objectPtr Pointer to the object attached to the function group.
  * @param arg Pointer to the buffer containing the function arguments.
  * @param argSize Size of function arguments.
+ * @param handle Pointer to store the handle of the started function. It can be used for later lookups.
  * @return result A value form FUNCTION_ENGINE_RESULT group.
  */
-uint8_t fFaraabinFunctionEngine_Start(uint32_t functionPtr, uint32_t objectPtr, uint8_t* arg, uint16_t argSize) {
+uint8_t fFaraabinFunctionEngine_Start(uint32_t functionPtr, uint32_t objectPtr, uint8_t* arg, uint16_t argSize, uint8_t *handle) {
 
   if(fFindRunningFunction(functionPtr, objectPtr) != NULL) {
     
     return FB_FENGINE_FUNCTION_ALREADY_RUNNING;
   }
 
-  uint8_t freeIndex = fFaraabinFn_GetFreeIndex();
-  if(freeIndex == 255U) {
+  if(((uint32_t)argSize + 1U) > FB_FUNCTION_PARAM_BUFFER_SIZE) {
+    
+    return FB_FENGINE_ARG_TOO_LARGE;
+  }
+
+  if(FreeHead == FB_FENGINE_INVALID_HANDLE) {
 
     return FB_FENGINE_MAX_CONCURRENT_LIMIT_REACHED;
   }
+  
+  uint16_t blockQty = (uint16_t)((argSize + FB_FUNCTION_ARG_POOL_BLOCK_SIZE) / FB_FUNCTION_ARG_POOL_BLOCK_SIZE);
+  uint16_t blockIndex = fArgPoolAlloc(blockQty);
+  if(blockIndex == ARG_POOL_INVALID_BLOCK) {
+    
+    return FB_FENGINE_ARG_POOL_EXHAUSTED;
+  }
+  
+  uint8_t freeIndex = fAcquireItem();
+  sFaraabinFunctionEngine_Item *item = &(FunctionsList[freeIndex]);
+  
+  item->_paramBlockIndex = blockIndex;
+  item->_paramBlockQty = blockQty;
+  item->Param = &(ArgPoolArena[blockIndex * FB_FUNCTION_ARG_POOL_BLOCK_SIZE]);
 
   for(uint16_t i = 0; i < argSize; i++) {
     
-    FunctionsList[freeIndex].Param[i] = arg[i];
+    item->Param[i] = arg[i];
   }
 
-  FunctionsList[freeIndex].Param[argSize] = 0x00U;
+  item->Param[argSize] = 0x00U;
   
-  FunctionsList[freeIndex].ObjectPtr = objectPtr;
-  FunctionsList[freeIndex].IsFirstRun = true;
+  item->ObjectPtr = objectPtr;
+  item->IsFirstRun = true;
+  item->_resume = 0U;
   
-  FunctionsList[freeIndex].Function = (sFaraabinFobjectFunction*)functionPtr;
-  FunctionsList[freeIndex].IsBusy = true;
-  FunctionsList[freeIndex].IsRunning = true;
+  item->Function = (sFaraabinFobjectFunction*)functionPtr;
+  item->IsBusy = true;
+  fSetRunning(item, true);
+  
+  if(memset(&(item->Stats), 0x00, sizeof(item->Stats)) == NULL) {
+    // |Not going to happen.
+  }
+  
+  *handle = freeIndex;
 
   return FB_FENGINE_FUNCTION_CMD_OK;
 }
@@ -190,18 +283,18 @@ uint8_t fFaraabinFunctionEngine_Start(uint32_t functionPtr, uint32_t objectPtr,
  * 
  * @param functionPtr Pointer to the function fobject.
  * @param objectPtr Pointer to the object attached to the function group.
+ * @param handle Handle returned by fFaraabinFunctionEngine_Start(). FB_FENGINE_INVALID_HANDLE if not known.
  * @return result A value form FUNCTION_ENGINE_RESULT group.
  */
-uint8_t fFaraabinFunctionEngine_Stop(uint32_t functionPtr, uint32_t objectPtr) {
+uint8_t fFaraabinFunctionEngine_Stop(uint32_t functionPtr, uint32_t objectPtr, uint8_t handle) {
 
-  sFaraabinFunctionEngine_Item* item = (sFaraabinFunctionEngine_Item*)fFindFunction(functionPtr, objectPtr);
+  sFaraabinFunctionEngine_Item* item = fFindFunction(functionPtr, objectPtr, handle);
 
   if(item == NULL) {
     return FB_FENGINE_FUNCTION_NOT_IN_LIST;
   }
 
-  item->IsBusy = false;
-  item->IsRunning = false;
+  fReleaseItem(item);
 
   return FB_FENGINE_FUNCTION_CMD_OK;
 }
@@ -211,18 +304,18 @@ uint8_t fFaraabinFunctionEngine_Stop(uint32_t functionPtr, uint32_t objectPtr) {
  * 
  * @param functionPtr Pointer to the function fobject.
  * @param objectPtr Pointer to the object attached to the function group.
+ * @param handle Handle returned by fFaraabinFunctionEngine_Start(). FB_FENGINE_INVALID_HANDLE if not known.
  * @return result A value form FUNCTION_ENGINE_RESULT group.
  */
-uint8_t fFaraabinFunctionEngine_Pause(uint32_t functionPtr, uint32_t objectPtr) {
+uint8_t fFaraabinFunctionEngine_Pause(uint32_t functionPtr, uint32_t objectPtr, uint8_t handle) {
 
-  sFaraabinFunctionEngine_Item* item = (sFaraabinFunctionEngine_Item*)fFindFunction(functionPtr, objectPtr);
+  sFaraabinFunctionEngine_Item* item = fFindFunction(functionPtr, objectPtr, handle);
 
   if(item == NULL) {
     return FB_FENGINE_FUNCTION_NOT_IN_LIST;
   }
 
-  item->IsBusy = true;
-  item->IsRunning = false;
+  fSetRunning(item, false);
 
   return FB_FENGINE_FUNCTION_CMD_OK;
 }
@@ -232,18 +325,18 @@ uint8_t fFaraabinFunctionEngine_Pause(uint32_t functionPtr, uint32_t objectPtr)
  * 
  * @param functionPtr Pointer to the function fobject.
  * @param objectPtr Pointer to the object attached to the function group.
+ * @param handle Handle returned by fFaraabinFunctionEngine_Start(). FB_FENGINE_INVALID_HANDLE if not known.
  * @return result A value form FUNCTION_ENGINE_RESULT group.
  */
-uint8_t fFaraabinFunctionEngine_Resume(uint32_t functionPtr, uint32_t objectPtr) {
+uint8_t fFaraabinFunctionEngine_Resume(uint32_t functionPtr, uint32_t objectPtr, uint8_t handle) {
 
-  sFaraabinFunctionEngine_Item* item = (sFaraabinFunctionEngine_Item*)fFindFunction(functionPtr, objectPtr);
+  sFaraabinFunctionEngine_Item* item = fFindFunction(functionPtr, objectPtr, handle);
 
   if(item == NULL) {
     return FB_FENGINE_FUNCTION_NOT_IN_LIST;
   }
 
-  item->IsBusy = true;
-  item->IsRunning = true;
+  fSetRunning(item, true);
 
   return FB_FENGINE_FUNCTION_CMD_OK;
 }
@@ -255,22 +348,48 @@ uint8_t fFaraabinFunctionEngine_Resume(uint32_t functionPtr, uint32_t objectPtr)
  */
 uint16_t fFaraabinFunctionEngine_GetQtyOfRunningFunctions(void) {
   
-  uint16_t cnt = 0;
+  return RunningQty;
+}
+
+/**
+ * @brief Gets the next running function in the active list.
+ * 
+ * @note Start the iteration by setting the handle to FB_FENGINE_INVALID_HANDLE. Iterating over all running functions costs
+ *       O(k) where k is the number of started functions.
+ * 
+ * @param handle Pointer to the iteration handle. It is updated to the handle of the found function.
+ * @param ptr Pointer of the function fobject.
+ * @param objectPtr Pointer of the object attached to the function group.
+ * @return result If a running function is found returns '0', otherwise returns '1'.
+ */
+uint8_t fFaraabinFunctionEngine_GetNextRunningFunction(uint8_t *handle, uint32_t *ptr, uint32_t *objectPtr) {
+  
+  uint8_t next = (*handle == FB_FENGINE_INVALID_HANDLE) ? ActiveHead : FunctionsList[*handle]._next;
   
-  for(uint16_t i = 0; i < FB_MAX_CONCURRENT_FUNCTION; i++) {
+  while(next != FB_FENGINE_INVALID_HANDLE) {
     
-    if(FunctionsList[i].IsRunning == true) {
+    if(FunctionsList[next].IsRunning == true) {
       
-      cnt++;
+      *handle = next;
+      *ptr = (uint32_t)FunctionsList[next].Function;
+      *objectPtr = FunctionsList[next].ObjectPtr;
+      
+      return 0;
     }
+    
+    next = FunctionsList[next]._next;
   }
   
-  return cnt;
+  *handle = FB_FENGINE_INVALID_HANDLE;
+  
+  return 1;
 }
 
 /**
  * @brief Gets the pointer of the function fobjects that are running by the engine.
  * 
+ * @note Prefer fFaraabinFunctionEngine_GetNextRunningFunction() for enumerating all running functions.
+ * 
  * @param index Index in function engine list.
  * @param ptr Pointer of the function fobject.
  * @param objectPtr Pointer of the object attached to the function group.
@@ -278,47 +397,105 @@ uint16_t fFaraabinFunctionEngine_GetQtyOfRunningFunctions(void) {
  */
 uint8_t fFaraabinFunctionEngine_GetPtrsOfRunningFunction(uint16_t index, uint32_t *ptr, uint32_t *objectPtr) {
   
-  if(index >= fFaraabinFunctionEngine_GetQtyOfRunningFunctions()) {
+  if(index >= RunningQty) {
     return 1;
   }
   
-  uint16_t cnt = 0;
+  uint8_t handle = FB_FENGINE_INVALID_HANDLE;
   
-  for(uint16_t i = 0; i < FB_MAX_CONCURRENT_FUNCTION; i++) {
+  for(uint16_t i = 0; i <= index; i++) {
     
-    if(FunctionsList[i].IsRunning == true) {
-      
-      if(cnt == index) {
-        
-        *ptr = (uint32_t)FunctionsList[i].Function;
-        *objectPtr = FunctionsList[i].ObjectPtr;
-        
-        break;
-      }
-      
-      cnt++;
+    if(fFaraabinFunctionEngine_GetNextRunningFunction(&handle, ptr, objectPtr) != 0U) {
+      return 1;
     }
   }
   
   return 0;
 }
 
+/**
+ * @brief Gets the scheduling statistics of a function that is started by the engine.
+ * 
+ * @param functionPtr Pointer to the function fobject.
+ * @param objectPtr Pointer to the object attached to the function group.
+ * @param stats Pointer to the statistics object to be filled.
+ * @return result A value form FUNCTION_ENGINE_RESULT group.
+ */
+uint8_t fFaraabinFunctionEngine_GetStats(uint32_t functionPtr, uint32_t objectPtr, sFaraabinFunctionEngine_Stats *stats) {
+  
+  sFaraabinFunctionEngine_Item* item = fFindFunction(functionPtr, objectPtr, FB_FENGINE_INVALID_HANDLE);
+  
+  if(item == NULL) {
+    return FB_FENGINE_FUNCTION_NOT_IN_LIST;
+  }
+  
+  *stats = item->Stats;
+  
+  return FB_FENGINE_FUNCTION_CMD_OK;
+}
+
+/**
+ * @brief Gets the usage of the function argument pool.
+ * 
+ * @param usedBlocks Number of blocks currently allocated to started functions.
+ * @param highWaterBlocks Maximum number of blocks that were allocated at the same time since initialization.
+ */
+void fFaraabinFunctionEngine_GetArgPoolUsage(uint16_t *usedBlocks, uint16_t *highWaterBlocks) {
+  
+  *usedBlocks = ArgPoolUsedBlocks;
+  *highWaterBlocks = ArgPoolHighWaterBlocks;
+}
+
+/**
+ * @brief Gets the resume point of the coroutine that is being executed by the engine.
+ * 
+ * @note Resume point is kept per execution, so the same coroutine function can run on several objects concurrently.
+ *       If it is called outside of a slice, a shared dummy resume point is returned.
+ * 
+ * @return resumePtr Pointer to the resume point of the current execution.
+ */
+uint16_t* fFaraabinFunctionEngine_GetResumePoint(void) {
+  
+  return (CurrentItem != NULL) ? &(CurrentItem->_resume) : &OrphanResume;
+}
+
 /*
 ===============================================================================
                 ##### faraabin_fobject_function.c Private Functions #####
 ===============================================================================*/
 
 /**
- * @brief Finds a function in engine's list.
+ * @brief Finds a started function in engine's active list.
+ * 
+ * @note If the handle is known, lookup is O(1) and the handle must point to a started item with the same function and object.
+ *       A stale or invalid handle is rejected, so a command never acts on another execution. If the handle is
+ *       FB_FENGINE_INVALID_HANDLE, the active list is searched.
  * 
  * @param functionPtr Pointer of the function.
- * @return objectPtr Pointer of the object attached to function group.
+ * @param objectPtr Pointer of the object attached to function group.
+ * @param handle Handle returned by fFaraabinFunctionEngine_Start() or FB_FENGINE_INVALID_HANDLE.
+ * @return item Pointer to the engine item. NULL if not found.
  */
-static sFaraabinFunctionEngine_Item* fFindFunction(uint32_t functionPtr, uint32_t objectPtr) {
+static sFaraabinFunctionEngine_Item* fFindFunction(uint32_t functionPtr, uint32_t objectPtr, uint8_t handle) {
   
-  for(uint16_t i = 0; i < FB_MAX_CONCURRENT_FUNCTION; i++) {
+  if(handle != FB_FENGINE_INVALID_HANDLE) {
+    
+    if(handle >= FB_MAX_CONCURRENT_FUNCTION) {
+      return NULL;
+    }
+    
+    sFaraabinFunctionEngine_Item *item = &(FunctionsList[handle]);
+    
+    if(item->IsBusy && ((uint32_t)(item->Function) == functionPtr) && (item->ObjectPtr == objectPtr)) {
+      return item;
+    }
+    
+    return NULL;
+  }
+  
+  for(uint8_t i = ActiveHead; i != FB_FENGINE_INVALID_HANDLE; i = FunctionsList[i]._next) {
     
-    if(((uint32_t)(FunctionsList[i].Function) == functionPtr) && ((uint32_t)(FunctionsList[i].ObjectPtr == objectPtr))) {
+    if(((uint32_t)(FunctionsList[i].Function) == functionPtr) && (FunctionsList[i].ObjectPtr == objectPtr)) {
       return &(FunctionsList[i]);
     }
   }
@@ -327,16 +504,17 @@ static sFaraabinFunctionEngine_Item* fFindFunction(uint32_t functionPtr, uint32_
 }
 
 /**
- * @brief Finds a running function in the list.
+ * @brief Finds a running function in the active list.
  * 
  * @param functionPtr Pointer of the function.
- * @return objectPtr Pointer of the object attached to function group.
+ * @param objectPtr Pointer of the object attached to function group.
+ * @return item Pointer to the engine item. NULL if not found.
  */
 static sFaraabinFunctionEngine_Item* fFindRunningFunction(uint32_t functionPtr, uint32_t objectPtr) {
   
-  for(uint16_t i = 0; i < FB_MAX_CONCURRENT_FUNCTION; i++) {
+  for(uint8_t i = ActiveHead; i != FB_FENGINE_INVALID_HANDLE; i = FunctionsList[i]._next) {
     
-    if(((uint32_t)(FunctionsList[i].Function) == functionPtr) && ((uint32_t)(FunctionsList[i].ObjectPtr == objectPtr))) {
+    if(((uint32_t)(FunctionsList[i].Function) == functionPtr) && (FunctionsList[i].ObjectPtr == objectPtr)) {
       
       if(FunctionsList[i].IsRunning) {
         return &(FunctionsList[i]);
@@ -348,21 +526,224 @@ static sFaraabinFunctionEngine_Item* fFindRunningFunction(uint32_t functionPtr,
 }
 
 /**
- * @brief Gets the index of free place in engine's list.
+ * @brief Pops an item from free list and appends it to the tail of active list.
  * 
- * @return numOfFree Free place index in the list. If list is full, '255' is returned.
+ * @return handle Handle of the acquired item. Caller must check that the free list is not empty.
  */
-static uint8_t fFaraabinFn_GetFreeIndex(void) {
+static uint8_t fAcquireItem(void) {
   
-  for(uint16_t i = 0; i < FB_MAX_CONCURRENT_FUNCTION; i++) {
+  uint8_t handle = FreeHead;
+  sFaraabinFunctionEngine_Item *item = &(FunctionsList[handle]);
+  
+  FreeHead = item->_next;
+  
+  item->_prev = ActiveTail;
+  item->_next = FB_FENGINE_INVALID_HANDLE;
+  if(ActiveTail != FB_FENGINE_INVALID_HANDLE) {
+    FunctionsList[ActiveTail]._next = handle;
+  } else {
+    ActiveHead = handle;
+  }
+  ActiveTail = handle;
+  ActiveQty++;
+  
+  return handle;
+}
+
+/**
+ * @brief Unlinks an item from active list, frees its arguments and pushes it to free list.
+ * 
+ * @param item Pointer to the engine item.
+ */
+static void fReleaseItem(sFaraabinFunctionEngine_Item *item) {
+  
+  uint8_t handle = (uint8_t)(item - FunctionsList);
+  
+  fSetRunning(item, false);
+  item->IsBusy = false;
+  fArgPoolFree(item);
+  
+  if(RunCursor == handle) {
+    RunCursor = item->_next;
+  }
+  
+  if(item->_prev != FB_FENGINE_INVALID_HANDLE) {
+    FunctionsList[item->_prev]._next = item->_next;
+  } else {
+    ActiveHead = item->_next;
+  }
+  
+  if(item->_next != FB_FENGINE_INVALID_HANDLE) {
+    FunctionsList[item->_next]._prev = item->_prev;
+  } else {
+    ActiveTail = item->_prev;
+  }
+  ActiveQty--;
+  
+  item->_prev = FB_FENGINE_INVALID_HANDLE;
+  item->_next = FreeHead;
+  FreeHead = handle;
+}
+
+/**
+ * @brief Sets running state of an item and keeps the running functions counter consistent.
+ * 
+ * @param item Pointer to the engine item.
+ * @param isRunning New running state.
+ */
+static void fSetRunning(sFaraabinFunctionEngine_Item *item, bool isRunning) {
+  
+  if(item->IsRunning == isRunning) {
+    return;
+  }
+  
+  item->IsRunning = isRunning;
+  if(isRunning) {
+    RunningQty++;
+  } else {
+    RunningQty--;
+  }
+}
+
+/**
+ * @brief Executes one slice of a function and updates its statistics.
+ * 
+ * @note A slice is a single call of the function handler. Returning FUNCTION_CONTINUE yields the CPU back
+ *       to the engine. A slice that takes longer than the function slice budget is counted as an overrun.
+ * 
+ * @param item Pointer to the engine item.
+ * @return isContinue Returns true if the function yielded and must be resumed later.
+ */
+static bool fRunSlice(sFaraabinFunctionEngine_Item *item) {
+  
+  if(item->IsFirstRun) {
+    fChrono_Start(&(item->_chrono));
+  }
+  
+  tick_t sliceStartTick = fChrono_GetTick();
+  CurrentItem = item;
+  uint8_t res = item->Function->FunctionPtr(item->ObjectPtr, (char*)item->Param, item->IsFirstRun);
+  CurrentItem = NULL;
+  timeUs_t sliceUs = fChrono_TimeSpanUs(sliceStartTick, fChrono_GetTick());
+  item->IsFirstRun = false;
+  
+  timeUs_t budgetUs = item->Function->SliceBudgetUs;
+  if(budgetUs == 0U) {
+    budgetUs = FB_FUNCTION_SLICE_BUDGET_US;
+  }
+  
+  item->Stats.RunCnt++;
+  item->Stats.LastRunUs = sliceUs;
+  item->Stats.TotalRunUs += sliceUs;
+  if(sliceUs > item->Stats.MaxRunUs) {
+    item->Stats.MaxRunUs = sliceUs;
+  }
+  if(sliceUs > budgetUs) {
+    item->Stats.OverrunCnt++;
+  }
+  
+  if(res == FUNCTION_CONTINUE) {
     
-    if(FunctionsList[i].IsBusy == false) {
+    item->Stats.YieldCnt++;
+    return true;
+  }
+  
+  uByte4 executeUs;
+  executeUs.U32 = fChrono_ElapsedUs(&(item->_chrono));
+  
+  /* Layout of this parameter is documented at eFN_EVENT_INFO_STOP. New fields must only be appended. */
+  uint8_t arg[17];
+  arg[0] = res;
+  arg[1] = executeUs.Byte[0];
+  arg[2] = executeUs.Byte[1];
+  arg[3] = executeUs.Byte[2];
+  arg[4] = executeUs.Byte[3];
+  
+  uByte4 stat;
+  stat.U32 = item->Stats.YieldCnt;
+  arg[5] = stat.Byte[0];
+  arg[6] = stat.Byte[1];
+  arg[7] = stat.Byte[2];
+  arg[8] = stat.Byte[3];
+  
+  stat.U32 = item->Stats.OverrunCnt;
+  arg[9] = stat.Byte[0];
+  arg[10] = stat.Byte[1];
+  arg[11] = stat.Byte[2];
+  arg[12] = stat.Byte[3];
+  
+  stat.U32 = item->Stats.MaxRunUs;
+  arg[13] = stat.Byte[0];
+  arg[14] = stat.Byte[1];
+  arg[15] = stat.Byte[2];
+  arg[16] = stat.Byte[3];
+  
+  Faraabin_EventSystemExtended_ParamEnd_((uint32_t)item->Function, item->ObjectPtr, &(item->Function->Seq), true, eFN_EVENT_INFO_STOP, arg, sizeof(arg));
+  
+  fReleaseItem(item);
+  
+  return false;
+}
+
+/**
+ * @brief Allocates contiguous blocks from the argument pool using first fit.
+ * 
+ * @note Arguments are passed to function handlers as a single string, so blocks of one argument must be contiguous.
+ * 
+ * @param blockQty Number of contiguous blocks to allocate.
+ * @return blockIndex Index of the first allocated block. ARG_POOL_INVALID_BLOCK if there is not enough contiguous space.
+ */
+static uint16_t fArgPoolAlloc(uint16_t blockQty) {
+  
+  uint16_t runStart = 0U;
+  uint16_t runLength = 0U;
+  
+  for(uint16_t i = 0; i < FB_FUNCTION_ARG_POOL_BLOCK_QTY; i++) {
+    
+    if(ArgPoolBlockUsed[i]) {
+      
+      runStart = i + 1U;
+      runLength = 0U;
+      continue;
+    }
+    
+    runLength++;
+    if(runLength == blockQty) {
+      
+      for(uint16_t j = runStart; j <= i; j++) {
+        ArgPoolBlockUsed[j] = true;
+      }
+      
+      ArgPoolUsedBlocks += blockQty;
+      if(ArgPoolUsedBlocks > ArgPoolHighWaterBlocks) {
+        ArgPoolHighWaterBlocks = ArgPoolUsedBlocks;
+      }
       
-      return i;
+      return runStart;
     }
   }
   
-  return 255;
+  return ARG_POOL_INVALID_BLOCK;
+}
+
+/**
+ * @brief Returns argument pool blocks owned by an engine item.
+ * 
+ * @param item Pointer to the engine item.
+ */
+static void fArgPoolFree(sFaraabinFunctionEngine_Item *item) {
+  
+  if(item->_paramBlockQty == 0U) {
+    return;
+  }
+  
+  for(uint16_t i = 0; i < item->_paramBlockQty; i++) {
+    ArgPoolBlockUsed[item->_paramBlockIndex + i] = false;
+  }
+  
+  ArgPoolUsedBlocks -= item->_paramBlockQty;
+  item->_paramBlockQty = 0U;
+  item->Param = NULL;
 }
 
 /**
@@ -372,7 +753,7 @@ static uint8_t fFaraabinFn_GetFreeIndex(void) {
  */
 uint32_t fFaraabinFunctionEngine_GetRamUsage(void) {
 	
-	return sizeof(sFaraabinFunctionEngine_Item) * FB_MAX_CONCURRENT_FUNCTION;
+	return (sizeof(sFaraabinFunctionEngine_Item) * FB_MAX_CONCURRENT_FUNCTION) + sizeof(ArgPoolArena) + sizeof(ArgPoolBlockUsed);
 }
 
 /************************ © COPYRIGHT FaraabinCo *****END OF FILE****/
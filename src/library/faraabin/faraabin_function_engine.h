@@ -41,11 +41,35 @@ extern "C" {
 #define FB_FENGINE_FUNCTION_ALREADY_RUNNING       (1U)  /*!< Function engine CMD already running status. */
 #define FB_FENGINE_MAX_CONCURRENT_LIMIT_REACHED   (2U)  /*!< Function engine maximum concurrent executions are running. */
 #define FB_FENGINE_FUNCTION_NOT_IN_LIST           (3U)  /*!< Function engine function is not in the list. */
+#define FB_FENGINE_ARG_TOO_LARGE                  (4U)  /*!< Function arguments are larger than FB_FUNCTION_PARAM_BUFFER_SIZE. */
+#define FB_FENGINE_ARG_POOL_EXHAUSTED             (5U)  /*!< Not enough contiguous free blocks in the argument pool. */
 
 /** @} */ //End of FUNCTION_ENGINE_RESULT
 
+#define FB_FENGINE_INVALID_HANDLE                 (0xFFU) /*!< Handle value used when the engine handle of a function is not known. */
+
 /* Exported macro ------------------------------------------------------------*/
 /* Exported types ------------------------------------------------------------*/
+/**
+ * @brief Scheduling statistics of a function that is executed by the engine.
+ * 
+ */
+typedef struct {
+  
+  uint32_t RunCnt;      /*!< Number of slices executed. */
+  
+  uint32_t YieldCnt;    /*!< Number of times the function yielded by returning FUNCTION_CONTINUE. */
+  
+  uint32_t OverrunCnt;  /*!< Number of slices that took longer than the slice budget of the function. */
+  
+  timeUs_t LastRunUs;   /*!< Execution time of the last slice in micro-seconds. */
+  
+  timeUs_t MaxRunUs;    /*!< Maximum execution time of a slice in micro-seconds. */
+  
+  timeUs_t TotalRunUs;  /*!< Accumulated execution time of all slices in micro-seconds. */
+  
+}sFaraabinFunctionEngine_Stats;
+
 /* Exported constants --------------------------------------------------------*/
 /* Exported functions prototypes ---------------------------------------------*/
 /**
@@ -58,6 +82,8 @@ uint8_t fFaraabinFunctionEngine_Init(void);
 /**
  * @brief Runs the function engine.
  * 
+ * @note Running functions are resumed in round-robin order and the pass is limited to FB_FUNCTION_ENGINE_PASS_BUDGET_US.
+ * 
  */
 void fFaraabinFunctionEngine_Run(void);
 
@@ -68,36 +94,43 @@ void fFaraabinFunctionEngine_Run(void);
  * @param objectPtr Pointer to the object attached to the function group.
  * @param arg Pointer to the buffer containing the function arguments.
  * @param argSize Size of function arguments.
+ * @param handle Pointer to store the handle of the started function. It can be used for later lookups.
  * @return result A value form FUNCTION_ENGINE_RESULT group.
  */
-uint8_t fFaraabinFunctionEngine_Start(uint32_t functionPtr, uint32_t objectPtr, uint8_t* arg, uint16_t argSize);
+uint8_t fFaraabinFunctionEngine_Start(uint32_t functionPtr, uint32_t objectPtr, uint8_t* arg, uint16_t argSize, uint8_t *handle);
 
 /**
  * @brief Stops a function fobject from execution.
  * 
  * @param functionPtr Pointer to the function fobject.
  * @param objectPtr Pointer to the object attached to the function group.
+ * @param handle Handle returned by fFaraabinFunctionEngine_Start(). FB_FENGINE_INVALID_HANDLE if not known.
+ *               A handle that doesn't belong to a started execution of the function and object is rejected.
  * @return result A value form FUNCTION_ENGINE_RESULT group.
  */
-uint8_t fFaraabinFunctionEngine_Stop(uint32_t functionPtr, uint32_t objectPtr);
+uint8_t fFaraabinFunctionEngine_Stop(uint32_t functionPtr, uint32_t objectPtr, uint8_t handle);
 
 /**
  * @brief Pauses function fobject from execution.
  * 
  * @param functionPtr Pointer to the function fobject.
  * @param objectPtr Pointer to the object attached to the function group.
+ * @param handle Handle returned by fFaraabinFunctionEngine_Start(). FB_FENGINE_INVALID_HANDLE if not known.
+ *               A handle that doesn't belong to a started execution of the function and object is rejected.
  * @return result A value form FUNCTION_ENGINE_RESULT group.
  */
-uint8_t fFaraabinFunctionEngine_Pause(uint32_t functionPtr, uint32_t objectPtr);
+uint8_t fFaraabinFunctionEngine_Pause(uint32_t functionPtr, uint32_t objectPtr, uint8_t handle);
 
 /**
  * @brief Resumes an already paused function.
  * 
  * @param functionPtr Pointer to the function fobject.
  * @param objectPtr Pointer to the object attached to the function group.
+ * @param handle Handle returned by fFaraabinFunctionEngine_Start(). FB_FENGINE_INVALID_HANDLE if not known.
+ *               A handle that doesn't belong to a started execution of the function and object is rejected.
  * @return result A value form FUNCTION_ENGINE_RESULT group.
  */
-uint8_t fFaraabinFunctionEngine_Resume(uint32_t functionPtr, uint32_t objectPtr);
+uint8_t fFaraabinFunctionEngine_Resume(uint32_t functionPtr, uint32_t objectPtr, uint8_t handle);
 
 /**
  * @brief Gets the number of concurrent running function fobjects.
@@ -106,9 +139,24 @@ uint8_t fFaraabinFunctionEngine_Resume(uint32_t functionPtr, uint32_t objectPtr)
  */
 uint16_t fFaraabinFunctionEngine_GetQtyOfRunningFunctions(void);
 
+/**
+ * @brief Gets the next running function in the active list.
+ * 
+ * @note Start the iteration by setting the handle to FB_FENGINE_INVALID_HANDLE. Iterating over all running functions costs
+ *       O(k) where k is the number of started functions.
+ * 
+ * @param handle Pointer to the iteration handle. It is updated to the handle of the found function.
+ * @param ptr Pointer of the function fobject.
+ * @param objectPtr Pointer of the object attached to the function group.
+ * @return result If a running function is found returns '0', otherwise returns '1'.
+ */
+uint8_t fFaraabinFunctionEngine_GetNextRunningFunction(uint8_t *handle, uint32_t *ptr, uint32_t *objectPtr);
+
 /**
  * @brief Gets the pointer of the function fobjects that are running by the engine.
  * 
+ * @note Prefer fFaraabinFunctionEngine_GetNextRunningFunction() for enumerating all running functions.
+ * 
  * @param index Index in function engine list.
  * @param ptr Pointer of the function fobject.
  * @param objectPtr Pointer of the object attached to the function group.
@@ -116,6 +164,33 @@ uint16_t fFaraabinFunctionEngine_GetQtyOfRunningFunctions(void);
  */
 uint8_t fFaraabinFunctionEngine_GetPtrsOfRunningFunction(uint16_t index, uint32_t *ptr, uint32_t *objectPtr);
 
+/**
+ * @brief Gets the scheduling statistics of a function that is started by the engine.
+ * 
+ * @param functionPtr Pointer to the function fobject.
+ * @param objectPtr Pointer to the object attached to the function group.
+ * @param stats Pointer to the statistics object to be filled.
+ * @return result A value form FUNCTION_ENGINE_RESULT group.
+ */
+uint8_t fFaraabinFunctionEngine_GetStats(uint32_t functionPtr, uint32_t objectPtr, sFaraabinFunctionEngine_Stats *stats);
+
+/**
+ * @brief Gets the usage of the function argument pool.
+ * 
+ * @param usedBlocks Number of blocks currently allocated to started functions.
+ * @param highWaterBlocks Maximum number of blocks that were allocated at the same time since initialization.
+ */
+void fFaraabinFunctionEngine_GetArgPoolUsage(uint16_t *usedBlocks, uint16_t *highWaterBlocks);
+
+/**
+ * @brief Gets the resume point of the coroutine that is being executed by the engine.
+ * 
+ * @note It is used by FARAABIN_Function_CoroutineBegin_() and must not be called by the application.
+ * 
+ * @return resumePtr Pointer to the resume point of the current execution.
+ */
+uint16_t* fFaraabinFunctionEngine_GetResumePoint(void);
+
 /**
  * @brief Returns RAM usage of the function feature in Faraabin.
  * 
@@ -42,6 +42,7 @@ extern "C" {
 /* Exported macro ------------------------------------------------------------*/
 #define FARAABIN_CRITICIAL_ENTER_ FB_PORT_DISABLE_IRQ
 #define FARAABIN_CRITICIAL_EXIT_  FB_PORT_ENABLE_IRQ
+#define FARAABIN_MEMORY_BARRIER_  FB_PORT_MEMORY_BARRIER
 
 /* Exported types ------------------------------------------------------------*/
 /* Exported constants --------------------------------------------------------*/
@@ -102,6 +102,9 @@ static void fFunctionFrameHandler(sClientFrame* clientFrame);
 static void fEventGroupEventHandler(sClientFrame* clientFrame);
 
 static void fSendCircularBuffer(bool flush);
+static void fDictSendingEnd(void);
+static uint32_t fDictWatermark(void);
+static void fDictUpdateRun(void);
 
 /* Variables -----------------------------------------------------------------*/
 
@@ -178,37 +181,46 @@ void fFaraabinLinkHandler_Run(void) {
   // Dict handling
   if(LinkHandler.DictSendingMode.SendFlag == true) {
     
-    uint16_t dictQty = fFaraabinDatabase_GetNumberOfAddedDicts();
+    // Dicts added after the request are not part of the whole dictionary. They are sent as updates afterwards.
+    uint16_t dictQty = LinkHandler.DictSendingMode.DictQty;
     
     if(LinkHandler.DictSendingMode.IsBlocking && FaraabinFlags.Features.Bitfield.AllowSendDickBlocking) {
 
+      // Serializer flushes the TX buffer whenever it is half full, so dictionaries are sent in large chunks.
       for(uint16_t i = 0; i < dictQty; i++) {
 
         fFaraabinLinkSerializer_SerializeDict(fFaraabinDatabase_GetFobjectPointerFromDict(i), i, LinkHandler.DictSendingMode.ReqSeq);
-        fSendCircularBuffer(true);
 
       }
-      LinkHandler.DictSendingMode.SendFlag = false;
-      fFaraabinFobjectMcu_SendEventSystemResponse(eMCU_EVENT_INFO_DICT_END, LinkHandler.DictSendingMode.ReqSeq);
-      FaraabinFlags.Status.Bitfield.NewDict = 0U;
+      fSendCircularBuffer(true);
+      fDictSendingEnd();
       
     } else {
       
-      static uint16_t dictIndex = 0;
-
-       fFaraabinLinkSerializer_SerializeDict(fFaraabinDatabase_GetFobjectPointerFromDict(dictIndex), dictIndex, LinkHandler.DictSendingMode.ReqSeq);
-       fSendCircularBuffer(true);
-       dictIndex++;
-
-       if(dictIndex >= dictQty) {
-
-         dictIndex = 0U;
-         LinkHandler.DictSendingMode.SendFlag = false;
-         fFaraabinFobjectMcu_SendEventSystemResponse(eMCU_EVENT_INFO_DICT_END, LinkHandler.DictSendingMode.ReqSeq);
-         FaraabinFlags.Status.Bitfield.NewDict = 0U;
-
-       }
-     }
+      // Dictionaries are streamed into TX buffer up to the watermark and the rest of the buffer is left for live traffic.
+      // Sending is resumed from the same frame in the next call.
+      uint32_t watermark = fDictWatermark();
+      
+      while(LinkHandler.DictSendingMode.DictIndex < dictQty) {
+        
+        uint16_t dictIndex = LinkHandler.DictSendingMode.DictIndex;
+        
+        if(!fFaraabinLinkSerializer_SerializeDictPipelined(fFaraabinDatabase_GetFobjectPointerFromDict(dictIndex), dictIndex, LinkHandler.DictSendingMode.ReqSeq, watermark)) {
+          break;
+        }
+        
+        LinkHandler.DictSendingMode.DictIndex++;
+      }
+      
+      fSendCircularBuffer(false);
+      
+      if(LinkHandler.DictSendingMode.DictIndex >= dictQty) {
+        fDictSendingEnd();
+      }
+    }
+  } else {
+    
+    fDictUpdateRun();
   }
 }
 
@@ -690,6 +702,13 @@ static void fMcuFrameHandler(sClientFrame *clientFrame) {
           
             //Set flag for  send all dict
 						fFaraabinLinkBuffer_Clear();						
+            fFaraabinLinkSerializer_ResetDictStrings();
+            fFaraabinLinkSerializer_CancelDictPipeline();
+            
+            LinkHandler.DictSendingMode.DictQty = fFaraabinDatabase_GetNumberOfAddedDicts();
+            LinkHandler.DictSendingMode.DictIndex = 0U;
+            LinkHandler.DictSendingMode.Generation = fFaraabinDatabase_GetGeneration();
+            LinkHandler.DictSendingMode.IsHostSynced = false;
 						
             LinkHandler.DictSendingMode.SendFlag = true;
             LinkHandler.DictSendingMode.ReqSeq = controlReqSeq;
@@ -706,6 +725,17 @@ static void fMcuFrameHandler(sClientFrame *clientFrame) {
           break;
         }
         
+        case eFB_MCU_PROP_ID_COMMAND_SEND_DICT_HASH: {
+          
+          if(controlReqSeq != 0U) {
+            
+            fFaraabinLinkSerializer_McuSendDictHash((uint32_t)mcuHandle, &mcuHandle->Seq, controlReqSeq);
+            
+          }
+          
+          break;
+        }
+        
         case eFB_MCU_PROP_ID_COMMAND_RESET_CPU: {
 
           fFaraabin_ResetMcu();
@@ -1003,6 +1033,77 @@ static void fDataBusFrameHandler(sClientFrame* clientFrame) {
               break;
         }
         
+        case eFO_DB_PROP_ID_SETTING_CH_AGGREGATE: {
+
+          uByte2 chNo;
+          chNo.Byte[0] = param[0];
+          chNo.Byte[1] = param[1];
+          
+          if(fFaraabinFobjectDataBus_SetChannelAggregate(dbHandle, chNo.U16, (eFaraabinFobjectDataBus_ChAggregate)param[2]) != FARAABIN_DB_OK) {
+            
+            Faraabin_EventSystemException_EndResponse_((uint32_t)dbHandle, &dbHandle->Seq, dbHandle->Enable, eDATABUS_EVENT_ERROR_PARAM, controlReqSeq);
+            return;
+          }
+          
+          if(controlReqSeq != 0U) {
+          
+            fFaraabinLinkSerializer_DataBusSendSetting(clientFrame->FobjectPtr, &dbHandle->Seq, controlReqSeq);
+          }
+          
+          break;
+        }
+        
+        case eFO_DB_PROP_ID_SETTING_CH_REPORT: {
+
+          uByte2 chNo;
+          chNo.Byte[0] = param[0];
+          chNo.Byte[1] = param[1];
+          
+          uByte8 deadband;
+          for(int i=0; i<8; i++) {
+            deadband.Byte[i] = param[3 + i];
+          }
+          
+          if(fFaraabinFobjectDataBus_SetChannelReport(dbHandle, chNo.U16, (eFaraabinFobjectDataBus_ChReport)param[2], deadband.F64) != FARAABIN_DB_OK) {
+            
+            Faraabin_EventSystemException_EndResponse_((uint32_t)dbHandle, &dbHandle->Seq, dbHandle->Enable, eDATABUS_EVENT_ERROR_PARAM, controlReqSeq);
+            return;
+          }
+          
+          if(controlReqSeq != 0U) {
+          
+            fFaraabinLinkSerializer_DataBusSendSetting(clientFrame->FobjectPtr, &dbHandle->Seq, controlReqSeq);
+          }
+          
+          break;
+        }
+        
+        case eFO_DB_PROP_ID_SETTING_KEEPALIVE_DIVIDEBY: {
+
+          uByte2 divideBy;
+          divideBy.Byte[0] = param[0];
+          divideBy.Byte[1] = param[1];
+          
+          dbHandle->KeepaliveDivideBy = divideBy.U16;
+          
+          if(controlReqSeq != 0U) {
+          
+            fFaraabinLinkSerializer_DataBusSendSetting(clientFrame->FobjectPtr, &dbHandle->Seq, controlReqSeq);
+          }
+          
+          break;
+        }
+        
+        case eFO_DB_PROP_ID_SETTING_CH_SLICE: {
+          
+          if(controlReqSeq != 0U) {
+          
+            fFaraabinLinkSerializer_DataBusSendSliceSetting(clientFrame->FobjectPtr, &dbHandle->Seq, controlReqSeq);
+          }
+          
+          break;
+        }
+        
         default: {
           
           errorFobjectProperty = true;
@@ -1254,6 +1355,7 @@ static void fDataBusFrameHandler(sClientFrame* clientFrame) {
           dbHandle->CaptureSendingReqSeq = controlReqSeq;
           
           dbHandle->CaptureSendingQty = dbHandle->QueueItemCount;
+          fFaraabinFobjectDataBus_CaptureCursorBegin(dbHandle, &dbHandle->_captureSendCursor);
           
           if(dbHandle->CaptureSendingQty == 0U) {
             
@@ -1317,6 +1419,49 @@ static void fDataBusFrameHandler(sClientFrame* clientFrame) {
           break;
         }
         
+        case eFB_DB_PROP_ID_COMMAND_ATTACH_SLICE: {
+          
+          uByte4 sliceBase;
+          sliceBase.Byte[0] = param[0];
+          sliceBase.Byte[1] = param[1];
+          sliceBase.Byte[2] = param[2];
+          sliceBase.Byte[3] = param[3];
+  
+          uByte2 elemSize;
+          elemSize.Byte[0] = param[4];
+          elemSize.Byte[1] = param[5];
+          
+          uByte2 stride;
+          stride.Byte[0] = param[6];
+          stride.Byte[1] = param[7];
+          
+          uByte2 qty;
+          qty.Byte[0] = param[8];
+          qty.Byte[1] = param[9];
+  
+          uint8_t varTypeArchitecture = param[10];
+          uint8_t varPrimitiveId = param[11];
+  
+          uByte2 itemChannelNo;
+          itemChannelNo.Byte[0] = param[12];
+          itemChannelNo.Byte[1] = param[13];
+          
+          uint8_t ret = fFaraabinFobjectDataBus_AttachVariableSliceToChannel(dbHandle, itemChannelNo.U16, sliceBase.U32, elemSize.U16, stride.U16, qty.U16, varTypeArchitecture, varPrimitiveId);
+
+          if(ret != FARAABIN_DB_OK) {
+
+            Faraabin_EventSystemException_EndResponse_((uint32_t)dbHandle, &dbHandle->Seq, dbHandle->Enable, eDATABUS_EVENT_ERROR_ATTACH, controlReqSeq);
+          } else {
+            
+            if(controlReqSeq != 0U) {
+          
+              fFaraabinLinkSerializer_DataBusSendSetting(clientFrame->FobjectPtr, &dbHandle->Seq, controlReqSeq);
+            }
+          }
+
+          break;
+        }
+        
         default: {
           
           errorFobjectProperty = true;
@@ -2040,7 +2185,8 @@ static void fFunctionFrameHandler(sClientFrame* clientFrame) {
           paramSize.Byte[0] = param[4];
           paramSize.Byte[1] = param[5];
 
-          uint8_t ret = fFaraabinFunctionEngine_Start((uint32_t)fnHandle, objectPtr.U32, &(param[6]), paramSize.U16);
+          uint8_t engineHandle = FB_FENGINE_INVALID_HANDLE;
+          uint8_t ret = fFaraabinFunctionEngine_Start((uint32_t)fnHandle, objectPtr.U32, &(param[6]), paramSize.U16, &engineHandle);
 
           if(ret == FB_FENGINE_FUNCTION_ALREADY_RUNNING) {
 
@@ -2056,7 +2202,21 @@ static void fFunctionFrameHandler(sClientFrame* clientFrame) {
             break;
           }
 
-          Faraabin_EventSystemExtended_EndResponse_((uint32_t)fnHandle, objectPtr.U32, &fnHandle->Seq, true, eFN_EVENT_INFO_RUN, controlReqSeq);
+          if(ret == FB_FENGINE_ARG_TOO_LARGE) {
+
+            Faraabin_EventSystemExceptionExtended_EndResponse_((uint32_t)fnHandle, objectPtr.U32, &fnHandle->Seq, true, eFN_EVENT_ERROR_ARG_TOO_LARGE, controlReqSeq);
+            
+            break;
+          }
+
+          if(ret == FB_FENGINE_ARG_POOL_EXHAUSTED) {
+
+            Faraabin_EventSystemExceptionExtended_EndResponse_((uint32_t)fnHandle, objectPtr.U32, &fnHandle->Seq, true, eFN_EVENT_ERROR_ARG_POOL_EXHAUSTED, controlReqSeq);
+            
+            break;
+          }
+
+          Faraabin_EventSystemExtended_ParamEndResponse_((uint32_t)fnHandle, objectPtr.U32, &fnHandle->Seq, true, eFN_EVENT_INFO_RUN, &engineHandle, 1, controlReqSeq);
           
           break;
         }
@@ -2069,7 +2229,9 @@ static void fFunctionFrameHandler(sClientFrame* clientFrame) {
           objectPtr.Byte[2] = param[2];
           objectPtr.Byte[3] = param[3];
           
-          uint8_t ret = fFaraabinFunctionEngine_Stop(clientFrame->FobjectPtr, objectPtr.U32);
+          uint8_t engineHandle = (clientFrame->PayloadSize > 4U) ? param[4] : FB_FENGINE_INVALID_HANDLE;
+          
+          uint8_t ret = fFaraabinFunctionEngine_Stop(clientFrame->FobjectPtr, objectPtr.U32, engineHandle);
 
           if(ret == FB_FENGINE_FUNCTION_NOT_IN_LIST) {
 
@@ -2091,7 +2253,9 @@ static void fFunctionFrameHandler(sClientFrame* clientFrame) {
           objectPtr.Byte[2] = param[2];
           objectPtr.Byte[3] = param[3];
           
-          uint8_t ret = fFaraabinFunctionEngine_Pause(clientFrame->FobjectPtr, objectPtr.U32);
+          uint8_t engineHandle = (clientFrame->PayloadSize > 4U) ? param[4] : FB_FENGINE_INVALID_HANDLE;
+          
+          uint8_t ret = fFaraabinFunctionEngine_Pause(clientFrame->FobjectPtr, objectPtr.U32, engineHandle);
           
           if(ret == FB_FENGINE_FUNCTION_NOT_IN_LIST) {
             
@@ -2113,7 +2277,9 @@ static void fFunctionFrameHandler(sClientFrame* clientFrame) {
           objectPtr.Byte[2] = param[2];
           objectPtr.Byte[3] = param[3];
           
-          uint8_t ret = fFaraabinFunctionEngine_Resume(clientFrame->FobjectPtr, objectPtr.U32);
+          uint8_t engineHandle = (clientFrame->PayloadSize > 4U) ? param[4] : FB_FENGINE_INVALID_HANDLE;
+          
+          uint8_t ret = fFaraabinFunctionEngine_Resume(clientFrame->FobjectPtr, objectPtr.U32, engineHandle);
           
           if(ret == FB_FENGINE_FUNCTION_NOT_IN_LIST) {
             
@@ -2325,4 +2491,107 @@ static void fSendCircularBuffer(bool flush) {
   }
 }
 
+/**
+ * @brief Returns the number of bytes in TX buffer that dictionary frames must not exceed.
+ * 
+ * @return watermark Watermark in bytes.
+ */
+static uint32_t fDictWatermark(void) {
+  
+  return (FbCircularBuffer.Size * FB_DICT_TX_WATERMARK_PERCENT) / 100U;
+}
+
+/**
+ * @brief Finishes sending the whole dictionary.
+ * 
+ * @note From now on, host has the dictionary up to the generation of the request and dicts added after that are
+ *       sent as incremental updates.
+ * 
+ */
+static void fDictSendingEnd(void) {
+  
+  LinkHandler.DictSendingMode.SendFlag = false;
+  fFaraabinFobjectMcu_SendEventSystemResponse(eMCU_EVENT_INFO_DICT_END, LinkHandler.DictSendingMode.ReqSeq);
+  
+  LinkHandler.DictSendingMode.IsHostSynced = true;
+  LinkHandler.DictSendingMode.SyncedDictQty = LinkHandler.DictSendingMode.DictQty;
+  LinkHandler.DictSendingMode.SyncedGeneration = LinkHandler.DictSendingMode.Generation;
+  
+  if(LinkHandler.DictSendingMode.SyncedGeneration == fFaraabinDatabase_GetGeneration()) {
+    FaraabinFlags.Status.Bitfield.NewDict = 0U;
+  }
+}
+
+/**
+ * @brief Sends dicts that are added after the last transfer to the host as incremental updates.
+ * 
+ * @note Dicts are streamed the same as non-blocking sending of the whole dictionary. Dict frames keep their
+ *       index in database, so host merges them into its copy. At the end, eMCU_EVENT_INFO_DICT_UPDATE_END is sent
+ *       with the generation range and number of dicts. If the first generation does not match the generation of
+ *       the host copy, host must request the whole dictionary again.
+ * 
+ */
+static void fDictUpdateRun(void) {
+  
+  if(!LinkHandler.DictSendingMode.IsHostSynced) {
+    return;
+  }
+  
+  // Updates are only meaningful for the host that received the whole dictionary.
+  if(!fFaraabinFobjectMcu_GetFobject()->_isHostConnected) {
+    LinkHandler.DictSendingMode.IsHostSynced = false;
+    return;
+  }
+  
+  uint16_t dictQty = fFaraabinDatabase_GetNumberOfAddedDicts();
+  uint16_t dictIndex = LinkHandler.DictSendingMode.SyncedDictQty;
+  
+  if(dictIndex >= dictQty) {
+    return;
+  }
+  
+  uint32_t watermark = fDictWatermark();
+  
+  while(dictIndex < dictQty) {
+    
+    if(!fFaraabinLinkSerializer_SerializeDictPipelined(fFaraabinDatabase_GetFobjectPointerFromDict(dictIndex), dictIndex, 0U, watermark)) {
+      break;
+    }
+    
+    dictIndex++;
+  }
+  
+  LinkHandler.DictSendingMode.SyncedDictQty = dictIndex;
+  fSendCircularBuffer(false);
+  
+  if(dictIndex < dictQty) {
+    return;
+  }
+  
+  uint32_t generation = fFaraabinDatabase_GetGeneration();
+  
+  uint8_t param[10];
+  uByte4 tmp4;
+  tmp4.U32 = LinkHandler.DictSendingMode.SyncedGeneration;
+  param[0] = tmp4.Byte[0];
+  param[1] = tmp4.Byte[1];
+  param[2] = tmp4.Byte[2];
+  param[3] = tmp4.Byte[3];
+  tmp4.U32 = generation;
+  param[4] = tmp4.Byte[0];
+  param[5] = tmp4.Byte[1];
+  param[6] = tmp4.Byte[2];
+  param[7] = tmp4.Byte[3];
+  uByte2 tmp2;
+  tmp2.U16 = dictQty;
+  param[8] = tmp2.Byte[0];
+  param[9] = tmp2.Byte[1];
+  
+  sFaraabinFobjectMcu *mcuHandle = fFaraabinFobjectMcu_GetFobject();
+  Faraabin_EventSystem_ParamEnd_((uint32_t)0xFFFFFFFFU, &mcuHandle->Seq, true, eMCU_EVENT_INFO_DICT_UPDATE_END, param, sizeof(param));
+  
+  LinkHandler.DictSendingMode.SyncedGeneration = generation;
+  FaraabinFlags.Status.Bitfield.NewDict = 0U;
+}
+
 /************************ © COPYRIGHT FaraabinCo *****END OF FILE****/
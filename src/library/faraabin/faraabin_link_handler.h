@@ -61,6 +61,18 @@ typedef struct {
   
   bool IsBlocking;  /*!< Flag for indicating that sending is blocking. */
   
+  uint16_t DictQty;         /*!< Number of dicts in the whole dictionary that is being sent. Later dicts are sent as updates. */
+  
+  uint16_t DictIndex;       /*!< Index of the dict that is being sent in non-blocking mode. */
+  
+  uint32_t Generation;      /*!< Generation of the database when sending the whole dictionary is requested. */
+  
+  bool IsHostSynced;        /*!< Flag for indicating that host has received the whole dictionary and accepts updates. */
+  
+  uint16_t SyncedDictQty;   /*!< Number of dicts that host has received. */
+  
+  uint32_t SyncedGeneration;  /*!< Generation of the database that host has received. */
+  
 }sDictSendingMode;
 
 typedef struct {
@@ -37,6 +37,7 @@
 #endif
 
 #include <stdarg.h>
+#include <math.h>
 
 /* Private define ------------------------------------------------------------*/
 /**
@@ -57,12 +58,61 @@
  */
 #define FB_ESC_XOR  0x20U
 
+/**
+ * @brief Maximum size of the frame header (control, timestamp, fobject pointer, extended pointer and property) in bytes before escaping.
+ * 
+ */
+#define FB_FRAME_HEADER_SIZE_MAX  15U
+
 /**
  * @brief Serializer ID for common property.
  * 
  */
 #define FB_COMMON_PROP_ID_DICT  0U
 
+/**
+ * @brief Version of the dictionary payload format. It is folded into the dictionary hash so that hosts
+ *        invalidate their cached dictionary when the format changes.
+ * 
+ */
+#ifdef FB_FEATURE_FLAG_DICT_STRING_TABLE
+#define FB_DICT_FORMAT_VERSION  2U
+#else
+#define FB_DICT_FORMAT_VERSION  1U
+#endif
+
+/**
+ * @brief FNV-1a 32-bit offset basis and prime used for the dictionary content hash.
+ * 
+ */
+#define FB_DICT_HASH_OFFSET     2166136261U
+#define FB_DICT_HASH_PRIME      16777619U
+
+#ifdef FB_FEATURE_FLAG_DICT_STRING_TABLE
+/**
+ * @brief Marker bytes of dictionary strings when string table is enabled.
+ * 
+ * @note A dictionary string is [DEF id] [REF id] text. REF means the string starts with the interned string of the id
+ *       and the rest of it is plain text. DEF registers the whole resolved string with the id and replaces the previous
+ *       string of that id. REF is resolved before DEF is applied.
+ *       Ids are sent as (FB_DICT_STRING_ID_BASE + index), so they never collide with '\0', ':' or '\\'.
+ * 
+ */
+#define FB_DICT_STRING_REF      0x01U
+#define FB_DICT_STRING_DEF      0x02U
+#define FB_DICT_STRING_ID_BASE  0x80U
+
+/**
+ * @brief Separator of the path levels. Prefixes are only reused when they end at a separator.
+ * 
+ */
+#define FB_DICT_PATH_SEPARATOR  '\\'
+
+#if (FB_DICT_STRING_TABLE_QTY > 127U)
+#error "FB_DICT_STRING_TABLE_QTY must not be more than 127."
+#endif
+#endif
+
 /* Private macro -------------------------------------------------------------*/
 /**
  * @brief In case of null or empty, this macro corrects given path to a fobject.
@@ -91,6 +141,16 @@
     fAddToBufferU8(control);\
   }while(0)
 
+/**
+ * @brief These macros tag the setting and status parts of a dictionary payload.
+ * 
+ * @note Bytes between them are sent as usual but are not folded into the dictionary hash, because they
+ *       change at run time while the dictionary itself does not.
+ * 
+ */
+#define DICT_RUNTIME_BEGIN_()  (_serializer.DictIterator._isHashExcluded = true)
+#define DICT_RUNTIME_END_()    (_serializer.DictIterator._isHashExcluded = false)
+
 /* Private typedef -----------------------------------------------------------*/
 /**
  * @brief Frame type identifier of link serializer.
@@ -165,8 +225,46 @@ typedef struct {
 
   bool _isInCountingMode;       /*!< Flag for checking that dictionary is in counting mode. */
 
+  bool _isInHashingMode;        /*!< Flag for checking that dictionary payloads are folded into the hash instead of being sent. */
+
+  bool _isHashSinkActive;       /*!< Redirects bytes to the hash. It is only set inside a critical section. */
+
+  bool _isHashExcluded;         /*!< Flag for skipping the run time state of fobjects while hashing. */
+
+  bool _isSizeSinkActive;       /*!< Redirects bytes to the size counter. It is only set inside a critical section. */
+
+  uint32_t _sinkSize;           /*!< Number of payload bytes counted by the size sink. */
+
+  uint32_t _hash;               /*!< Running hash of the dictionary payloads in hashing mode. */
+
+  bool _isInPipelineMode;       /*!< Flag for checking that frames are only serialized from _resumeSubDictIndex until TX buffer reaches the watermark. */
+
+  bool _isPaused;               /*!< Flag for indicating that TX buffer reached the watermark and the rest of the frames are skipped. */
+
+  uint16_t _resumeSubDictIndex; /*!< Index of the first sub-dictionary that is not sent yet in pipeline mode. */
+
+  uint32_t _watermark;          /*!< Number of bytes in TX buffer that dictionary frames must not cross in pipeline mode. */
+
 }sDictIterator;
 
+/**
+ * @brief State of the pipelined dictionary that is kept between calls.
+ * 
+ * @note It is kept apart from DictIterator, because other dictionary operations may run between two calls.
+ * 
+ */
+typedef struct {
+
+  bool IsResuming;              /*!< Flag for indicating that a dictionary is partially sent. */
+
+  uint16_t DictIndex;           /*!< Index of the partially sent dictionary. */
+
+  uint16_t TotalSubDicts;       /*!< Number of sub-dictionaries of the partially sent dictionary. */
+
+  uint16_t ResumeSubDictIndex;  /*!< Index of the first sub-dictionary that is not sent yet. */
+
+}sDictPipeline;
+
 /**
  * @brief User data parameters for common user data communications.
  * 
@@ -267,14 +365,44 @@ typedef struct {
   
 }sDictFunctionGroupPayloadParam;
 
+#ifdef FB_FEATURE_FLAG_DICT_STRING_TABLE
+/**
+ * @brief Table of strings that are already sent in dictionary frames.
+ * 
+ * @note Only pointers are kept. Strings in dictionaries are constant for the life time of fobjects.
+ * 
+ */
+typedef struct {
+  
+  const char *Str[FB_DICT_STRING_TABLE_QTY];  /*!< Pointers to the interned strings. */
+  
+  uint16_t Len[FB_DICT_STRING_TABLE_QTY];     /*!< Length of the interned strings. */
+  
+  uint8_t Qty;                                /*!< Number of interned strings. */
+  
+  uint8_t Victim;                             /*!< Next entry to be reused when table is full. */
+  
+  uint32_t RawBytes;                          /*!< Number of string bytes that would be sent without string table. */
+  
+  uint32_t SentBytes;                         /*!< Number of string bytes that are sent with string table. */
+  
+}sDictStringTable;
+#endif
+
 typedef struct {
 	
 	sDictIterator DictIterator;     /*!< Handles iterating over all added dictionaries. */
 
+	sDictPipeline DictPipeline;     /*!< Keeps the position of pipelined dictionary sending between calls. */
+
 	sLinkSerializer Serializer;     /*!< Manages the serialization of the frames that will be added to main queue of faraabin. */
 
 	sFaraabinFobjectMcu* McuHandle; /*!< Pointer to the MCU fobject. */
 	
+#ifdef FB_FEATURE_FLAG_DICT_STRING_TABLE
+  sDictStringTable DictStrings;   /*!< Strings that are interned in current dictionary transfer. */
+#endif
+	
 }sSerializerInternal;
 
 /* Private variables ---------------------------------------------------------*/
@@ -298,10 +426,11 @@ static void fAddToBufferU32(uint32_t d);
 static void fAddToBufferU64(uint64_t d);
 #ifdef __FARAABIN_LINK_SERIALIZER_COMMENT_SECTION_0
 static void fAddToBufferF32(float32_t d); // TODO: This function is reserved here for future use.
-static void fAddToBufferF64(float64_t d); // TODO: This function is reserved here for future use.
 #endif
+static void fAddToBufferF64(float64_t d);
 static void fAddToBufferString(char *string);
 static void fAddToBuffer(uint8_t *data, uint32_t size);
+static void fAddToBufferDictString(const char *str);
 
 static void fCommonEnableStatusGeneratePayload(uint32_t fobjectPtr, void *param);
 static void fCommonUserDataGeneratePayload(uint32_t fobjectPtr, void *param);
@@ -314,8 +443,11 @@ static void fMcuProfilerGeneratePayload(uint32_t fobjectPtr, void *param);
 #endif
 
 static void fDataBusSettingGeneratePayload(uint32_t fobjectPtr, void *param);
+static void fDataBusSliceSettingGeneratePayload(uint32_t fobjectPtr, void *param);
 static void fDataBusCaptureValueGeneratePayload(uint32_t fobjectPtr, void *param);
 static void fDataBusValueGeneratePayload(uint32_t fobjectPtr, void *param);
+static void fDataBusAggregateValueGeneratePayload(uint32_t fobjectPtr, void *param);
+static void fDataBusBlockValueGeneratePayload(uint32_t fobjectPtr, void *param);
 
 static void fMcuPingGeneratePayload(uint32_t fobjectPtr, void *param);
 static void fMcuLiveGeneratePayload(uint32_t fobjectPtr, void *param);
@@ -353,6 +485,7 @@ static void fDictIteratorResetCounter(uint16_t dictIndex);
 static void fDictIteratorEnableCounting(void);
 static void fDictIteratorDisableCounting(void);
 static bool fDictIteratorIsInCountingMode(void);
+static void fMcuDictHashGeneratePayload(uint32_t fobjectPtr, void *param);
 static void fSerializeDict(
   uint32_t fobjectPtr,
   uint8_t *fobjectSeqPtr,
@@ -361,6 +494,8 @@ static void fSerializeDict(
   void *pDictPayloadParam);
 static void fGenerateDict(uint32_t fobjectPtr, uint8_t reqSeq);
 static uint32_t fCountAllDictsFrames(void);
+static uint32_t fDictPayloadSizeMax(uint32_t fobjectPtr, sGeneratePayloadDict_Param *param);
+static void fGenerateSectionVarDicts(const sFaraabinFobjectContainer *me, uint8_t reqSeq);
 
 /* Variables -----------------------------------------------------------------*/
 extern sFaraabinFobjectMcu faraabin_mcu__;
@@ -398,6 +533,23 @@ uint8_t fFaraabinLinkSerializer_Init(uint8_t *txBuffer, uint32_t txBufferSize) {
   _serializer.DictIterator.TotalSubDicts = 0U;
   _serializer.DictIterator.CurrentDictIndex = 0U;
   _serializer.DictIterator._isInCountingMode = false;
+  _serializer.DictIterator._isInHashingMode = false;
+  _serializer.DictIterator._isHashSinkActive = false;
+  _serializer.DictIterator._isHashExcluded = false;
+  _serializer.DictIterator._isSizeSinkActive = false;
+  _serializer.DictIterator._sinkSize = 0U;
+  _serializer.DictIterator._hash = FB_DICT_HASH_OFFSET;
+  _serializer.DictIterator._isInPipelineMode = false;
+  _serializer.DictIterator._isPaused = false;
+  _serializer.DictIterator._resumeSubDictIndex = 0U;
+  _serializer.DictIterator._watermark = 0U;
+  
+  _serializer.DictPipeline.IsResuming = false;
+  _serializer.DictPipeline.DictIndex = 0U;
+  _serializer.DictPipeline.TotalSubDicts = 0U;
+  _serializer.DictPipeline.ResumeSubDictIndex = 0U;
+  
+  fFaraabinLinkSerializer_ResetDictStrings();
   
   _serializer.McuHandle = fFaraabinFobjectMcu_GetFobject();
 
@@ -637,6 +789,167 @@ void fFaraabinLinkSerializer_SerializeDict(
   fGenerateDict(fobjectPtr, reqSeq);
 }
 
+/**
+ * @brief Serializes dictionary of a fobject into TX buffer until the buffer reaches the watermark.
+ * 
+ * @note It never waits for the link. If the buffer reaches the watermark in the middle of the dictionary,
+ *       serializing stops and the next call with the same dictIndex resumes from the first frame that is not sent.
+ *       Frames before that are regenerated but skipped, so no frame is sent twice and sub-dictionary indexes are kept.
+ * 
+ * @param fobjectPtr Pointer to the fobject.
+ * @param dictIndex Index of the fobject in database.
+ * @param reqSeq Request sequence counter.
+ * @param watermark Number of bytes in TX buffer that dictionary frames must not exceed.
+ * @return isDone Returns true if the whole dictionary of the fobject is serialized, false if it must be called again.
+ */
+bool fFaraabinLinkSerializer_SerializeDictPipelined(
+  uint32_t fobjectPtr,
+  uint16_t dictIndex,
+  uint8_t reqSeq,
+  uint32_t watermark) {
+  
+  sDictPipeline *pipe = &_serializer.DictPipeline;
+  
+  fDictIteratorResetCounter(dictIndex);
+  
+  if(pipe->IsResuming && (pipe->DictIndex == dictIndex)) {
+    _serializer.DictIterator.TotalSubDicts = pipe->TotalSubDicts;
+  } else {
+    fDictIteratorEnableCounting();
+    fGenerateDict(fobjectPtr, reqSeq);
+    fDictIteratorDisableCounting();
+    
+    pipe->DictIndex = dictIndex;
+    pipe->TotalSubDicts = _serializer.DictIterator.TotalSubDicts;
+    pipe->ResumeSubDictIndex = 0U;
+  }
+  
+  _serializer.DictIterator._isInPipelineMode = true;
+  _serializer.DictIterator._isPaused = false;
+  _serializer.DictIterator._resumeSubDictIndex = pipe->ResumeSubDictIndex;
+  _serializer.DictIterator._watermark = watermark;
+  
+  fGenerateDict(fobjectPtr, reqSeq);
+  
+  _serializer.DictIterator._isInPipelineMode = false;
+  
+  pipe->IsResuming = _serializer.DictIterator._isPaused;
+  pipe->ResumeSubDictIndex = _serializer.DictIterator._resumeSubDictIndex;
+  
+  return !pipe->IsResuming;
+}
+
+/**
+ * @brief Drops the position of the partially sent dictionary, so the next pipelined call starts from the first frame.
+ * 
+ */
+void fFaraabinLinkSerializer_CancelDictPipeline(void) {
+  
+  _serializer.DictPipeline.IsResuming = false;
+  _serializer.DictPipeline.ResumeSubDictIndex = 0U;
+}
+
+/**
+ * @brief Calculates the content hash of all dictionaries in database.
+ * 
+ * @note Dictionaries are generated exactly as they are sent, but payload bytes are folded into an FNV-1a hash
+ *       instead of being put in the TX buffer. Frame headers (sequence counters and time stamps) are not included.
+ *       Setting and status parts of the payloads (enable flags, running functions, databus attachments, etc.) and
+ *       RAM usages are not included either, so the hash only depends on names, types, paths and layout of fobjects.
+ *       The host can compare this hash with the one of its cached dictionary and skip the transfer if they match.
+ * 
+ * @return hash Content hash of the dictionary.
+ */
+uint32_t fFaraabinLinkSerializer_GetDictHash(void) {
+  
+  uint16_t dicts = fFaraabinDatabase_GetNumberOfAddedDicts();
+  
+  _serializer.DictIterator._hash = FB_DICT_HASH_OFFSET;
+  _serializer.DictIterator._hash = (_serializer.DictIterator._hash ^ FB_DICT_FORMAT_VERSION) * FB_DICT_HASH_PRIME;
+  
+  // Hash is calculated as if the whole dictionary is sent from scratch.
+  fFaraabinLinkSerializer_ResetDictStrings();
+  
+  for(uint16_t i = 0; i < dicts; i++) {
+    
+    uint32_t fobjectPtr = fFaraabinDatabase_GetFobjectPointerFromDict(i);
+    
+    fDictIteratorResetCounter(i);
+    fDictIteratorEnableCounting();
+    fGenerateDict(fobjectPtr, 0);
+    fDictIteratorDisableCounting();
+    
+    _serializer.DictIterator._isInHashingMode = true;
+    fGenerateDict(fobjectPtr, 0);
+    _serializer.DictIterator._isInHashingMode = false;
+  }
+  
+  // Strings interned while hashing are not sent to the host.
+  fFaraabinLinkSerializer_ResetDictStrings();
+  
+  return _serializer.DictIterator._hash;
+}
+
+/**
+ * @brief Resets the string table of dictionary frames.
+ * 
+ * @note It must be called before sending the whole dictionary, so that host and MCU start with the same empty table.
+ *       It does nothing when FB_FEATURE_FLAG_DICT_STRING_TABLE is not enabled.
+ * 
+ */
+void fFaraabinLinkSerializer_ResetDictStrings(void) {
+  
+#ifdef FB_FEATURE_FLAG_DICT_STRING_TABLE
+  _serializer.DictStrings.Qty = 0U;
+  _serializer.DictStrings.Victim = 0U;
+  _serializer.DictStrings.RawBytes = 0U;
+  _serializer.DictStrings.SentBytes = 0U;
+#endif
+}
+
+/**
+ * @brief Returns the size of path and filename strings in dictionary frames since the last reset of string table.
+ * 
+ * @note It is used for measuring the effect of string table on the dictionary size. Both values are zero
+ *       when FB_FEATURE_FLAG_DICT_STRING_TABLE is not enabled.
+ * 
+ * @param rawBytes Pointer to the number of string bytes without string table.
+ * @param sentBytes Pointer to the number of string bytes that are actually sent.
+ */
+void fFaraabinLinkSerializer_GetDictStringStats(uint32_t *rawBytes, uint32_t *sentBytes) {
+  
+#ifdef FB_FEATURE_FLAG_DICT_STRING_TABLE
+  *rawBytes = _serializer.DictStrings.RawBytes;
+  *sentBytes = _serializer.DictStrings.SentBytes;
+#else
+  *rawBytes = 0U;
+  *sentBytes = 0U;
+#endif
+}
+
+/**
+ * @brief This is a helper function from fSerializeFrame() to send content hash of the dictionary via faraabin link.
+ * 
+ * @param fobjectPtr Pointer to the MCU fobject.
+ * @param fobjectSeq Fobject sequence counter.
+ * @param reqSeq Request sequence counter.
+ */
+void fFaraabinLinkSerializer_McuSendDictHash(uint32_t fobjectPtr, uint8_t *fobjectSeq, uint8_t reqSeq) {
+  
+  uint32_t hash = fFaraabinLinkSerializer_GetDictHash();
+  
+  fSerializeFrame(
+    eFB_LINK_FRAME_TYPE_RESPONSE,
+    (fobjectSeq),
+    (reqSeq),
+    (true),
+    (fobjectPtr),
+    0,
+    (uint8_t)eFB_PROP_GROUP_MONITORING,
+    (uint8_t)eFB_MCU_PROP_ID_MONITORING_DICT_HASH,
+    fMcuDictHashGeneratePayload, &hash);
+}
+
 /**
  * @brief Flushes main queue of faraabin.
  * 
@@ -652,6 +965,38 @@ uint16_t fFaraabinLinkSerializer_FlushBuffer(uint8_t **ptrToBuffer) {
   return allowableSize;
 }
 
+/**
+ * @brief Returns the free space of faraabin TX buffer.
+ * 
+ * @return size Number of bytes that can be added to TX buffer without overwriting pending data.
+ */
+uint32_t fFaraabinLinkSerializer_GetTxFreeSpace(void) {
+  
+  return FbCircularBuffer.Size - FbCircularBuffer._count;
+}
+
+/**
+ * @brief Returns the size of faraabin TX buffer.
+ * 
+ * @return size Size of TX buffer in bytes.
+ */
+uint32_t fFaraabinLinkSerializer_GetTxSize(void) {
+  
+  return FbCircularBuffer.Size;
+}
+
+/**
+ * @brief Returns the worst case size of a frame in TX buffer, i.e. when all of its bytes need escaping.
+ * 
+ * @param payloadSize Size of the payload of the frame in bytes.
+ * @return size Maximum size of the frame in bytes.
+ */
+uint32_t fFaraabinLinkSerializer_GetFrameSizeMax(uint32_t payloadSize) {
+  
+  // Header, payload and checksum may be escaped. End of frame is never escaped.
+  return (2U * (FB_FRAME_HEADER_SIZE_MAX + payloadSize + 1U)) + 1U;
+}
+
 /*
 ===============================================================================
               ##### fb_link_serializer.c Helper Functions #####
@@ -849,6 +1194,29 @@ void fFaraabinLinkSerializer_DataBusSendSetting(uint32_t fobjectPtr, uint8_t *fo
     fDataBusSettingGeneratePayload, NULL);
 }
 
+/**
+ * @brief This is a helper function from fSerializeFrame() to send stride and quantity of databus slice channels via faraabin link.
+ * 
+ * @note Slice parameters have their own frame, so the layout of the setting frame is not changed for hosts that don't support slices.
+ * 
+ * @param fobjectPtr Pointer to the databus fobject.
+ * @param fobjectSeq Sequence counter of the fobject.
+ * @param reqSeq Request sequence counter of the frame.
+ */
+void fFaraabinLinkSerializer_DataBusSendSliceSetting(uint32_t fobjectPtr, uint8_t *fobjectSeq, uint8_t reqSeq) {
+
+  fSerializeFrame(
+    eFB_LINK_FRAME_TYPE_RESPONSE,
+    (fobjectSeq),
+    (reqSeq),
+    (true),
+    (fobjectPtr),
+    0,
+    (uint8_t)eFB_PROP_GROUP_SETTING,
+    (uint8_t)eFO_DB_PROP_ID_SETTING_CH_SLICE,
+    fDataBusSliceSettingGeneratePayload, NULL);
+}
+
 /**
  * @brief This is a helper function from fSerializeFrame() to send databus captured values via faraabin link.
  * 
@@ -894,6 +1262,50 @@ void fFaraabinLinkSerializer_DataBusSendValue(uint32_t fobjectPtr, uint8_t *fobj
     fDataBusValueGeneratePayload, NULL);
 }
 
+/**
+ * @brief This is a helper function from fSerializeFrame() to send aggregated (min/max/mean) stream values of databus channels via faraabin link.
+ * 
+ * @param fobjectPtr Pointer to the databus fobject.
+ * @param fobjectSeq Sequence counter of the fobject.
+ * @param reqSeq Request sequence counter of the frame.
+ * @param isResponse Flag for indicating that this frame is a response.
+ */
+void fFaraabinLinkSerializer_DataBusSendAggregateValue(uint32_t fobjectPtr, uint8_t *fobjectSeq, uint8_t reqSeq, bool isResponse) {
+
+  fSerializeFrame(
+    (isResponse) ? eFB_LINK_FRAME_TYPE_RESPONSE : eFB_LINK_FRAME_TYPE_EVENT,
+    (fobjectSeq),
+    (reqSeq),
+    (true),
+    (fobjectPtr),
+    0,
+    (uint8_t)eFB_PROP_GROUP_MONITORING,
+    (uint8_t)eFB_DB_PROP_ID_MONITORING_STREAM_AGGREGATE_VALUE,
+    fDataBusAggregateValueGeneratePayload, NULL);
+}
+
+/**
+ * @brief This is a helper function from fSerializeFrame() to send sample blocks of block mode databus channels via faraabin link.
+ * 
+ * @param fobjectPtr Pointer to the databus fobject.
+ * @param fobjectSeq Sequence counter of the fobject.
+ * @param reqSeq Request sequence counter of the frame.
+ * @param isResponse Flag for indicating that this frame is a response.
+ */
+void fFaraabinLinkSerializer_DataBusSendBlockValue(uint32_t fobjectPtr, uint8_t *fobjectSeq, uint8_t reqSeq, bool isResponse) {
+
+  fSerializeFrame(
+    (isResponse) ? eFB_LINK_FRAME_TYPE_RESPONSE : eFB_LINK_FRAME_TYPE_EVENT,
+    (fobjectSeq),
+    (reqSeq),
+    (true),
+    (fobjectPtr),
+    0,
+    (uint8_t)eFB_PROP_GROUP_MONITORING,
+    (uint8_t)eFB_DB_PROP_ID_MONITORING_STREAM_BLOCK_VALUE,
+    fDataBusBlockValueGeneratePayload, NULL);
+}
+
 /**
  * @brief This is a helper function from fSerializeFrame() to send variable values via faraabin link.
  * 
@@ -1082,6 +1494,36 @@ void fFaraabinLinkSerializer_VarTypeStructMemberDict(
   
 }
 
+/**
+ * @brief Sends the member dictionary of a user defined structure type from its constant layout table.
+ * 
+ * @note The offset of each member is sent in place of the member pointer.
+ * 
+ * @param structPtr Pointer to the varType fobject of the user defined type.
+ * @param reqSeq Request sequence counter.
+ */
+void fFaraabinLinkSerializer_VarTypeLayoutDict(uint32_t structPtr, uint8_t reqSeq) {
+  
+  sFaraabinFobjectVarType *me = (sFaraabinFobjectVarType*)structPtr;
+  const sFaraabinFobjectVarType_Member *member;
+  
+  if(me->fpGetMember == NULL) {
+    return;
+  }
+  
+  for(uint16_t i = 0U; (member = me->fpGetMember(i)) != NULL; i++) {
+    
+    fFaraabinLinkSerializer_VarTypeStructMemberDict(
+      structPtr,
+      (uint32_t)member->VarType,
+      (uint32_t)member->Offset,
+      (uint32_t)member->ArrayQty,
+      false,
+      (char*)member->Name,
+      reqSeq);
+  }
+}
+
 /**
  * @brief This is a helper function from fSerializeFrame() to send user defined enumeration type members via faraabin link.
  * 
@@ -1239,6 +1681,18 @@ static void fAddToBufferU8(uint8_t d) {
   
   uint8_t tmp = 0;
 
+  if(_serializer.DictIterator._isHashSinkActive) {
+    if(!_serializer.DictIterator._isHashExcluded) {
+      _serializer.DictIterator._hash = (_serializer.DictIterator._hash ^ d) * FB_DICT_HASH_PRIME;
+    }
+    return;
+  }
+  
+  if(_serializer.DictIterator._isSizeSinkActive) {
+    _serializer.DictIterator._sinkSize++;
+    return;
+  }
+
   _serializer.Serializer.CheckSum += d;
 
   if ((d == FB_EOF) || (d == FB_ESC)) { // If byte escaping is needed
@@ -1320,12 +1774,11 @@ static void fAddToBufferF32(float32_t d) {
  fAddToBufferU8(tmp.Byte[2]);
  fAddToBufferU8(tmp.Byte[3]);
 }
+#endif
 
 /**
  * @brief Adds a float 64-bit data to faraabin TX buffer.
  * 
- * @note This function is reserved here for future use.
- * 
  * @param d Value of data.
  */
 static void fAddToBufferF64(float64_t d) {
@@ -1342,7 +1795,6 @@ static void fAddToBufferF64(float64_t d) {
  fAddToBufferU8(tmp.Byte[6]);
  fAddToBufferU8(tmp.Byte[7]);
 }
-#endif
 
 /**
  * @brief Adds a string to faraabin TX buffer.
@@ -1369,6 +1821,93 @@ static void fAddToBuffer(uint8_t *data, uint32_t size) {
   }
 }
 
+/**
+ * @brief Adds a path or filename string of a dictionary to TX buffer of faraabin.
+ * 
+ * @note When string table is enabled, a string that is already sent is replaced by its id. Otherwise the longest
+ *       interned string that is a parent path of it is replaced by its id and only the suffix is sent.
+ *       New strings are always registered. When table is full, the oldest entry is reused.
+ * 
+ * @param str Pointer to the null terminated string.
+ */
+static void fAddToBufferDictString(const char *str) {
+  
+#ifdef FB_FEATURE_FLAG_DICT_STRING_TABLE
+  if(_serializer.DictIterator._isSizeSinkActive) {
+    // Table must not change while measuring. Definition and reference of ids take at most 4 bytes.
+    _serializer.DictIterator._sinkSize += (uint32_t)strlen(str) + 4U;
+    return;
+  }
+  
+  sDictStringTable *table = &_serializer.DictStrings;
+  uint16_t len = (uint16_t)strlen(str);
+  uint8_t best = FB_DICT_STRING_TABLE_QTY;
+  uint16_t bestLen = 0U;
+  uint32_t sent = 0U;
+  
+  for(uint8_t i = 0; i < table->Qty; i++) {
+    
+    uint16_t entryLen = table->Len[i];
+    
+    if((entryLen > len) || (entryLen <= bestLen)) {
+      continue;
+    }
+    
+    if((table->Str[i] != str) && (memcmp(table->Str[i], str, entryLen) != 0)) {
+      continue;
+    }
+    
+    if((entryLen == len) || (str[entryLen] == FB_DICT_PATH_SEPARATOR)) {
+      best = i;
+      bestLen = entryLen;
+      
+      if(entryLen == len) {
+        break;
+      }
+    }
+  }
+  
+  if((bestLen != len) && (len != 0U)) {
+    uint8_t id;
+    
+    if(table->Qty < FB_DICT_STRING_TABLE_QTY) {
+      id = table->Qty;
+      table->Qty++;
+    } else {
+      // Table is full. Entries are reused round robin; paths of neighbouring fobjects are mostly alike.
+      if(table->Victim == best) {
+        table->Victim = (uint8_t)((table->Victim + 1U) % FB_DICT_STRING_TABLE_QTY);
+      }
+      id = table->Victim;
+      table->Victim = (uint8_t)((table->Victim + 1U) % FB_DICT_STRING_TABLE_QTY);
+    }
+    
+    fAddToBufferU8(FB_DICT_STRING_DEF);
+    fAddToBufferU8((uint8_t)(FB_DICT_STRING_ID_BASE + id));
+    sent += 2U;
+    
+    table->Str[id] = str;
+    table->Len[id] = len;
+  }
+  
+  if(best < FB_DICT_STRING_TABLE_QTY) {
+    fAddToBufferU8(FB_DICT_STRING_REF);
+    fAddToBufferU8((uint8_t)(FB_DICT_STRING_ID_BASE + best));
+    sent += 2U;
+  }
+  
+  fAddToBuffer((uint8_t*)&str[bestLen], (uint32_t)(len - bestLen));
+  sent += (uint32_t)(len - bestLen);
+  
+  if(!_serializer.DictIterator._isHashSinkActive) {
+    table->RawBytes += len;
+    table->SentBytes += sent;
+  }
+#else
+  fAddToBuffer((uint8_t*)str, strlen(str));
+#endif
+}
+
 /**
  * @brief Generates payload for reporting enable status of common fobjects.
  * 
@@ -1478,19 +2017,23 @@ static void fDictGeneratePayloadCodeBlock(uint32_t fobjectPtr, void *param) {
     
     fAddToBuffer((uint8_t*)me->Name, strlen(me->Name));
     fAddToBufferU8((uint8_t)':');
-    fAddToBuffer((uint8_t*)me->_path, strlen(me->_path));
+    fAddToBufferDictString(me->_path);
     fAddToBufferU8((uint8_t)':');
-    fAddToBuffer((uint8_t*)me->_fileName, strlen(me->_fileName));
+    fAddToBufferDictString(me->_fileName);
     fAddToBufferU8('\0');
     
     return;
   }
   
+  DICT_RUNTIME_BEGIN_();
+  
   // Setting
   fCodeBlockSettingGeneratePayload(fobjectPtr, NULL);
   
   // Status
   
+  DICT_RUNTIME_END_();
+  
   // Dict
   fAddToBufferU32(fCpuProfiler_ProcessGetRamUsage(me));
 	fAddToBufferU8(me->MaxSectionQty);
@@ -1520,9 +2063,9 @@ static void fDictGeneratePayloadCodeBlock(uint32_t fobjectPtr, void *param) {
   
   fAddToBuffer((uint8_t*)me->Name, strlen(me->Name));
   fAddToBufferU8((uint8_t)':');
-  fAddToBuffer((uint8_t*)me->_path, strlen(me->_path));
+  fAddToBufferDictString(me->_path);
   fAddToBufferU8((uint8_t)':');
-  fAddToBuffer((uint8_t*)me->_fileName, strlen(me->_fileName));
+  fAddToBufferDictString(me->_fileName);
   
   fAddToBufferU8((uint8_t)':');
   for(uint16_t i = 0; i < me->SectionQty; i++) {
@@ -1618,19 +2161,23 @@ static void fDictGeneratePayloadDataBus(uint32_t fobjectPtr, void *param) {
     
     fAddToBuffer((uint8_t*)me->Name, strlen(me->Name));
     fAddToBufferU8((uint8_t)':');
-    fAddToBuffer((uint8_t*)me->Path, strlen(me->Path));
+    fAddToBufferDictString(me->Path);
     fAddToBufferU8((uint8_t)':');
-    fAddToBuffer((uint8_t*)me->Filename, strlen(me->Filename));
+    fAddToBufferDictString(me->Filename);
     fAddToBufferU8('\0');
     
     return;
   }
   
+  DICT_RUNTIME_BEGIN_();
+  
   // Status
   
   // Setting
   fDataBusSettingGeneratePayload(fobjectPtr, NULL);
   
+  DICT_RUNTIME_END_();
+  
   // Dict
   fAddToBufferU32(sizeof(sFaraabinFobjectDataBus));
 	fAddToBufferU32(sizeof(sFaraabinFobjectDataBus_Channel) * me->ChannelQty);
@@ -1641,9 +2188,9 @@ static void fDictGeneratePayloadDataBus(uint32_t fobjectPtr, void *param) {
   fAddToBufferU16(me->ChannelQty);
   fAddToBuffer((uint8_t*)me->Name, strlen(me->Name));
   fAddToBufferU8((uint8_t)':');
-  fAddToBuffer((uint8_t*)me->Path, strlen(me->Path));
+  fAddToBufferDictString(me->Path);
   fAddToBufferU8((uint8_t)':');
-  fAddToBuffer((uint8_t*)me->Filename, strlen(me->Filename));
+  fAddToBufferDictString(me->Filename);
   fAddToBufferU8('\0');
 }
 
@@ -1697,6 +2244,33 @@ static void fDataBusSettingGeneratePayload(uint32_t fobjectPtr, void *param) {
   }
 }
 
+/**
+ * @brief Generates payload for sending stride and quantity of databus slice channels.
+ * 
+ * @param fobjectPtr Pointer to the fobject.
+ * @param param Pointer to the parameters of the payload.
+ */
+static void fDataBusSliceSettingGeneratePayload(uint32_t fobjectPtr, void *param) {
+  
+  UNUSED_(param);
+  sFaraabinFobjectDataBus *me = (sFaraabinFobjectDataBus*)fobjectPtr;
+  
+  if(!me->_init) {
+    return;
+  }
+  
+  for(uint16_t i = 0; i < me->ChannelQty; i++) {
+    
+    if((me->_pBufferChannels[i].ItemFobjectPtr == 0U) || (me->_pBufferChannels[i].SliceQty == 0U)) {
+      continue;
+    }
+    
+    fAddToBufferU16(i);
+    fAddToBufferU16(me->_pBufferChannels[i].SliceStride);
+    fAddToBufferU16(me->_pBufferChannels[i].SliceQty);
+  }
+}
+
 /**
  * @brief Generates payload for sending captured values of databus fobjects.
  * 
@@ -1734,6 +2308,10 @@ static void fDataBusValueGeneratePayload(uint32_t fobjectPtr, void *param) {
     if(!me->_pBufferChannels[i].Enable) {
       continue;
     }
+    
+    if(!me->_pBufferChannels[i]._isReportDue) {
+      continue;
+    }
       
     switch(me->_pBufferChannels[i].ItemFobjectType) {
       
@@ -1743,8 +2321,22 @@ static void fDataBusValueGeneratePayload(uint32_t fobjectPtr, void *param) {
         fAddToBufferU8(me->_pBufferChannels[i].ItemFobjectType);
         fAddToBufferU32(me->_pBufferChannels[i].ItemFobjectPtr);
         
-        fAddToBufferU16(me->_pBufferChannels[i].ItemFobjectParam);
-        fAddToBuffer((uint8_t*)me->_pBufferChannels[i].ItemFobjectPtr, me->_pBufferChannels[i].ItemFobjectParam);
+        if(me->_pBufferChannels[i].SliceQty == 0U) {
+          
+          fAddToBufferU16(me->_pBufferChannels[i].ItemFobjectParam);
+          fAddToBuffer((uint8_t*)me->_pBufferChannels[i].ItemFobjectPtr, me->_pBufferChannels[i].ItemFobjectParam);
+          
+        } else {
+          
+          // Slice elements are gathered directly from their place in memory into the frame.
+          fAddToBufferU16((uint16_t)(me->_pBufferChannels[i].ItemFobjectParam * me->_pBufferChannels[i].SliceQty));
+          
+          uint8_t *elem = (uint8_t*)me->_pBufferChannels[i].ItemFobjectPtr;
+          for(uint16_t j = 0; j < me->_pBufferChannels[i].SliceQty; j++) {
+            fAddToBuffer(elem, me->_pBufferChannels[i].ItemFobjectParam);
+            elem += me->_pBufferChannels[i].SliceStride;
+          }
+        }
     
         break;
       }
@@ -1805,6 +2397,90 @@ static void fDataBusValueGeneratePayload(uint32_t fobjectPtr, void *param) {
   }
 }
 
+/**
+ * @brief Generates payload for sending aggregated stream values of databus fobjects.
+ * 
+ * @param fobjectPtr Pointer to the fobject.
+ * @param param Pointer to the parameters of the payload.
+ */
+static void fDataBusAggregateValueGeneratePayload(uint32_t fobjectPtr, void *param) {
+  
+  UNUSED_(param);
+  sFaraabinFobjectDataBus *me = (sFaraabinFobjectDataBus*)fobjectPtr;
+  
+  for(uint16_t i = 0; i < me->ChannelQty; i++) {
+    
+    sFaraabinFobjectDataBus_Channel *ch = &me->_pBufferChannels[i];
+    
+    if(ch->AggregateMode == (uint8_t)eDATABUS_CH_AGGREGATE_NONE) {
+      continue;
+    }
+    
+    if(!ch->Enable) {
+      continue;
+    }
+    
+    if(ch->_aggregate.Cnt == 0U) {
+      continue;
+    }
+    
+    fAddToBufferU8(ch->ItemFobjectType);
+    fAddToBufferU32(ch->ItemFobjectPtr);
+    
+    fAddToBufferU8(ch->AggregateMode);
+    fAddToBufferU16(ch->_aggregate.Cnt);
+    
+    fAddToBufferF64(ch->_aggregate.Min);
+    fAddToBufferF64(ch->_aggregate.Max);
+    fAddToBufferF64(ch->_aggregate.Sum / (float64_t)ch->_aggregate.Cnt);
+    
+    if(ch->AggregateMode == (uint8_t)eDATABUS_CH_AGGREGATE_ENVELOPE_RMS) {
+      fAddToBufferF64(sqrt(ch->_aggregate.SumSq / (float64_t)ch->_aggregate.Cnt));
+    }
+  }
+}
+
+/**
+ * @brief Generates payload for sending sample blocks of block mode databus channels.
+ * 
+ * @note Samples of each channel are sent as a vector of raw items, oldest first.
+ * 
+ * @param fobjectPtr Pointer to the fobject.
+ * @param param Pointer to the parameters of the payload.
+ */
+static void fDataBusBlockValueGeneratePayload(uint32_t fobjectPtr, void *param) {
+  
+  UNUSED_(param);
+  sFaraabinFobjectDataBus *me = (sFaraabinFobjectDataBus*)fobjectPtr;
+  
+  for(uint16_t i = 0; i < me->ChannelQty; i++) {
+    
+    sFaraabinFobjectDataBus_Channel *ch = &me->_pBufferChannels[i];
+    sFaraabinFobjectDataBus_ChBlockFifo *fifo = &ch->_blockFifo;
+    
+    if((fifo->_mask == 0U) || (fifo->_sendQty == 0U)) {
+      continue;
+    }
+    
+    fAddToBufferU8(ch->ItemFobjectType);
+    fAddToBufferU32(ch->ItemFobjectPtr);
+    
+    fAddToBufferU16(ch->ItemFobjectParam);
+    fAddToBufferU16(fifo->_sendQty);
+    
+    uint16_t start = fifo->_tail & fifo->_mask;
+    uint16_t firstQty = (uint16_t)(fifo->_mask + 1U - start);
+    if(firstQty > fifo->_sendQty) {
+      firstQty = fifo->_sendQty;
+    }
+    
+    fAddToBuffer(&fifo->_pBuffer[(uint32_t)start * ch->ItemFobjectParam], (uint32_t)firstQty * ch->ItemFobjectParam);
+    if(firstQty < fifo->_sendQty) {
+      fAddToBuffer(fifo->_pBuffer, (uint32_t)(fifo->_sendQty - firstQty) * ch->ItemFobjectParam);
+    }
+  }
+}
+
 /**
  * @brief Generates payload for sending dictionary of eventgroup fobjects.
  * 
@@ -1822,27 +2498,31 @@ static void fDictGeneratePayloadEventGroup(uint32_t fobjectPtr, void *param) {
     
     fAddToBuffer((uint8_t*)me->Name, strlen(me->Name));
     fAddToBufferU8((uint8_t)':');
-    fAddToBuffer((uint8_t*)me->Path, strlen(me->Path));
+    fAddToBufferDictString(me->Path);
     fAddToBufferU8((uint8_t)':');
-    fAddToBuffer((uint8_t*)me->Filename, strlen(me->Filename));
+    fAddToBufferDictString(me->Filename);
     fAddToBufferU8('\0');
     
     return;
   }
   
+  DICT_RUNTIME_BEGIN_();
+  
   // Setting
   fAddToBufferU8(me->Enable);
   
   // Status
   
+  DICT_RUNTIME_END_();
+  
   // Dict
   fAddToBufferU32(sizeof(sFaraabinFobjectEventGroup));
   
   fAddToBuffer((uint8_t*)me->Name, strlen(me->Name));
   fAddToBufferU8((uint8_t)':');
-  fAddToBuffer((uint8_t*)me->Path, strlen(me->Path));
+  fAddToBufferDictString(me->Path);
   fAddToBufferU8((uint8_t)':');
-  fAddToBuffer((uint8_t*)me->Filename, strlen(me->Filename));
+  fAddToBufferDictString(me->Filename);
   fAddToBufferU8('\0');
 }
 
@@ -1863,9 +2543,9 @@ static void fDictGeneratePayloadContainer(uint32_t fobjectPtr, void *param) {
     
     fAddToBuffer((uint8_t*)me->Name, strlen(me->Name));
     fAddToBufferU8((uint8_t)':');
-    fAddToBuffer((uint8_t*)me->Path, strlen(me->Path));
+    fAddToBufferDictString(me->Path);
     fAddToBufferU8((uint8_t)':');
-    fAddToBuffer((uint8_t*)me->Filename, strlen(me->Filename));
+    fAddToBufferDictString(me->Filename);
     fAddToBufferU8('\0');
     
     return;
@@ -1880,9 +2560,9 @@ static void fDictGeneratePayloadContainer(uint32_t fobjectPtr, void *param) {
   
   fAddToBuffer((uint8_t*)me->Name, strlen(me->Name));
   fAddToBufferU8((uint8_t)':');
-  fAddToBuffer((uint8_t*)me->Path, strlen(me->Path));
+  fAddToBufferDictString(me->Path);
   fAddToBufferU8((uint8_t)':');
-  fAddToBuffer((uint8_t*)me->Filename, strlen(me->Filename));
+  fAddToBufferDictString(me->Filename);
   fAddToBufferU8('\0');
 }
 
@@ -1903,25 +2583,28 @@ static void fDictGeneratePayloadMcu(uint32_t fobjectPtr, void *param) {
     
     fAddToBuffer((uint8_t*)me->Name, strlen(me->Name));
     fAddToBufferU8((uint8_t)':');
-    fAddToBuffer((uint8_t*)me->Path, strlen(me->Path));
+    fAddToBufferDictString(me->Path);
     fAddToBufferU8((uint8_t)':');
-    fAddToBuffer((uint8_t*)me->Filename, strlen(me->Filename));
+    fAddToBufferDictString(me->Filename);
     fAddToBufferU8('\0');
     
     return;
   }
   
+  DICT_RUNTIME_BEGIN_();
+  
   // Setting
   fAddToBufferU8(me->Enable);
   
   // Status
   uint16_t runningFunctions = fFaraabinFunctionEngine_GetQtyOfRunningFunctions();
   fAddToBufferU16(runningFunctions);
+  uint8_t fnHandle = FB_FENGINE_INVALID_HANDLE;
   for(uint16_t i = 0; i < runningFunctions; i++) {
     
     uint32_t ptr = 0U;
     uint32_t objectPtr = 0U;
-    if(fFaraabinFunctionEngine_GetPtrsOfRunningFunction(i, &ptr, &objectPtr) != 0) {
+    if(fFaraabinFunctionEngine_GetNextRunningFunction(&fnHandle, &ptr, &objectPtr) != 0) {
       // |Not going to happen.
     }
     
@@ -1929,13 +2612,18 @@ static void fDictGeneratePayloadMcu(uint32_t fobjectPtr, void *param) {
     fAddToBufferU32(objectPtr);
   }
   
+  DICT_RUNTIME_END_();
+  
   // Dict
   fAddToBufferU32(sizeof(sFaraabinFobjectMcu));
+  
+  DICT_RUNTIME_BEGIN_();
 	fAddToBufferU32(fFaraabinFunctionEngine_GetRamUsage());
 	fAddToBufferU32(fFaraabinLinkBuffer_GetRamUsage());
 	fAddToBufferU32(fFaraabinLinkHandler_GetRamUsage());
 	fAddToBufferU32(fFaraabinLinkSerializer_GetRamUsage());
 	fAddToBufferU32(fFaraabinDatabase_GetRamUsage());
+  DICT_RUNTIME_END_();
 }
 
 /**
@@ -2077,14 +2765,16 @@ static void fDictGeneratePayloadStateMachine(uint32_t fobjectPtr, void *param) {
     
     fAddToBuffer((uint8_t*)me->Name, strlen(me->Name));
     fAddToBufferU8((uint8_t)':');
-    fAddToBuffer((uint8_t*)me->_path, strlen(me->_path));
+    fAddToBufferDictString(me->_path);
     fAddToBufferU8((uint8_t)':');
-    fAddToBuffer((uint8_t*)me->_fileName, strlen(me->_fileName));
+    fAddToBufferDictString(me->_fileName);
     fAddToBufferU8('\0');
     
     return;
   }
   
+  DICT_RUNTIME_BEGIN_();
+  
   // Setting
   fStateMachineSettingGeneratePayload(fobjectPtr, NULL);
   
@@ -2092,6 +2782,8 @@ static void fDictGeneratePayloadStateMachine(uint32_t fobjectPtr, void *param) {
   fAddToBufferU32((uint32_t)me->_currentState);
   fAddToBufferU32((uint32_t)me->_lastTransitionOccurred);
   
+  DICT_RUNTIME_END_();
+  
   // Dict
   fAddToBufferU32(fStateMachine_GetRamUsage(me));
   
@@ -2108,9 +2800,9 @@ static void fDictGeneratePayloadStateMachine(uint32_t fobjectPtr, void *param) {
   
   fAddToBuffer((uint8_t*)me->Name, strlen(me->Name));
   fAddToBufferU8((uint8_t)':');
-  fAddToBuffer((uint8_t*)me->_path, strlen(me->_path));
+  fAddToBufferDictString(me->_path);
   fAddToBufferU8((uint8_t)':');
-  fAddToBuffer((uint8_t*)me->_fileName, strlen(me->_fileName));
+  fAddToBufferDictString(me->_fileName);
   fAddToBufferU8('\0');
 }
 #endif
@@ -2130,12 +2822,16 @@ static void fDictGeneratePayloadStateMachineState(uint32_t fobjectPtr, void *par
   
   fAddToBufferU8(eFO_TYPE_STATE_MACHINE_STATE | 0x80U);
   
+  DICT_RUNTIME_BEGIN_();
+  
   // Setting
   fAddToBufferU8(me->_enable);
   fAddToBufferU8(me->AllTransitionEnable);
   
   // Status
   
+  DICT_RUNTIME_END_();
+  
   // Dict
   fAddToBufferU32(sizeof(sState)); 
   
@@ -2167,11 +2863,15 @@ static void fDictGeneratePayloadStateMachineTransition(uint32_t fobjectPtr, void
   
   fAddToBufferU8(eFO_TYPE_STATE_MACHINE_TRANSITION | 0x80U);
   
+  DICT_RUNTIME_BEGIN_();
+  
   // Setting
   fAddToBufferU8(me->_enable);
   
   // Status
   
+  DICT_RUNTIME_END_();
+  
   // Dict
   fAddToBufferU32(sizeof(sTransition));
   
@@ -2294,7 +2994,7 @@ static void fDictGeneratePayloadVar(uint32_t fobjectPtr, void *param) {
   
   fAddToBuffer((uint8_t*)par->Name, strlen(par->Name));
   fAddToBufferU8((uint8_t)':');
-  fAddToBuffer((uint8_t*)par->Path, strlen(par->Path));
+  fAddToBufferDictString(par->Path);
   fAddToBufferU8('\0');
 }
 
@@ -2316,9 +3016,9 @@ static void fDictGeneratePayloadVarType(uint32_t fobjectPtr, void *param) {
     
     fAddToBuffer((uint8_t*)me->Name, strlen(me->Name));
     fAddToBufferU8((uint8_t)':');
-    fAddToBuffer((uint8_t*)me->Path, strlen(me->Path));
+    fAddToBufferDictString(me->Path);
     fAddToBufferU8((uint8_t)':');
-    fAddToBuffer((uint8_t*)me->Filename, strlen(me->Filename));
+    fAddToBufferDictString(me->Filename);
     fAddToBufferU8('\0');
     
     return;
@@ -2335,9 +3035,9 @@ static void fDictGeneratePayloadVarType(uint32_t fobjectPtr, void *param) {
   fAddToBufferU32(me->Size);
   fAddToBuffer((uint8_t*)me->Name, strlen(me->Name));
   fAddToBufferU8((uint8_t)':');
-  fAddToBuffer((uint8_t*)me->Path, strlen(me->Path));
+  fAddToBufferDictString(me->Path);
   fAddToBufferU8((uint8_t)':');
-  fAddToBuffer((uint8_t*)me->Filename, strlen(me->Filename));
+  fAddToBufferDictString(me->Filename);
   fAddToBufferU8('\0');
 }
 
@@ -2400,6 +3100,22 @@ static void fDictGeneratePayloadIterator(uint32_t fobjectPtr, void *param) {
   }
 }
 
+/**
+ * @brief Generates payload for sending content hash of the dictionary.
+ * 
+ * @param fobjectPtr Pointer to the fobject.
+ * @param param Pointer to the calculated hash.
+ */
+static void fMcuDictHashGeneratePayload(uint32_t fobjectPtr, void *param) {
+  
+  UNUSED_(fobjectPtr);
+  
+  fAddToBufferU32(*(uint32_t*)param);
+  fAddToBufferU8(FB_DICT_FORMAT_VERSION);
+  fAddToBufferU32(fFaraabinDatabase_GetNumberOfAddedDicts());
+  fAddToBufferU32(fCountAllDictsFrames());
+}
+
 /**
  * @brief Resets Serializer frame for new frame generation.
  * 
@@ -2519,12 +3235,64 @@ static void fSerializeDict(
   void(*fpGenerateDictPayload)(uint32_t, void*),
   void *dictPayloadParam) {
 
-  if(!fDictIteratorIsInCountingMode()) {
+  if(_serializer.DictIterator._isInHashingMode) {
+    sGeneratePayloadDict_Param param;
+
+    param.fpGenerateDictPayload = fpGenerateDictPayload;
+    param.pDictPayloadParam = dictPayloadParam;
+    
+    // Interrupts must not serialize frames while the byte sink is redirected to the hash.
+    FARAABIN_CRITICIAL_ENTER_;
+    _serializer.DictIterator._isHashSinkActive = true;
+    fDictGeneratePayloadIterator(fobjectPtr, &param);
+    _serializer.DictIterator._isHashSinkActive = false;
+    FARAABIN_CRITICIAL_EXIT_;
+    
+  } else if(_serializer.DictIterator._isInPipelineMode) {
+    
+    // Frames before the resume index are already sent. When the next frame may cross the watermark, the rest are
+    // skipped and the next call resumes from the first one of them. A frame larger than the watermark is only
+    // serialized in an empty buffer, so the bytes above the watermark stay free for live traffic.
+    if(!_serializer.DictIterator._isPaused && (_serializer.DictIterator.CurrentSubDictIndex >= _serializer.DictIterator._resumeSubDictIndex)) {
+      
+      sGeneratePayloadDict_Param param;
+
+      param.fpGenerateDictPayload = fpGenerateDictPayload;
+      param.pDictPayloadParam = dictPayloadParam;
+      
+      uint32_t frameSize = fFaraabinLinkSerializer_GetFrameSizeMax(fDictPayloadSizeMax(fobjectPtr, &param));
+      
+      if((FbCircularBuffer._count != 0U) && ((FbCircularBuffer._count + frameSize) > _serializer.DictIterator._watermark)) {
+        _serializer.DictIterator._isPaused = true;
+      } else {
+        fSerializeFrame(  
+          eFB_LINK_FRAME_TYPE_RESPONSE,
+          fobjectSeqPtr,
+          reqSeq,
+          false,
+          fobjectPtr,
+          0,
+          (uint8_t)eFB_PROP_GROUP_DICT,
+          (uint8_t)FB_COMMON_PROP_ID_DICT,
+          fDictGeneratePayloadIterator, &param);
+        
+        _serializer.DictIterator._resumeSubDictIndex = _serializer.DictIterator.CurrentSubDictIndex + 1U;
+      }
+    }
+    
+  } else if(!fDictIteratorIsInCountingMode()) {
     sGeneratePayloadDict_Param param;
 
     param.fpGenerateDictPayload = fpGenerateDictPayload;
     param.pDictPayloadParam = dictPayloadParam;
 
+    // Dictionary frames are batched and sent in large chunks. Buffer is flushed only when the next frame may not fit
+    // in its free space, so no frame is overwritten. The caller flushes the rest after the last frame.
+    uint32_t frameSize = fFaraabinLinkSerializer_GetFrameSizeMax(fDictPayloadSizeMax(fobjectPtr, &param));
+    if(fFaraabinLinkSerializer_GetTxFreeSpace() < frameSize) {
+      fFaraabinLinkHandler_FlushBuffer();
+    }
+
     fSerializeFrame(  
       eFB_LINK_FRAME_TYPE_RESPONSE,
       fobjectSeqPtr,
@@ -2535,14 +3303,36 @@ static void fSerializeDict(
       (uint8_t)eFB_PROP_GROUP_DICT,
       (uint8_t)FB_COMMON_PROP_ID_DICT,
       fDictGeneratePayloadIterator, &param);
-      
-    fFaraabinLinkHandler_FlushBuffer();
   }
 
   fDictIteratorIterate();
 
 }
 
+/**
+ * @brief Measures the payload size of a dictionary frame without putting it in TX buffer.
+ * 
+ * @note Strings that may be replaced by string table ids are counted with their worst case size,
+ *       so the result is an upper bound of the payload that is actually serialized.
+ * 
+ * @param fobjectPtr Pointer of the fobject.
+ * @param param Pointer to the payload parameters of the dictionary frame.
+ * @return size Maximum size of the payload in bytes before escaping.
+ */
+static uint32_t fDictPayloadSizeMax(uint32_t fobjectPtr, sGeneratePayloadDict_Param *param) {
+  
+  // Interrupts must not serialize frames while the byte sink is redirected to the size counter.
+  FARAABIN_CRITICIAL_ENTER_;
+  _serializer.DictIterator._sinkSize = 0U;
+  _serializer.DictIterator._isSizeSinkActive = true;
+  fDictGeneratePayloadIterator(fobjectPtr, param);
+  _serializer.DictIterator._isSizeSinkActive = false;
+  uint32_t size = _serializer.DictIterator._sinkSize;
+  FARAABIN_CRITICIAL_EXIT_;
+  
+  return size;
+}
+
 /**
  * @brief Generates dictionary for the fobjects based on their type.
  * 
@@ -2631,6 +3421,8 @@ static void fGenerateDict(uint32_t fobjectPtr, uint8_t reqSeq) {
       if(me->fpContainerFunc != NULL) {
         me->fpContainerFunc(reqSeq);
       }
+      
+      fGenerateSectionVarDicts(me, reqSeq);
 
       break;
     }
@@ -2717,6 +3509,52 @@ static uint32_t fCountAllDictsFrames(void) {
   return _serializer.DictIterator.TotalSubDicts; // It is counted for all dicts, hence all frame counts
 }
 
+/**
+ * @brief Generates dictionaries of the variables that are placed in faraabin dictionary section for a container.
+ * 
+ * @note Descriptors are read directly from flash. In counting mode, the number of frames is already known
+ *       from initialization of the container and section is not walked.
+ * 
+ * @param me Pointer to the container.
+ * @param reqSeq Request sequence counter.
+ */
+static void fGenerateSectionVarDicts(const sFaraabinFobjectContainer *me, uint8_t reqSeq) {
+  
+  if(me->_sectionVarQty == 0U) {
+    return;
+  }
+  
+  if(fDictIteratorIsInCountingMode()) {
+    _serializer.DictIterator.TotalSubDicts += me->_sectionVarQty;
+    return;
+  }
+  
+  sFaraabinFobjectMcu *mcu = (sFaraabinFobjectMcu*)fFaraabinFobjectMcu_GetFobject();
+  const sFaraabinSectionVarDict *end = fFaraabinFobjectContainer_GetSectionVarEnd();
+  
+  for(const sFaraabinSectionVarDict *var = fFaraabinFobjectContainer_GetSectionVarBegin(); var < end; var++) {
+    
+    if(var->Container != me) {
+      continue;
+    }
+    
+    sDictVarPayloadParam payLoad;
+    
+    payLoad.VarPtr = (uint32_t)var->VarPtr;
+    payLoad.VarTypePtr = (uint32_t)var->VarTypePtr;
+    payLoad.VarArrayQty = var->VarArrayQty;
+    payLoad.ExternalInterface = 0U;
+    payLoad.AccessCallBack = (uint32_t)var->AccessCallBack;
+    payLoad._isPtr = var->_isPtr;
+    payLoad.Name = var->Name;
+    payLoad.Path = var->Path;
+    CorrectPath_(payLoad.Path);
+    payLoad.FileName = NULL;
+    
+    fSerializeDict(payLoad.VarPtr, &mcu->Seq, reqSeq, fDictGeneratePayloadVar, &payLoad);
+  }
+}
+
 /**
  * @brief Generates dictionary payload for function groups.
  * 
@@ -2737,7 +3575,7 @@ static void fDictGeneratePayloadFunctionGroupType(uint32_t fobjectPtr, void *par
     fAddToBufferU8((uint8_t)':');
     fAddToBuffer((uint8_t*)"type", strlen("type"));
     fAddToBufferU8((uint8_t)':');
-    fAddToBuffer((uint8_t*)me->Filename, strlen(me->Filename));
+    fAddToBufferDictString(me->Filename);
     fAddToBufferU8('\0');
     
     return;
@@ -2752,7 +3590,7 @@ static void fDictGeneratePayloadFunctionGroupType(uint32_t fobjectPtr, void *par
   
   fAddToBuffer((uint8_t*)me->Name, strlen(me->Name));
   fAddToBufferU8((uint8_t)':');
-  fAddToBuffer((uint8_t*)me->Filename, strlen(me->Filename));
+  fAddToBufferDictString(me->Filename);
   fAddToBufferU8((uint8_t)':');
   fAddToBuffer((uint8_t*)me->Help, strlen(me->Help));
   fAddToBufferU8('\0');
@@ -2796,9 +3634,9 @@ static void fDictGeneratePayloadFunctionGroup(uint32_t fobjectPtr, void *param)
   fAddToBufferU32(par->GroupTypePtr);
   fAddToBuffer((uint8_t*)par->ObjectName, strlen(par->ObjectName));
   fAddToBufferU8((uint8_t)':');
-  fAddToBuffer((uint8_t*)par->Path, strlen(par->Path));
+  fAddToBufferDictString(par->Path);
   fAddToBufferU8((uint8_t)':');
-  fAddToBuffer((uint8_t*)par->FileName, strlen(par->FileName));
+  fAddToBufferDictString(par->FileName);
   fAddToBufferU8('\0');
 }
 
@@ -121,7 +121,8 @@ typedef enum {
   eFB_MCU_PROP_ID_MONITORING_LIVE,
   eFB_MCU_PROP_ID_MONITORING_PING,
   eFB_MCU_PROP_ID_MONITORING_WHOAMI,
-	eFB_MCU_PROP_ID_MONITORING_PROFILER
+	eFB_MCU_PROP_ID_MONITORING_PROFILER,
+  eFB_MCU_PROP_ID_MONITORING_DICT_HASH
 
 }eFaraabinLinkSerializer_McuPropertyIdMonitoring;
 
@@ -132,7 +133,8 @@ typedef enum {
   eFB_MCU_PROP_ID_COMMAND_SEND_WHOAMI,
   eFB_MCU_PROP_ID_COMMAND_SEND_ALL_DICT,
   eFB_MCU_PROP_ID_COMMAND_RESET_CPU,
-  eFB_MCU_PROP_ID_COMMAND_CLEAR_FLAG_BUFFER_OVF
+  eFB_MCU_PROP_ID_COMMAND_CLEAR_FLAG_BUFFER_OVF,
+  eFB_MCU_PROP_ID_COMMAND_SEND_DICT_HASH
 
 }eFaraabinLinkSerializer_McuProperyIdCommand;
 
@@ -153,13 +155,19 @@ typedef enum {
 	eFO_DB_PROP_ID_SETTING_STREAM_DIVIDEBY,
 	eFO_DB_PROP_ID_SETTING_TIMER_DIVIDEBY,
 	eFO_DB_PROP_ID_SETTING_TRIG_DIVIDEBY,
+	eFO_DB_PROP_ID_SETTING_CH_AGGREGATE,
+	eFO_DB_PROP_ID_SETTING_CH_REPORT,
+	eFO_DB_PROP_ID_SETTING_KEEPALIVE_DIVIDEBY,
+	eFO_DB_PROP_ID_SETTING_CH_SLICE,
 
 }eFaraabinLinkSerializer_DataBusPropertyIdSetting;
 
 typedef enum {
 
   eFB_DB_PROP_ID_MONITORING_CAPTURE_VALUE,
-  eFB_DB_PROP_ID_MONITORING_STREAM_VALUE
+  eFB_DB_PROP_ID_MONITORING_STREAM_VALUE,
+  eFB_DB_PROP_ID_MONITORING_STREAM_AGGREGATE_VALUE,
+  eFB_DB_PROP_ID_MONITORING_STREAM_BLOCK_VALUE
 
 }eFaraabinLinkSerializer_DataBusPropertyIdMonitoring;
 
@@ -175,7 +183,8 @@ typedef enum {
   eFB_DB_PROP_ID_COMMAND_CAPTURE_SEND,
   eFB_DB_PROP_ID_COMMAND_MANUAL_TRIG,
   eFB_DB_PROP_ID_COMMAND_ENABLE_ALL_ITEM,
-  eFB_DB_PROP_ID_COMMAND_DISABLE_ALL_ITEM
+  eFB_DB_PROP_ID_COMMAND_DISABLE_ALL_ITEM,
+  eFB_DB_PROP_ID_COMMAND_ATTACH_SLICE
 
 }eFaraabinLinkSerializer_DataBusPropertyIdCommand;
 
@@ -380,6 +389,30 @@ void fFaraabinLinkSerializer_SerializeDict(
   uint16_t dictIndex,
   uint8_t reqSeq);
 
+/**
+ * @brief Serializes dictionary of a fobject into TX buffer until the buffer reaches the watermark.
+ * 
+ * @note It never waits for the link. If the buffer reaches the watermark in the middle of the dictionary,
+ *       serializing stops and the next call with the same dictIndex resumes from the first frame that is not sent.
+ * 
+ * @param fobjectPtr Pointer to the fobject.
+ * @param dictIndex Index of the fobject in database.
+ * @param reqSeq Request sequence counter.
+ * @param watermark Number of bytes in TX buffer that dictionary frames must not exceed.
+ * @return isDone Returns true if the whole dictionary of the fobject is serialized, false if it must be called again.
+ */
+bool fFaraabinLinkSerializer_SerializeDictPipelined(
+  uint32_t fobjectPtr,
+  uint16_t dictIndex,
+  uint8_t reqSeq,
+  uint32_t watermark);
+
+/**
+ * @brief Drops the position of the partially sent dictionary, so the next pipelined call starts from the first frame.
+ * 
+ */
+void fFaraabinLinkSerializer_CancelDictPipeline(void);
+
 /**
  * @brief Flushes main queue of faraabin.
  * 
@@ -388,6 +421,28 @@ void fFaraabinLinkSerializer_SerializeDict(
  */
 uint16_t fFaraabinLinkSerializer_FlushBuffer(uint8_t **ptrToBuffer);
 
+/**
+ * @brief Returns the free space of faraabin TX buffer.
+ * 
+ * @return size Number of bytes that can be added to TX buffer without overwriting pending data.
+ */
+uint32_t fFaraabinLinkSerializer_GetTxFreeSpace(void);
+
+/**
+ * @brief Returns the size of faraabin TX buffer.
+ * 
+ * @return size Size of TX buffer in bytes.
+ */
+uint32_t fFaraabinLinkSerializer_GetTxSize(void);
+
+/**
+ * @brief Returns the worst case size of a frame in TX buffer, i.e. when all of its bytes need escaping.
+ * 
+ * @param payloadSize Size of the payload of the frame in bytes.
+ * @return size Maximum size of the frame in bytes.
+ */
+uint32_t fFaraabinLinkSerializer_GetFrameSizeMax(uint32_t payloadSize);
+
 /* Helper functions ----------------------------------------------------------*/
 /**
  * @brief This is a helper function from SerializeFrame() to send common user data via faraabin link.
@@ -439,6 +494,15 @@ void fFaraabinLinkSerializer_CodeBlockSendSetting(uint32_t fobjectPtr, uint8_t *
  */
 void fFaraabinLinkSerializer_DataBusSendSetting(uint32_t fobjectPtr, uint8_t *fobjectSeq, uint8_t reqSeq);
 
+/**
+ * @brief This is a helper function from fSerializeFrame() to send stride and quantity of databus slice channels via faraabin link.
+ * 
+ * @param fobjectPtr Pointer to the databus fobject.
+ * @param fobjectSeq Sequence counter of the fobject.
+ * @param reqSeq Request sequence counter of the frame.
+ */
+void fFaraabinLinkSerializer_DataBusSendSliceSetting(uint32_t fobjectPtr, uint8_t *fobjectSeq, uint8_t reqSeq);
+
 /**
  * @brief This is a helper function from SerializeFrame() to send databus captured values via faraabin link.
  * 
@@ -460,6 +524,26 @@ void fFaraabinLinkSerializer_DataBusSendCaptureValue(uint32_t fobjectPtr, uint8_
  */
 void fFaraabinLinkSerializer_DataBusSendValue(uint32_t fobjectPtr, uint8_t *fobjectSeq, uint8_t reqSeq, bool isResponse);
 
+/**
+ * @brief This is a helper function from SerializeFrame() to send aggregated (min/max/mean) stream values of databus channels via faraabin link.
+ * 
+ * @param fobjectPtr Pointer to the databus fobject.
+ * @param fobjectSeq Sequence counter of the fobject.
+ * @param reqSeq Request sequence counter of the frame.
+ * @param isResponse Flag for indicating that this frame is a response.
+ */
+void fFaraabinLinkSerializer_DataBusSendAggregateValue(uint32_t fobjectPtr, uint8_t *fobjectSeq, uint8_t reqSeq, bool isResponse);
+
+/**
+ * @brief This is a helper function from SerializeFrame() to send sample blocks of block mode databus channels via faraabin link.
+ * 
+ * @param fobjectPtr Pointer to the databus fobject.
+ * @param fobjectSeq Sequence counter of the fobject.
+ * @param reqSeq Request sequence counter of the frame.
+ * @param isResponse Flag for indicating that this frame is a response.
+ */
+void fFaraabinLinkSerializer_DataBusSendBlockValue(uint32_t fobjectPtr, uint8_t *fobjectSeq, uint8_t reqSeq, bool isResponse);
+
 /**
  * @brief This is a helper function from SerializeFrame() to send variable values via faraabin link.
  * 
@@ -499,6 +583,44 @@ void fFaraabinLinkSerializer_McuSendLive(uint32_t fobjectPtr, uint8_t *fobjectSe
  */
 void fFaraabinLinkSerializer_McuSendWhoAmI(uint32_t fobjectPtr, uint8_t *fobjectSeq, uint8_t reqSeq);
 
+/**
+ * @brief Calculates the content hash of all dictionaries in database.
+ * 
+ * @note The host can compare this hash with the one of its cached dictionary and skip the transfer if they match.
+ * 
+ * @return hash Content hash of the dictionary.
+ */
+uint32_t fFaraabinLinkSerializer_GetDictHash(void);
+
+/**
+ * @brief This is a helper function from SerializeFrame() to send content hash of the dictionary via faraabin link.
+ * 
+ * @param fobjectPtr Pointer to the MCU fobject.
+ * @param fobjectSeq Fobject sequence counter.
+ * @param reqSeq Request sequence counter.
+ */
+void fFaraabinLinkSerializer_McuSendDictHash(uint32_t fobjectPtr, uint8_t *fobjectSeq, uint8_t reqSeq);
+
+/**
+ * @brief Resets the string table of dictionary frames.
+ * 
+ * @note It must be called before sending the whole dictionary, so that host and MCU start with the same empty table.
+ *       It does nothing when FB_FEATURE_FLAG_DICT_STRING_TABLE is not enabled.
+ * 
+ */
+void fFaraabinLinkSerializer_ResetDictStrings(void);
+
+/**
+ * @brief Returns the size of path and filename strings in dictionary frames since the last reset of string table.
+ * 
+ * @note It is used for measuring the effect of string table on the dictionary size. Both values are zero
+ *       when FB_FEATURE_FLAG_DICT_STRING_TABLE is not enabled.
+ * 
+ * @param rawBytes Pointer to the number of string bytes without string table.
+ * @param sentBytes Pointer to the number of string bytes that are actually sent.
+ */
+void fFaraabinLinkSerializer_GetDictStringStats(uint32_t *rawBytes, uint32_t *sentBytes);
+
 void fFaraabinLinkSerializer_McuSendProfiler(uint32_t fobjectPtr, uint8_t *fobjectSeq);
 
 /**
@@ -540,6 +662,16 @@ void fFaraabinLinkSerializer_VarTypeStructMemberDict(
   char *name,
   uint8_t reqSeq);
 
+/**
+ * @brief Sends the member dictionary of a user defined structure type from its constant layout table.
+ * 
+ * @note The offset of each member is sent in place of the member pointer.
+ * 
+ * @param structPtr Pointer to the varType fobject of the user defined type.
+ * @param reqSeq Request sequence counter.
+ */
+void fFaraabinLinkSerializer_VarTypeLayoutDict(uint32_t structPtr, uint8_t reqSeq);
+
 /**
  * @brief This is a helper function from SerializeFrame() to send user defined enumeration type members via faraabin link.
  * 
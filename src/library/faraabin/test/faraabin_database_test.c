@@ -0,0 +1,287 @@
+/**
+ ******************************************************************************
+ * @file           : faraabin_database_test.c
+ * @brief          :
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2024 FaraabinCo.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component
+ *
+ * https://faraabinco.ir/
+ * https://github.com/FaraabinCo
+ *
+ ******************************************************************************
+ * @verbatim
+ * @endverbatim
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "faraabin_database_test.h"
+
+#include "unity_fixture.h"
+#include "faraabin.h"
+#include "faraabin_database.h"
+
+/* Private define ------------------------------------------------------------*/
+#define DB_TEST_EVENT_GROUP_QTY   (24U) /*!< Number of event groups that are registered next to each other in memory. */
+#define DB_TEST_DATABUS_QTY       (3U)  /*!< Number of databuses registered by the test. */
+
+/* Private macro -------------------------------------------------------------*/
+/* Private typedef -----------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+TEST_GROUP(DatabaseTest);
+
+FARAABIN_DATABUS_DEF_STATIC_(DbTestDatabus0);
+FARAABIN_DATABUS_DEF_STATIC_(DbTestDatabus1);
+FARAABIN_DATABUS_DEF_STATIC_(DbTestDatabus2);
+static sFaraabinFobjectDataBus_Channel DbTestChannelBuffer[DB_TEST_DATABUS_QTY][1];
+static sFaraabinFobjectDataBus_CaptureValue DbTestCaptureBuffer[DB_TEST_DATABUS_QTY][1];
+
+static sFaraabinFobjectDataBus *const DbTestDatabus[DB_TEST_DATABUS_QTY] = {
+  &DbTestDatabus0,
+  &DbTestDatabus1,
+  &DbTestDatabus2
+};
+
+FARAABIN_DICT_GROUP_DEF_STATIC_(DbTestDg);
+
+static sFaraabinFobjectEventGroup DbTestEventGroup[DB_TEST_EVENT_GROUP_QTY];
+
+FARAABIN_EVENT_GROUP_DEF_STATIC_(DbTestNotAddedEventGroup);
+
+/* Private function prototypes -----------------------------------------------*/
+static void RunTests(void);
+static void OneTimeSetup(void);
+static void OneTimeTeardown(void);
+
+/* Variables -----------------------------------------------------------------*/
+
+/*
+╔══════════════════════════════════════════════════════════════════════════════════╗
+║                          ##### Exported Functions #####                          ║
+╚══════════════════════════════════════════════════════════════════════════════════╝
+*/
+
+/**
+ * @brief Function that runs all unit tests and returns the result
+ *
+ * @param argc
+ * @param argv
+ * @return int
+ */
+int FaraabinDatabaseTest_Run(int argc, const char* argv[]) {
+
+  OneTimeSetup();
+
+  int testsFailed = UnityMain(argc, argv, RunTests);
+
+  OneTimeTeardown();
+
+  return testsFailed;
+}
+
+/*
+╔══════════════════════════════════════════════════════════════════════════════════╗
+║                            ##### Private Functions #####                         ║
+╚══════════════════════════════════════════════════════════════════════════════════╝
+*/
+
+/**
+ * @brief Test group runner.
+ *
+ */
+TEST_GROUP_RUNNER(DatabaseTest) {
+
+  RUN_TEST_CASE(DatabaseTest, TemplateTest);
+  RUN_TEST_CASE(DatabaseTest, DuplicateIsRejected);
+  RUN_TEST_CASE(DatabaseTest, TypeListsMatchDatabase);
+  RUN_TEST_CASE(DatabaseTest, DatabusListInRegistrationOrder);
+
+}
+
+/**
+ * @brief Run all tests in test group.
+ *
+ */
+static void RunTests(void) {
+  RUN_TEST_GROUP(DatabaseTest);
+}
+
+/**
+ * @brief Unit test setup.
+ *
+ */
+TEST_SETUP(DatabaseTest) {
+
+}
+
+/**
+ * @brief Unit test teardown.
+ *
+ */
+TEST_TEAR_DOWN(DatabaseTest) {
+
+}
+
+/**
+ * @brief Template test.
+ *
+ */
+TEST(DatabaseTest, TemplateTest) {
+
+  TEST_ASSERT(true);
+}
+
+/**
+ * @brief Every registered fobject is found by the hash set and adding it again is rejected without changing
+ *        the database. Event groups are next to each other in memory, so their hash slots collide.
+ *
+ */
+TEST(DatabaseTest, DuplicateIsRejected) {
+
+  uint16_t dictQty = fFaraabinDatabase_GetNumberOfAddedDicts();
+  uint32_t generation = fFaraabinDatabase_GetGeneration();
+
+  for(uint16_t i = 0; i < DB_TEST_EVENT_GROUP_QTY; i++) {
+
+    uint32_t fobjectPtr = (uint32_t)&DbTestEventGroup[i];
+
+    TEST_ASSERT_TRUE(fFaraabinDatabase_IsDictExist(fobjectPtr));
+
+    FaraabinFlags.Status.Bitfield.DictDuplicate = 0U;
+    TEST_ASSERT_EQUAL_UINT8(1U, fFaraabinDatabase_AddDict(fobjectPtr));
+    TEST_ASSERT_EQUAL_UINT32(1U, FaraabinFlags.Status.Bitfield.DictDuplicate);
+  }
+
+  for(uint16_t i = 0; i < DB_TEST_DATABUS_QTY; i++) {
+
+    FaraabinFlags.Status.Bitfield.DictDuplicate = 0U;
+    TEST_ASSERT_EQUAL_UINT8(1U, fFaraabinDatabase_AddDict((uint32_t)DbTestDatabus[i]));
+    TEST_ASSERT_EQUAL_UINT32(1U, FaraabinFlags.Status.Bitfield.DictDuplicate);
+  }
+
+  FaraabinFlags.Status.Bitfield.DictDuplicate = 0U;
+  TEST_ASSERT_EQUAL_UINT8(1U, fFaraabinDatabase_AddDict((uint32_t)&DbTestDg));
+  TEST_ASSERT_EQUAL_UINT32(1U, FaraabinFlags.Status.Bitfield.DictDuplicate);
+  FaraabinFlags.Status.Bitfield.DictDuplicate = 0U;
+
+  TEST_ASSERT_FALSE(fFaraabinDatabase_IsDictExist((uint32_t)&DbTestNotAddedEventGroup));
+
+  TEST_ASSERT_EQUAL_UINT16(dictQty, fFaraabinDatabase_GetNumberOfAddedDicts());
+  TEST_ASSERT_EQUAL_UINT32(generation, fFaraabinDatabase_GetGeneration());
+}
+
+/**
+ * @brief List of each fobject type visits exactly the dicts of that type, in the order of the database.
+ *
+ */
+TEST(DatabaseTest, TypeListsMatchDatabase) {
+
+  uint16_t dictQty = fFaraabinDatabase_GetNumberOfAddedDicts();
+
+  for(uint8_t type = 0; type < (uint8_t)eFO_TYPE_FOBJECT_END; type++) {
+
+    uint16_t listIndex = fFaraabinDatabase_GetFirstDictOfType(type);
+
+    for(uint16_t i = 0; i < dictQty; i++) {
+
+      uint32_t fobjectPtr = fFaraabinDatabase_GetFobjectPointerFromDict(i);
+      if(*((uint8_t*)fobjectPtr) != type) {
+        continue;
+      }
+
+      TEST_ASSERT_EQUAL_UINT16(i, listIndex);
+      listIndex = fFaraabinDatabase_GetNextDictOfType(listIndex);
+    }
+
+    TEST_ASSERT_EQUAL_UINT16(FB_DATABASE_INVALID_INDEX, listIndex);
+  }
+
+  TEST_ASSERT_EQUAL_UINT16(FB_DATABASE_INVALID_INDEX, fFaraabinDatabase_GetFirstDictOfType((uint8_t)eFO_TYPE_FOBJECT_END));
+  TEST_ASSERT_EQUAL_UINT16(FB_DATABASE_INVALID_INDEX, fFaraabinDatabase_GetNextDictOfType(dictQty));
+}
+
+/**
+ * @brief Databus list that faraabin run loop uses skips the other fobjects and keeps the registration order
+ *        of databuses.
+ *
+ */
+TEST(DatabaseTest, DatabusListInRegistrationOrder) {
+
+  uint16_t databusIndex = 0U;
+  uint16_t visitQty = 0U;
+  uint16_t databusQty = 0U;
+
+  for(uint16_t i = 0; i < fFaraabinDatabase_GetNumberOfAddedDicts(); i++) {
+    if(*((uint8_t*)fFaraabinDatabase_GetFobjectPointerFromDict(i)) == (uint8_t)eFO_TYPE_DATABUS) {
+      databusQty++;
+    }
+  }
+
+  for(uint16_t i = fFaraabinDatabase_GetFirstDictOfType((uint8_t)eFO_TYPE_DATABUS); i != FB_DATABASE_INVALID_INDEX; i = fFaraabinDatabase_GetNextDictOfType(i)) {
+
+    uint32_t fobjectPtr = fFaraabinDatabase_GetFobjectPointerFromDict(i);
+    TEST_ASSERT_EQUAL_UINT8((uint8_t)eFO_TYPE_DATABUS, *((uint8_t*)fobjectPtr));
+    visitQty++;
+
+    if((databusIndex < DB_TEST_DATABUS_QTY) && (fobjectPtr == (uint32_t)DbTestDatabus[databusIndex])) {
+      databusIndex++;
+    }
+  }
+
+  TEST_ASSERT_EQUAL_UINT16(DB_TEST_DATABUS_QTY, databusIndex);
+  TEST_ASSERT_EQUAL_UINT16(databusQty, visitQty);
+}
+
+/**
+ * @brief Setup that executes before all tests.
+ *
+ * @note Fobjects of different types are registered in mixed order.
+ *
+ */
+static void OneTimeSetup(void) {
+
+  for(uint16_t i = 0; i < DB_TEST_EVENT_GROUP_QTY; i++) {
+
+    FARAABIN_EVENT_GROUP_SET_VALUE_(DbTestEventGroup[i].Name, "DbTestEventGroup");
+    FARAABIN_EventGroup_Init_WithPath_(&DbTestEventGroup[i], "DatabaseTest\\EventGroups");
+
+    if((i % 8U) == 0U) {
+
+      sFaraabinFobjectDataBus *databus = DbTestDatabus[i / 8U];
+
+      FARAABIN_DATABUS_SET_VALUE_(databus->ChannelQty, 1);
+      FARAABIN_DATABUS_SET_VALUE_(databus->BufferCaptureSize, 1);
+      FARAABIN_DataBus_AdvFeat_SetBufferChannelsStatically_(databus, DbTestChannelBuffer[i / 8U]);
+      FARAABIN_DataBus_AdvFeat_SetBufferCaptureStatically_(databus, DbTestCaptureBuffer[i / 8U]);
+      FARAABIN_DataBus_Init_WithPath_(databus, "DatabaseTest\\Databuses");
+    }
+
+    if(i == 12U) {
+      FARAABIN_DictGroup_Init_(&DbTestDg);
+    }
+  }
+}
+
+/**
+ * @brief Teardown that executes after all tests (or in case of a test failure).
+ *
+ */
+static void OneTimeTeardown(void) {
+
+}
+
+/**
+ * @brief DictGroup function
+ *
+ */
+FARAABIN_DICT_GROUP_FUNC_(DbTestDg) {
+
+  FARAABIN_DICT_GROUP_FUNC_END_;
+}
+
+/************************ © COPYRIGHT FaraabinCo *****END OF FILE****/
@@ -24,8 +24,18 @@
 
 #include "unity_fixture.h"
 #include "faraabin.h"
+#include "faraabin_link_buffer.h"
+
+#include <math.h>
 
 /* Private define ------------------------------------------------------------*/
+#define BENCH_CAPTURE_SIZE  (16U)   /*!< Power of two capture size for the capture read benchmark. */
+#define BENCH_PASS_QTY      (100U)  /*!< Number of full reads of the capture buffer in the benchmark. */
+#define AGG_STREAM_DIVBY    (4U)    /*!< Stream prescaler of the aggregate test databus, i.e. length of its aggregate window. */
+#define BLOCK_FIFO_SIZE     (8U)    /*!< Capacity of the block FIFO in the block sending test. */
+#define REPORT_KEEPALIVE    (4U)    /*!< Keepalive prescaler of the report by exception test databus. */
+#define SLICE_TX_SIZE       (56U)   /*!< Size of the small TX buffer that slice size limit is tested with. */
+
 /* Private macro -------------------------------------------------------------*/
 /* Private typedef -----------------------------------------------------------*/
 /**
@@ -58,7 +68,31 @@ FARAABIN_DATABUS_DEF_EXTERN_(DynamicDatabus);
 static sFaraabinFobjectDataBus_Channel StaticChannelBuffer[10];
 static sFaraabinFobjectDataBus_CaptureValue StaticCaptureBuffer[10];
 
+FARAABIN_DATABUS_DEF_STATIC_(BenchDatabus);
+static sFaraabinFobjectDataBus_Channel BenchChannelBuffer[1];
+static sFaraabinFobjectDataBus_CaptureValue BenchCaptureBuffer[BENCH_CAPTURE_SIZE];
+static uint32_t BenchVar;
+
+FARAABIN_DATABUS_DEF_STATIC_(AggDatabus);
+static sFaraabinFobjectDataBus_Channel AggChannelBuffer[2];
+static sFaraabinFobjectDataBus_CaptureValue AggCaptureBuffer[1];
+static int16_t AggVar;
+static uint8_t AggArray[2];
+
+FARAABIN_DATABUS_DEF_STATIC_(BlockDatabus);
+static sFaraabinFobjectDataBus_Channel BlockChannelBuffer[1];
+static sFaraabinFobjectDataBus_CaptureValue BlockCaptureBuffer[1];
+static uint16_t BlockVar;
+static uint16_t BlockFifo[BLOCK_FIFO_SIZE];
+
+FARAABIN_DATABUS_DEF_STATIC_(ReportDatabus);
+static sFaraabinFobjectDataBus_Channel ReportChannelBuffer[1];
+static sFaraabinFobjectDataBus_CaptureValue ReportCaptureBuffer[1];
+static float32_t ReportVar;
+
 static uint8_t TestVar[8];
+static uint8_t SliceTxBuffer[SLICE_TX_SIZE];
+static float32_t TestBlockFifo[16];
 static eTypeTest TestEnum[2];
 static sTypeTest TestStruct[2];
 static CPU_PROFILER_CODEBLOCK_DEF_(TestCodeBlock);
@@ -69,6 +103,7 @@ static void OneTimeSetup(void);
 static void OneTimeTeardown(void);
 
 static void UserTerminalCallback(uint8_t *userData, uint16_t userDataSize);
+static bool RunReportDatabus(float32_t value);
 
 /* Variables -----------------------------------------------------------------*/
 
@@ -107,6 +142,12 @@ int FaraabinFobjectDataBusTest_Run(int argc, const char* argv[]) {
 TEST_GROUP_RUNNER(DatabusTest) {
   
   RUN_TEST_CASE(DatabusTest, TemplateTest);
+  RUN_TEST_CASE(DatabusTest, CaptureCursorReadCost);
+  RUN_TEST_CASE(DatabusTest, AggregateWindowValues);
+  RUN_TEST_CASE(DatabusTest, BlockSendOneFramePerCall);
+  RUN_TEST_CASE(DatabusTest, SlicePackedSizeLimit);
+  RUN_TEST_CASE(DatabusTest, ReportDeadbandAndKeepalive);
+  RUN_TEST_CASE(DatabusTest, DictHashIgnoresRuntimeState);
   
 }
 
@@ -178,6 +219,13 @@ static void OneTimeSetup(void) {
   FARAABIN_DataBus_AttachVariable_UserDefined_Struct_(&StaticDatabus, &TestStruct[0]);
   FARAABIN_DataBus_AttachVariable_UserDefined_Struct_ARRAY_(&StaticDatabus, TestStruct);
   FARAABIN_DataBus_AttachCodeBlock_(&StaticDatabus, &TestCodeBlock);
+  FARAABIN_DataBus_AttachVariableSlice_(&StaticDatabus, &TestVar[1], 2, 4, eVAR_DATA_TYPE_PRIMITIVE_UINT8);
+  FARAABIN_DataBus_DetachAllChannels_(&StaticDatabus);
+  FARAABIN_DataBus_AttachVariable_F32_(&StaticDatabus, (float32_t*)&TestVar[0]);
+  FARAABIN_DataBus_SetChannelAggregate_(&StaticDatabus, 0, eDATABUS_CH_AGGREGATE_ENVELOPE_RMS);
+  FARAABIN_DataBus_SetChannelBlockFifo_(&StaticDatabus, 0, TestBlockFifo);
+  FARAABIN_DataBus_PushBlockSample_(&StaticDatabus, 0);
+  FARAABIN_DataBus_SetChannelReport_(&StaticDatabus, 0, eDATABUS_CH_REPORT_DEADBAND_ABS, 0.1);
   FARAABIN_DataBus_DetachAllChannels_(&StaticDatabus);
   FARAABIN_DataBus_Run_(&StaticDatabus);
 
@@ -197,6 +245,8 @@ static void OneTimeTeardown(void) {
  */
 TEST_TEAR_DOWN(DatabusTest) {
 
+  // Tests that change TX buffer leave it to be restored here, even if they fail.
+  fFaraabinLinkBuffer_Init(fFaraabin_GetTxBufferPointer(), fFaraabin_GetTxBufferSize());
 }
 
 /**
@@ -208,6 +258,294 @@ TEST(DatabusTest, TemplateTest) {
   TEST_ASSERT(true);
 }
 
+/**
+ * @brief Capture cursor must read the same items as indexed read, oldest first. Per item cost of both readers is printed.
+ * 
+ */
+TEST(DatabusTest, CaptureCursorReadCost) {
+  
+  FARAABIN_DATABUS_SET_VALUE_(BenchDatabus.ChannelQty, 1);
+  FARAABIN_DATABUS_SET_VALUE_(BenchDatabus.BufferCaptureSize, BENCH_CAPTURE_SIZE);
+  FARAABIN_DATABUS_SET_VALUE_(BenchDatabus.TimerWindowMs, 100000);
+  FARAABIN_DataBus_AdvFeat_SetBufferChannelsStatically_(&BenchDatabus, BenchChannelBuffer);
+  FARAABIN_DataBus_AdvFeat_SetBufferCaptureStatically_(&BenchDatabus, BenchCaptureBuffer);
+  FARAABIN_DataBus_Init_WithPath_(&BenchDatabus, "DatabusTest\\Bench");
+  FARAABIN_DataBus_Enable_(&BenchDatabus);
+  FARAABIN_DataBus_AttachVariable_U32_(&BenchDatabus, &BenchVar);
+  
+  // Overfill the capture queue so that it wraps around.
+  fFaraabinFobjectDataBus_StartTimer(&BenchDatabus);
+  for(uint32_t i = 0U; i < (2U * BENCH_CAPTURE_SIZE) + 1U; i++) {
+    BenchVar = i;
+    FARAABIN_DataBus_Run_(&BenchDatabus);
+  }
+  FARAABIN_DataBus_Stop_(&BenchDatabus);
+  
+  uint32_t qty = fFaraabinFobjectDataBus_GetCaptureDataQty(&BenchDatabus);
+  TEST_ASSERT_EQUAL_UINT32(BENCH_CAPTURE_SIZE, qty);
+  
+  sFaraabinFobjectDataBus_CaptureCursor cursor;
+  sFaraabinFobjectDataBus_CaptureValue byCursor;
+  sFaraabinFobjectDataBus_CaptureValue byIndex;
+  
+  TEST_ASSERT_EQUAL_UINT8(FARAABIN_DB_OK, fFaraabinFobjectDataBus_CaptureCursorBegin(&BenchDatabus, &cursor));
+  for(uint32_t i = 0U; i < qty; i++) {
+    
+    TEST_ASSERT_EQUAL_UINT8(FARAABIN_DB_OK, fFaraabinFobjectDataBus_CaptureCursorNext(&BenchDatabus, &cursor, &byCursor));
+    TEST_ASSERT_EQUAL_UINT8(FARAABIN_DB_OK, fFaraabinFobjectDataBus_GetCaptureData(&BenchDatabus, i, &byIndex));
+    TEST_ASSERT_EQUAL_UINT32(byIndex.CapturedTimeStamp, byCursor.CapturedTimeStamp);
+    TEST_ASSERT_EQUAL_UINT64(byIndex.CapturedValue, byCursor.CapturedValue);
+  }
+  TEST_ASSERT_EQUAL_UINT8(FARAABIN_DB_QUEUE_EMPTY, fFaraabinFobjectDataBus_CaptureCursorNext(&BenchDatabus, &cursor, &byCursor));
+  
+  // Per item cost of indexed read.
+  tick_t start = fChrono_GetTick();
+  for(uint32_t j = 0U; j < BENCH_PASS_QTY; j++) {
+    for(uint32_t i = 0U; i < qty; i++) {
+      fFaraabinFobjectDataBus_GetCaptureData(&BenchDatabus, i, &byIndex);
+    }
+  }
+  tick_t indexTicks = fChrono_TimeSpanTick(start, fChrono_GetTick());
+  
+  // Per item cost of cursor read.
+  start = fChrono_GetTick();
+  for(uint32_t j = 0U; j < BENCH_PASS_QTY; j++) {
+    fFaraabinFobjectDataBus_CaptureCursorBegin(&BenchDatabus, &cursor);
+    while(fFaraabinFobjectDataBus_CaptureCursorNext(&BenchDatabus, &cursor, &byCursor) == FARAABIN_DB_OK) {
+    }
+  }
+  tick_t cursorTicks = fChrono_TimeSpanTick(start, fChrono_GetTick());
+  
+  UnityPrint("Capture read ticks/item (x1000): index=");
+  UnityPrintNumberUnsigned(((uint64_t)indexTicks * 1000U) / (BENCH_PASS_QTY * qty));
+  UnityPrint(" cursor=");
+  UnityPrintNumberUnsigned(((uint64_t)cursorTicks * 1000U) / (BENCH_PASS_QTY * qty));
+  UNITY_PRINT_EOL();
+}
+
+/**
+ * @brief Min/max/mean/RMS of an aggregated channel must cover exactly one StreamDivideBy window and start over in the next one.
+ * 
+ */
+TEST(DatabusTest, AggregateWindowValues) {
+  
+  FARAABIN_DATABUS_SET_VALUE_(AggDatabus.ChannelQty, 2);
+  FARAABIN_DATABUS_SET_VALUE_(AggDatabus.BufferCaptureSize, 1);
+  FARAABIN_DATABUS_SET_VALUE_(AggDatabus.StreamDivideBy, AGG_STREAM_DIVBY);
+  FARAABIN_DataBus_AdvFeat_SetBufferChannelsStatically_(&AggDatabus, AggChannelBuffer);
+  FARAABIN_DataBus_AdvFeat_SetBufferCaptureStatically_(&AggDatabus, AggCaptureBuffer);
+  FARAABIN_DataBus_Init_WithPath_(&AggDatabus, "DatabusTest\\Agg");
+  FARAABIN_DataBus_Enable_(&AggDatabus);
+  FARAABIN_DataBus_AttachVariable_I16_(&AggDatabus, &AggVar);
+  FARAABIN_DataBus_AttachVariable_U8_ARRAY_(&AggDatabus, AggArray);
+  
+  // Only single primitive numerical items can be aggregated.
+  TEST_ASSERT_EQUAL_UINT8(FARAABIN_DB_CHANNEL_NOT_AGGREGATABLE, fFaraabinFobjectDataBus_SetChannelAggregate(&AggDatabus, 1, eDATABUS_CH_AGGREGATE_ENVELOPE));
+  
+  // Modes out of the enum (e.g. from a malformed host request) are rejected.
+  TEST_ASSERT_EQUAL_UINT8(FARAABIN_DB_PARAM_ERROR, fFaraabinFobjectDataBus_SetChannelAggregate(&AggDatabus, 0, (eFaraabinFobjectDataBus_ChAggregate)(eDATABUS_CH_AGGREGATE_ENVELOPE_RMS + 1)));
+  TEST_ASSERT_EQUAL_UINT8(FARAABIN_DB_PARAM_ERROR, fFaraabinFobjectDataBus_SetChannelAggregate(&AggDatabus, 0, (eFaraabinFobjectDataBus_ChAggregate)0xFF));
+  TEST_ASSERT_EQUAL_UINT8((uint8_t)eDATABUS_CH_AGGREGATE_NONE, AggChannelBuffer[0].AggregateMode);
+  TEST_ASSERT_EQUAL_UINT16(0U, AggDatabus._aggregatedItemsQty);
+  TEST_ASSERT_EQUAL_UINT8(FARAABIN_DB_OK, fFaraabinFobjectDataBus_SetChannelAggregate(&AggDatabus, 0, eDATABUS_CH_AGGREGATE_ENVELOPE_RMS));
+  
+  sFaraabinFobjectDataBus_ChAggregateValue *agg = &AggChannelBuffer[0]._aggregate;
+  FARAABIN_DataBus_StartStreamMode_(&AggDatabus);
+  
+  // First window: -1, 5, -1 -> min -1, max 5, mean 1, rms 3.
+  const int16_t window1[AGG_STREAM_DIVBY - 1U] = {-1, 5, -1};
+  for(uint8_t i = 0U; i < (AGG_STREAM_DIVBY - 1U); i++) {
+    AggVar = window1[i];
+    FARAABIN_DataBus_Run_(&AggDatabus);
+  }
+  
+  TEST_ASSERT_EQUAL_UINT16(AGG_STREAM_DIVBY - 1U, agg->Cnt);
+  TEST_ASSERT_EQUAL_FLOAT(-1.0, agg->Min);
+  TEST_ASSERT_EQUAL_FLOAT(5.0, agg->Max);
+  TEST_ASSERT_EQUAL_FLOAT(1.0, agg->Sum / (float64_t)agg->Cnt);
+  TEST_ASSERT_EQUAL_FLOAT(3.0, sqrt(agg->SumSq / (float64_t)agg->Cnt));
+  
+  // The last sample of the window is accumulated and sent, then the window starts over.
+  AggVar = 1;
+  FARAABIN_DataBus_Run_(&AggDatabus);
+  TEST_ASSERT_EQUAL_UINT16(0U, agg->Cnt);
+  
+  // Second window must not carry the extremes of the first one.
+  AggVar = 7;
+  for(uint8_t i = 0U; i < (AGG_STREAM_DIVBY - 1U); i++) {
+    FARAABIN_DataBus_Run_(&AggDatabus);
+  }
+  
+  TEST_ASSERT_EQUAL_UINT16(AGG_STREAM_DIVBY - 1U, agg->Cnt);
+  TEST_ASSERT_EQUAL_FLOAT(7.0, agg->Min);
+  TEST_ASSERT_EQUAL_FLOAT(7.0, agg->Max);
+  TEST_ASSERT_EQUAL_FLOAT(7.0, agg->Sum / (float64_t)agg->Cnt);
+  TEST_ASSERT_EQUAL_FLOAT(7.0, sqrt(agg->SumSq / (float64_t)agg->Cnt));
+  
+  // Close the second window. Envelope mode does not accumulate squares.
+  FARAABIN_DataBus_Run_(&AggDatabus);
+  TEST_ASSERT_EQUAL_UINT8(FARAABIN_DB_OK, fFaraabinFobjectDataBus_SetChannelAggregate(&AggDatabus, 0, eDATABUS_CH_AGGREGATE_ENVELOPE));
+  FARAABIN_DataBus_Run_(&AggDatabus);
+  TEST_ASSERT_EQUAL_UINT16(1U, agg->Cnt);
+  TEST_ASSERT_EQUAL_FLOAT(0.0, agg->SumSq);
+  
+  FARAABIN_DataBus_Stop_(&AggDatabus);
+}
+
+/**
+ * @brief Each call of block sending must drain at most one block per channel, without waiting for the link.
+ * 
+ */
+TEST(DatabusTest, BlockSendOneFramePerCall) {
+  
+  FARAABIN_DATABUS_SET_VALUE_(BlockDatabus.ChannelQty, 1);
+  FARAABIN_DATABUS_SET_VALUE_(BlockDatabus.BufferCaptureSize, 1);
+  FARAABIN_DataBus_AdvFeat_SetBufferChannelsStatically_(&BlockDatabus, BlockChannelBuffer);
+  FARAABIN_DataBus_AdvFeat_SetBufferCaptureStatically_(&BlockDatabus, BlockCaptureBuffer);
+  FARAABIN_DataBus_Init_WithPath_(&BlockDatabus, "DatabusTest\\Block");
+  FARAABIN_DataBus_Enable_(&BlockDatabus);
+  FARAABIN_DataBus_AttachVariable_U16_(&BlockDatabus, &BlockVar);
+  TEST_ASSERT_EQUAL_UINT8(FARAABIN_DB_OK, FARAABIN_DataBus_SetChannelBlockFifo_(&BlockDatabus, 0, BlockFifo));
+  FARAABIN_DataBus_StartStreamMode_(&BlockDatabus);
+  
+  sFaraabinFobjectDataBus_ChBlockFifo *fifo = &BlockChannelBuffer[0]._blockFifo;
+  
+  // Fill the FIFO with two blocks and one more sample that must be dropped.
+  for(uint16_t i = 0U; i <= BLOCK_FIFO_SIZE; i++) {
+    BlockVar = i;
+    FARAABIN_DataBus_PushBlockSample_(&BlockDatabus, 0);
+  }
+  TEST_ASSERT_EQUAL_UINT32(1U, fifo->OverflowCnt);
+  TEST_ASSERT_EQUAL_UINT16(BLOCK_FIFO_SIZE - 1U, BlockFifo[BLOCK_FIFO_SIZE - 1U]);
+  
+  fFaraabinLinkHandler_FlushBuffer();
+  
+  fFaraabinFobjectDataBus_SendCaptureDataRun(&BlockDatabus);
+  TEST_ASSERT_EQUAL_UINT16(BLOCK_FIFO_SIZE / 2U, (uint16_t)(fifo->_head - fifo->_tail));
+  
+  fFaraabinFobjectDataBus_SendCaptureDataRun(&BlockDatabus);
+  TEST_ASSERT_EQUAL_UINT16(0U, (uint16_t)(fifo->_head - fifo->_tail));
+  
+  FARAABIN_DataBus_Stop_(&BlockDatabus);
+}
+
+/**
+ * @brief Slices whose packed vector doesn't fit the 16-bit size of the stream frame, or whose stream frame
+ *        doesn't fit TX buffer, must be rejected.
+ * 
+ */
+TEST(DatabusTest, SlicePackedSizeLimit) {
+  
+  uint64_t *first = (uint64_t*)TestVar;
+  
+  TEST_ASSERT_EQUAL_UINT8(FARAABIN_DB_SLICE_ERROR, FARAABIN_DataBus_AttachVariableSlice_(&StaticDatabus, first, sizeof(uint64_t), 8192U, eVAR_DATA_TYPE_PRIMITIVE_UINT64));
+  TEST_ASSERT_EQUAL_UINT16(0U, StaticDatabus.AttachedItemsQty);
+  
+  // Worst case frame of a slice of 2 bytes fits this buffer, but the one of 8 bytes doesn't.
+  fFaraabinLinkBuffer_Init(SliceTxBuffer, SLICE_TX_SIZE);
+  
+  TEST_ASSERT_EQUAL_UINT8(FARAABIN_DB_SLICE_ERROR, FARAABIN_DataBus_AttachVariableSlice_(&StaticDatabus, TestVar, sizeof(uint8_t), 8U, eVAR_DATA_TYPE_PRIMITIVE_UINT8));
+  TEST_ASSERT_EQUAL_UINT16(0U, StaticDatabus.AttachedItemsQty);
+  
+  TEST_ASSERT_EQUAL_UINT8(FARAABIN_DB_OK, FARAABIN_DataBus_AttachVariableSlice_(&StaticDatabus, TestVar, 4U * sizeof(uint8_t), 2U, eVAR_DATA_TYPE_PRIMITIVE_UINT8));
+  TEST_ASSERT_EQUAL_UINT16(2U, StaticChannelBuffer[0].SliceQty);
+  
+  FARAABIN_DataBus_DetachAllChannels_(&StaticDatabus);
+}
+
+/**
+ * @brief Deadband channel must be sent only when it moves out of the band around its last reported value, or on keepalive.
+ * 
+ */
+TEST(DatabusTest, ReportDeadbandAndKeepalive) {
+  
+  FARAABIN_DATABUS_SET_VALUE_(ReportDatabus.ChannelQty, 1);
+  FARAABIN_DATABUS_SET_VALUE_(ReportDatabus.BufferCaptureSize, 1);
+  FARAABIN_DATABUS_SET_VALUE_(ReportDatabus.StreamDivideBy, 1);
+  FARAABIN_DATABUS_SET_VALUE_(ReportDatabus.KeepaliveDivideBy, REPORT_KEEPALIVE);
+  FARAABIN_DataBus_AdvFeat_SetBufferChannelsStatically_(&ReportDatabus, ReportChannelBuffer);
+  FARAABIN_DataBus_AdvFeat_SetBufferCaptureStatically_(&ReportDatabus, ReportCaptureBuffer);
+  FARAABIN_DataBus_Init_WithPath_(&ReportDatabus, "DatabusTest\\Report");
+  FARAABIN_DataBus_Enable_(&ReportDatabus);
+  FARAABIN_DataBus_AttachVariable_F32_(&ReportDatabus, &ReportVar);
+  
+  // Out of range modes and negative or NaN deadbands are rejected without touching the channel.
+  TEST_ASSERT_EQUAL_UINT8(FARAABIN_DB_PARAM_ERROR, FARAABIN_DataBus_SetChannelReport_(&ReportDatabus, 0, (eFaraabinFobjectDataBus_ChReport)(eDATABUS_CH_REPORT_DEADBAND_REL + 1), 0.5));
+  TEST_ASSERT_EQUAL_UINT8(FARAABIN_DB_PARAM_ERROR, FARAABIN_DataBus_SetChannelReport_(&ReportDatabus, 0, eDATABUS_CH_REPORT_DEADBAND_ABS, -0.5));
+  TEST_ASSERT_EQUAL_UINT8(FARAABIN_DB_PARAM_ERROR, FARAABIN_DataBus_SetChannelReport_(&ReportDatabus, 0, eDATABUS_CH_REPORT_DEADBAND_ABS, (float64_t)NAN));
+  TEST_ASSERT_EQUAL_UINT8(FARAABIN_DB_PARAM_ERROR, FARAABIN_DataBus_SetChannelReport_(&ReportDatabus, 0, eDATABUS_CH_REPORT_DEADBAND_REL, (float64_t)NAN));
+  TEST_ASSERT_EQUAL_UINT8((uint8_t)eDATABUS_CH_REPORT_ALWAYS, ReportChannelBuffer[0].ReportMode);
+  TEST_ASSERT_EQUAL_UINT16(0U, ReportDatabus._reportItemsQty);
+  
+  TEST_ASSERT_EQUAL_UINT8(FARAABIN_DB_OK, FARAABIN_DataBus_SetChannelReport_(&ReportDatabus, 0, eDATABUS_CH_REPORT_DEADBAND_ABS, 0.5));
+  FARAABIN_DataBus_StartStreamMode_(&ReportDatabus);
+  
+  // First frame after start reports everything.
+  TEST_ASSERT_TRUE(RunReportDatabus(10.0f));
+  
+  // Inside the band around 10.0 in both directions.
+  TEST_ASSERT_FALSE(RunReportDatabus(10.3f));
+  TEST_ASSERT_FALSE(RunReportDatabus(9.8f));
+  
+  // Beyond the band. 10.6 becomes the new reference.
+  TEST_ASSERT_TRUE(RunReportDatabus(10.6f));
+  
+  // Every REPORT_KEEPALIVE'th stream frame since the first one is sent even if the channel is unchanged.
+  for(uint8_t k = 0U; k < 2U; k++) {
+    
+    TEST_ASSERT_TRUE(RunReportDatabus(10.6f));
+    for(uint8_t i = 1U; i < REPORT_KEEPALIVE; i++) {
+      TEST_ASSERT_FALSE(RunReportDatabus(10.6f));
+    }
+  }
+  
+  // Changes between keepalives are reported and don't shift the keepalive frames.
+  TEST_ASSERT_TRUE(RunReportDatabus(10.6f));
+  TEST_ASSERT_TRUE(RunReportDatabus(9.0f));
+  for(uint8_t i = 2U; i < REPORT_KEEPALIVE; i++) {
+    TEST_ASSERT_FALSE(RunReportDatabus(9.4f));
+  }
+  TEST_ASSERT_TRUE(RunReportDatabus(9.4f));
+  
+  FARAABIN_DataBus_Stop_(&ReportDatabus);
+}
+
+/**
+ * @brief Dictionary hash must not change when the run time state of a databus changes.
+ * 
+ */
+TEST(DatabusTest, DictHashIgnoresRuntimeState) {
+  
+  uint32_t hash = fFaraabinLinkSerializer_GetDictHash();
+  
+  FARAABIN_DataBus_Enable_(&StaticDatabus);
+  FARAABIN_DataBus_AttachVariable_U8_(&StaticDatabus, (uint8_t*)&TestVar[0]);
+  FARAABIN_DataBus_StartStreamMode_(&StaticDatabus);
+  
+  TEST_ASSERT_EQUAL_UINT32(hash, fFaraabinLinkSerializer_GetDictHash());
+  
+  FARAABIN_DataBus_Stop_(&StaticDatabus);
+  FARAABIN_DataBus_DetachAllChannels_(&StaticDatabus);
+  FARAABIN_DataBus_Disable_(&StaticDatabus);
+}
+
+/**
+ * @brief Runs the report test databus for one stream frame.
+ * 
+ * @param value Value of the channel in this frame.
+ * @return result 'true' if a stream frame with the channel is sent.
+ */
+static bool RunReportDatabus(float32_t value) {
+  
+  ReportVar = value;
+  
+  uint32_t framesCnt = fFaraabinFobjectMcu_GetFobject()->StatisticsTxFramesCnt;
+  FARAABIN_DataBus_Run_(&ReportDatabus);
+  bool isSent = (fFaraabinFobjectMcu_GetFobject()->StatisticsTxFramesCnt != framesCnt);
+  
+  return (isSent && ReportChannelBuffer[0]._isReportDue);
+}
+
 /**
  * @brief 
  * 
@@ -27,19 +27,41 @@
 #include "faraabin.h"
 
 /* Private define ------------------------------------------------------------*/
+#define ENGINE_LOG_SIZE  (16U)
+#define POOL_OBJ_QTY     (4U)
+
 /* Private macro -------------------------------------------------------------*/
+/**
+ * @brief Smallest argument size that takes the given number of blocks from the argument pool.
+ * 
+ */
+#define ARG_SIZE_OF_BLOCKS_(blockQty_)  (uint16_t)(((blockQty_) - 1U) * FB_FUNCTION_ARG_POOL_BLOCK_SIZE)
+
 /* Private typedef -----------------------------------------------------------*/
+FARAABIN_FUNCTION_GROUP_TYPE_DEF_(uint32_t);
+
 /* Private variables ---------------------------------------------------------*/
 TEST_GROUP(FunctionTest);
 
 FARAABIN_DICT_GROUP_DEF_STATIC_(TestFunctionDg);
+FARAABIN_FUNCTION_GROUP_PROTOTYPE_(EngineTestFn);
 
 static float TestVar;
 
+static char EngineLog[ENGINE_LOG_SIZE + 1U];
+static uint8_t EngineLogQty;
+static uint32_t ObjA;
+static uint32_t ObjB;
+static uint32_t PoolObj[POOL_OBJ_QTY];
+static uint8_t ArgBuffer[FB_FUNCTION_PARAM_BUFFER_SIZE];
+
 /* Private function prototypes -----------------------------------------------*/
 static void RunTests(void);
 static void OneTimeSetup(void);
 static void OneTimeTeardown(void);
+static void EngineLogAdd(char c);
+static void RunEngine(uint16_t passQty);
+static uint8_t RunningObjects(uint32_t *objects, uint8_t *handles);
 
 /* Variables -----------------------------------------------------------------*/
 
@@ -73,6 +95,75 @@ int FaraabinFobjectFunctionTest_Run(int argc, const char* argv[]) {
 ╚══════════════════════════════════════════════════════════════════════════════════╝
 */
 
+/**
+ * @brief Logs 'A' and decrements the object until it reaches zero.
+ * 
+ */
+FARAABIN_FUNCTION_(EngineTestFn, RR_A, "help") {
+  
+  EngineLogAdd('A');
+  (*me)--;
+  if(*me > 0U) {
+    return FUNCTION_CONTINUE;
+  }
+  
+  FARAABIN_FUNCTION_END_();
+}
+
+/**
+ * @brief Logs 'B' and decrements the object until it reaches zero.
+ * 
+ */
+FARAABIN_FUNCTION_(EngineTestFn, RR_B, "help") {
+  
+  EngineLogAdd('B');
+  (*me)--;
+  if(*me > 0U) {
+    return FUNCTION_CONTINUE;
+  }
+  
+  FARAABIN_FUNCTION_END_();
+}
+
+/**
+ * @brief Logs 'S' and keeps the CPU for the whole pass budget in each slice.
+ * 
+ */
+FARAABIN_FUNCTION_(EngineTestFn, BUSY, "help") {
+  
+  EngineLogAdd('S');
+  tick_t startTick = fChrono_GetTick();
+  while(fChrono_TimeSpanUs(startTick, fChrono_GetTick()) < FB_FUNCTION_ENGINE_PASS_BUDGET_US) {
+  }
+  (*me)--;
+  if(*me > 0U) {
+    return FUNCTION_CONTINUE;
+  }
+  
+  FARAABIN_FUNCTION_END_();
+}
+
+/**
+ * @brief Coroutine that adds 1, 10 and 100 to the object in three slices.
+ * 
+ */
+FARAABIN_FUNCTION_(EngineTestFn, STEPS, "help") {
+  
+  FARAABIN_Function_CoroutineBegin_();
+  
+  *me += 1U;
+  FARAABIN_Function_Yield_();
+  
+  *me += 10U;
+  FARAABIN_Function_Yield_();
+  
+  *me += 100U;
+  
+  FARAABIN_Function_CoroutineEnd_();
+  
+  FARAABIN_FUNCTION_END_();
+}
+
 /**
  * @brief Test group runner.
  * 
@@ -80,6 +171,13 @@ int FaraabinFobjectFunctionTest_Run(int argc, const char* argv[]) {
 TEST_GROUP_RUNNER(FunctionTest) {
   
   RUN_TEST_CASE(FunctionTest, TemplateTest);
+  RUN_TEST_CASE(FunctionTest, EngineRoundRobinOrder);
+  RUN_TEST_CASE(FunctionTest, EnginePassBudget);
+  RUN_TEST_CASE(FunctionTest, CoroutineOnTwoObjects);
+  RUN_TEST_CASE(FunctionTest, ArgTooLarge);
+  RUN_TEST_CASE(FunctionTest, ArgPoolUsage);
+  RUN_TEST_CASE(FunctionTest, ArgPoolExhausted);
+  RUN_TEST_CASE(FunctionTest, HandleLookup);
   
 }
 
@@ -97,6 +195,13 @@ static void RunTests(void) {
  */
 TEST_SETUP(FunctionTest) {
 
+  EngineLogQty = 0U;
+  EngineLog[0] = '\0';
+  ObjA = 0U;
+  ObjB = 0U;
+  for(uint16_t i = 0; i < POOL_OBJ_QTY; i++) {
+    PoolObj[i] = 1U;
+  }
 }
 
 /**
@@ -116,6 +221,241 @@ TEST(FunctionTest, TemplateTest) {
   TEST_ASSERT(true);
 }
 
+/**
+ * @brief Running functions are served in start order and each one gets (Priority + 1) slices in each pass.
+ * 
+ */
+TEST(FunctionTest, EngineRoundRobinOrder) {
+  
+  uint8_t handle;
+  uint8_t arg = 0U;
+  
+  ObjA = 2U;
+  ObjB = 4U;
+  EngineTestFn_RR_A_obj.Priority = 0U;
+  EngineTestFn_RR_B_obj.Priority = 1U;
+  
+  TEST_ASSERT_EQUAL_UINT8(FB_FENGINE_FUNCTION_CMD_OK, fFaraabinFunctionEngine_Start((uint32_t)&EngineTestFn_RR_A_obj, (uint32_t)&ObjA, &arg, 0U, &handle));
+  TEST_ASSERT_EQUAL_UINT8(FB_FENGINE_FUNCTION_CMD_OK, fFaraabinFunctionEngine_Start((uint32_t)&EngineTestFn_RR_B_obj, (uint32_t)&ObjB, &arg, 0U, &handle));
+  
+  RunEngine(1U);
+  TEST_ASSERT_EQUAL_STRING("ABB", EngineLog);
+  
+  RunEngine(1U);
+  TEST_ASSERT_EQUAL_STRING("ABBABB", EngineLog);
+  TEST_ASSERT_EQUAL_UINT16(0U, fFaraabinFunctionEngine_GetQtyOfRunningFunctions());
+  
+  EngineTestFn_RR_B_obj.Priority = 0U;
+}
+
+/**
+ * @brief A pass stops when its time budget is consumed and the next pass starts from the function that was not served.
+ * 
+ */
+TEST(FunctionTest, EnginePassBudget) {
+  
+  uint8_t handle;
+  uint8_t arg = 0U;
+  
+  ObjA = 2U;
+  ObjB = 2U;
+  
+  TEST_ASSERT_EQUAL_UINT8(FB_FENGINE_FUNCTION_CMD_OK, fFaraabinFunctionEngine_Start((uint32_t)&EngineTestFn_BUSY_obj, (uint32_t)&ObjB, &arg, 0U, &handle));
+  TEST_ASSERT_EQUAL_UINT8(FB_FENGINE_FUNCTION_CMD_OK, fFaraabinFunctionEngine_Start((uint32_t)&EngineTestFn_RR_A_obj, (uint32_t)&ObjA, &arg, 0U, &handle));
+  
+  RunEngine(1U);
+  TEST_ASSERT_EQUAL_STRING("S", EngineLog);
+  
+  RunEngine(1U);
+  TEST_ASSERT_EQUAL_STRING("SAS", EngineLog);
+  
+  RunEngine(1U);
+  TEST_ASSERT_EQUAL_STRING("SASA", EngineLog);
+  TEST_ASSERT_EQUAL_UINT16(0U, fFaraabinFunctionEngine_GetQtyOfRunningFunctions());
+}
+
+/**
+ * @brief Resume point of a coroutine is kept per execution, so it can run on two objects at the same time.
+ * 
+ */
+TEST(FunctionTest, CoroutineOnTwoObjects) {
+  
+  uint8_t handle;
+  uint8_t arg = 0U;
+  
+  TEST_ASSERT_EQUAL_UINT8(FB_FENGINE_FUNCTION_CMD_OK, fFaraabinFunctionEngine_Start((uint32_t)&EngineTestFn_STEPS_obj, (uint32_t)&ObjA, &arg, 0U, &handle));
+  RunEngine(1U);
+  TEST_ASSERT_EQUAL_UINT32(1U, ObjA);
+  
+  TEST_ASSERT_EQUAL_UINT8(FB_FENGINE_FUNCTION_CMD_OK, fFaraabinFunctionEngine_Start((uint32_t)&EngineTestFn_STEPS_obj, (uint32_t)&ObjB, &arg, 0U, &handle));
+  RunEngine(1U);
+  TEST_ASSERT_EQUAL_UINT32(11U, ObjA);
+  TEST_ASSERT_EQUAL_UINT32(1U, ObjB);
+  
+  RunEngine(2U);
+  TEST_ASSERT_EQUAL_UINT32(111U, ObjA);
+  TEST_ASSERT_EQUAL_UINT32(111U, ObjB);
+  TEST_ASSERT_EQUAL_UINT16(0U, fFaraabinFunctionEngine_GetQtyOfRunningFunctions());
+}
+
+/**
+ * @brief Arguments that don't fit the function parameter buffer with their terminator are rejected without allocation.
+ * 
+ */
+TEST(FunctionTest, ArgTooLarge) {
+  
+  uint8_t handle;
+  uint16_t used;
+  uint16_t highWater;
+  
+  TEST_ASSERT_EQUAL_UINT8(FB_FENGINE_ARG_TOO_LARGE, fFaraabinFunctionEngine_Start((uint32_t)&EngineTestFn_RR_A_obj, (uint32_t)&PoolObj[0], ArgBuffer, FB_FUNCTION_PARAM_BUFFER_SIZE, &handle));
+  TEST_ASSERT_EQUAL_UINT16(0U, fFaraabinFunctionEngine_GetQtyOfRunningFunctions());
+  fFaraabinFunctionEngine_GetArgPoolUsage(&used, &highWater);
+  TEST_ASSERT_EQUAL_UINT16(0U, used);
+  
+  TEST_ASSERT_EQUAL_UINT8(FB_FENGINE_FUNCTION_CMD_OK, fFaraabinFunctionEngine_Start((uint32_t)&EngineTestFn_RR_A_obj, (uint32_t)&PoolObj[0], ArgBuffer, FB_FUNCTION_PARAM_BUFFER_SIZE - 1U, &handle));
+  fFaraabinFunctionEngine_GetArgPoolUsage(&used, &highWater);
+  TEST_ASSERT_EQUAL_UINT16((FB_FUNCTION_PARAM_BUFFER_SIZE + FB_FUNCTION_ARG_POOL_BLOCK_SIZE - 1U) / FB_FUNCTION_ARG_POOL_BLOCK_SIZE, used);
+  
+  TEST_ASSERT_EQUAL_UINT8(FB_FENGINE_FUNCTION_CMD_OK, fFaraabinFunctionEngine_Stop((uint32_t)&EngineTestFn_RR_A_obj, (uint32_t)&PoolObj[0], handle));
+  fFaraabinFunctionEngine_GetArgPoolUsage(&used, &highWater);
+  TEST_ASSERT_EQUAL_UINT16(0U, used);
+}
+
+/**
+ * @brief Pool usage follows started functions. Blocks are freed on stop and when the function ends, and the
+ *        high-water mark keeps the maximum.
+ * 
+ */
+TEST(FunctionTest, ArgPoolUsage) {
+  
+  uint8_t handleA;
+  uint8_t handleB;
+  uint16_t used;
+  uint16_t highWater;
+  
+  TEST_ASSERT_EQUAL_UINT8(FB_FENGINE_FUNCTION_CMD_OK, fFaraabinFunctionEngine_Start((uint32_t)&EngineTestFn_RR_A_obj, (uint32_t)&PoolObj[0], ArgBuffer, ARG_SIZE_OF_BLOCKS_(3U), &handleA));
+  TEST_ASSERT_EQUAL_UINT8(FB_FENGINE_FUNCTION_CMD_OK, fFaraabinFunctionEngine_Start((uint32_t)&EngineTestFn_RR_A_obj, (uint32_t)&PoolObj[1], ArgBuffer, ARG_SIZE_OF_BLOCKS_(2U), &handleB));
+  fFaraabinFunctionEngine_GetArgPoolUsage(&used, &highWater);
+  TEST_ASSERT_EQUAL_UINT16(5U, used);
+  TEST_ASSERT_GREATER_OR_EQUAL_UINT16(5U, highWater);
+  uint16_t highWaterStarted = highWater;
+  
+  TEST_ASSERT_EQUAL_UINT8(FB_FENGINE_FUNCTION_CMD_OK, fFaraabinFunctionEngine_Stop((uint32_t)&EngineTestFn_RR_A_obj, (uint32_t)&PoolObj[0], handleA));
+  fFaraabinFunctionEngine_GetArgPoolUsage(&used, &highWater);
+  TEST_ASSERT_EQUAL_UINT16(2U, used);
+  TEST_ASSERT_EQUAL_UINT16(highWaterStarted, highWater);
+  
+  // RR_A ends in its first slice, since its object is 1.
+  RunEngine(1U);
+  TEST_ASSERT_EQUAL_UINT16(0U, fFaraabinFunctionEngine_GetQtyOfRunningFunctions());
+  fFaraabinFunctionEngine_GetArgPoolUsage(&used, &highWater);
+  TEST_ASSERT_EQUAL_UINT16(0U, used);
+  TEST_ASSERT_EQUAL_UINT16(highWaterStarted, highWater);
+}
+
+/**
+ * @brief Start fails when the pool is full, or when free blocks are enough but not contiguous.
+ * 
+ * @note Block layout is written for the default pool of 32 blocks with up to 13 blocks for each function.
+ * 
+ */
+TEST(FunctionTest, ArgPoolExhausted) {
+  
+#if (FB_FUNCTION_ARG_POOL_BLOCK_QTY == 32U) && (((FB_FUNCTION_PARAM_BUFFER_SIZE - 1U) / FB_FUNCTION_ARG_POOL_BLOCK_SIZE) == 12U)
+  uint8_t handle[POOL_OBJ_QTY];
+  uint16_t used;
+  uint16_t highWater;
+  
+  // Blocks 0-12, 13-25 and 26-31.
+  TEST_ASSERT_EQUAL_UINT8(FB_FENGINE_FUNCTION_CMD_OK, fFaraabinFunctionEngine_Start((uint32_t)&EngineTestFn_RR_A_obj, (uint32_t)&PoolObj[0], ArgBuffer, ARG_SIZE_OF_BLOCKS_(13U), &handle[0]));
+  TEST_ASSERT_EQUAL_UINT8(FB_FENGINE_FUNCTION_CMD_OK, fFaraabinFunctionEngine_Start((uint32_t)&EngineTestFn_RR_A_obj, (uint32_t)&PoolObj[1], ArgBuffer, ARG_SIZE_OF_BLOCKS_(13U), &handle[1]));
+  TEST_ASSERT_EQUAL_UINT8(FB_FENGINE_FUNCTION_CMD_OK, fFaraabinFunctionEngine_Start((uint32_t)&EngineTestFn_RR_A_obj, (uint32_t)&PoolObj[2], ArgBuffer, ARG_SIZE_OF_BLOCKS_(6U), &handle[2]));
+  fFaraabinFunctionEngine_GetArgPoolUsage(&used, &highWater);
+  TEST_ASSERT_EQUAL_UINT16(32U, used);
+  TEST_ASSERT_EQUAL_UINT16(32U, highWater);
+  
+  TEST_ASSERT_EQUAL_UINT8(FB_FENGINE_ARG_POOL_EXHAUSTED, fFaraabinFunctionEngine_Start((uint32_t)&EngineTestFn_RR_A_obj, (uint32_t)&PoolObj[3], ArgBuffer, 0U, &handle[3]));
+  TEST_ASSERT_EQUAL_UINT16(3U, fFaraabinFunctionEngine_GetQtyOfRunningFunctions());
+  
+  // Free blocks 0-12 and 26-31, then take block 0, so 18 blocks are free in runs of 12 and 6.
+  TEST_ASSERT_EQUAL_UINT8(FB_FENGINE_FUNCTION_CMD_OK, fFaraabinFunctionEngine_Stop((uint32_t)&EngineTestFn_RR_A_obj, (uint32_t)&PoolObj[0], handle[0]));
+  TEST_ASSERT_EQUAL_UINT8(FB_FENGINE_FUNCTION_CMD_OK, fFaraabinFunctionEngine_Stop((uint32_t)&EngineTestFn_RR_A_obj, (uint32_t)&PoolObj[2], handle[2]));
+  TEST_ASSERT_EQUAL_UINT8(FB_FENGINE_FUNCTION_CMD_OK, fFaraabinFunctionEngine_Start((uint32_t)&EngineTestFn_RR_A_obj, (uint32_t)&PoolObj[0], ArgBuffer, 0U, &handle[0]));
+  fFaraabinFunctionEngine_GetArgPoolUsage(&used, &highWater);
+  TEST_ASSERT_EQUAL_UINT16(14U, used);
+  
+  TEST_ASSERT_EQUAL_UINT8(FB_FENGINE_ARG_POOL_EXHAUSTED, fFaraabinFunctionEngine_Start((uint32_t)&EngineTestFn_RR_A_obj, (uint32_t)&PoolObj[2], ArgBuffer, ARG_SIZE_OF_BLOCKS_(13U), &handle[2]));
+  TEST_ASSERT_EQUAL_UINT8(FB_FENGINE_FUNCTION_CMD_OK, fFaraabinFunctionEngine_Start((uint32_t)&EngineTestFn_RR_A_obj, (uint32_t)&PoolObj[2], ArgBuffer, ARG_SIZE_OF_BLOCKS_(12U), &handle[2]));
+  fFaraabinFunctionEngine_GetArgPoolUsage(&used, &highWater);
+  TEST_ASSERT_EQUAL_UINT16(26U, used);
+  
+  for(uint16_t i = 0; i < 3U; i++) {
+    TEST_ASSERT_EQUAL_UINT8(FB_FENGINE_FUNCTION_CMD_OK, fFaraabinFunctionEngine_Stop((uint32_t)&EngineTestFn_RR_A_obj, (uint32_t)&PoolObj[i], handle[i]));
+  }
+  fFaraabinFunctionEngine_GetArgPoolUsage(&used, &highWater);
+  TEST_ASSERT_EQUAL_UINT16(0U, used);
+  TEST_ASSERT_EQUAL_UINT16(32U, highWater);
+#endif
+}
+
+/**
+ * @brief Started functions get distinct handles. Commands by handle act on their own execution, stale or invalid
+ *        handles are rejected, the handle of a stopped execution is reused first and only running functions are iterated.
+ * 
+ */
+TEST(FunctionTest, HandleLookup) {
+  
+  uint8_t handle[POOL_OBJ_QTY];
+  uint32_t objects[POOL_OBJ_QTY];
+  uint8_t handles[POOL_OBJ_QTY];
+  uint32_t fn = (uint32_t)&EngineTestFn_RR_A_obj;
+  
+  for(uint16_t i = 0; i < POOL_OBJ_QTY; i++) {
+    
+    TEST_ASSERT_EQUAL_UINT8(FB_FENGINE_FUNCTION_CMD_OK, fFaraabinFunctionEngine_Start(fn, (uint32_t)&PoolObj[i], ArgBuffer, 0U, &handle[i]));
+    TEST_ASSERT_TRUE(handle[i] < FB_MAX_CONCURRENT_FUNCTION);
+    
+    for(uint16_t j = 0; j < i; j++) {
+      TEST_ASSERT_NOT_EQUAL(handle[j], handle[i]);
+    }
+  }
+  
+  TEST_ASSERT_EQUAL_UINT8(FB_FENGINE_FUNCTION_CMD_OK, fFaraabinFunctionEngine_Pause(fn, (uint32_t)&PoolObj[1], handle[1]));
+  TEST_ASSERT_EQUAL_UINT8(3U, RunningObjects(objects, handles));
+  TEST_ASSERT_EQUAL_UINT32((uint32_t)&PoolObj[0], objects[0]);
+  TEST_ASSERT_EQUAL_UINT32((uint32_t)&PoolObj[2], objects[1]);
+  TEST_ASSERT_EQUAL_UINT32((uint32_t)&PoolObj[3], objects[2]);
+  TEST_ASSERT_EQUAL_UINT8(handle[2], handles[1]);
+  
+  TEST_ASSERT_EQUAL_UINT8(FB_FENGINE_FUNCTION_CMD_OK, fFaraabinFunctionEngine_Resume(fn, (uint32_t)&PoolObj[1], handle[1]));
+  TEST_ASSERT_EQUAL_UINT8(4U, RunningObjects(objects, handles));
+  TEST_ASSERT_EQUAL_UINT32((uint32_t)&PoolObj[1], objects[1]);
+  
+  // Handle of another execution, out of range handle and handle of a stopped execution.
+  TEST_ASSERT_EQUAL_UINT8(FB_FENGINE_FUNCTION_NOT_IN_LIST, fFaraabinFunctionEngine_Pause(fn, (uint32_t)&PoolObj[0], handle[1]));
+  TEST_ASSERT_EQUAL_UINT8(FB_FENGINE_FUNCTION_NOT_IN_LIST, fFaraabinFunctionEngine_Stop(fn, (uint32_t)&PoolObj[0], FB_MAX_CONCURRENT_FUNCTION));
+  TEST_ASSERT_EQUAL_UINT8(4U, RunningObjects(objects, handles));
+  
+  TEST_ASSERT_EQUAL_UINT8(FB_FENGINE_FUNCTION_CMD_OK, fFaraabinFunctionEngine_Stop(fn, (uint32_t)&PoolObj[2], handle[2]));
+  TEST_ASSERT_EQUAL_UINT8(FB_FENGINE_FUNCTION_NOT_IN_LIST, fFaraabinFunctionEngine_Resume(fn, (uint32_t)&PoolObj[2], handle[2]));
+  TEST_ASSERT_EQUAL_UINT8(3U, RunningObjects(objects, handles));
+  TEST_ASSERT_EQUAL_UINT32((uint32_t)&PoolObj[3], objects[2]);
+  
+  uint8_t oldHandle = handle[2];
+  TEST_ASSERT_EQUAL_UINT8(FB_FENGINE_FUNCTION_CMD_OK, fFaraabinFunctionEngine_Start(fn, (uint32_t)&PoolObj[2], ArgBuffer, 0U, &handle[2]));
+  TEST_ASSERT_EQUAL_UINT8(oldHandle, handle[2]);
+  
+  // Lookup without handle searches the active list.
+  TEST_ASSERT_EQUAL_UINT8(FB_FENGINE_FUNCTION_CMD_OK, fFaraabinFunctionEngine_Pause(fn, (uint32_t)&PoolObj[3], FB_FENGINE_INVALID_HANDLE));
+  TEST_ASSERT_EQUAL_UINT8(3U, RunningObjects(objects, handles));
+  
+  for(uint16_t i = 0; i < POOL_OBJ_QTY; i++) {
+    TEST_ASSERT_EQUAL_UINT8(FB_FENGINE_FUNCTION_CMD_OK, fFaraabinFunctionEngine_Stop(fn, (uint32_t)&PoolObj[i], handle[i]));
+  }
+  TEST_ASSERT_EQUAL_UINT8(0U, RunningObjects(objects, handles));
+}
+
 /**
  * @brief Setup that executes before all tests.
  * 
@@ -135,6 +475,70 @@ static void OneTimeTeardown(void) {
 
 }
 
+/**
+ * @brief Appends a character to the log of the engine test functions.
+ * 
+ * @param c Character to append.
+ */
+static void EngineLogAdd(char c) {
+  
+  if(EngineLogQty < ENGINE_LOG_SIZE) {
+    EngineLog[EngineLogQty] = c;
+    EngineLogQty++;
+    EngineLog[EngineLogQty] = '\0';
+  }
+}
+
+/**
+ * @brief Runs the function engine for a number of passes.
+ * 
+ * @param passQty Number of passes.
+ */
+static void RunEngine(uint16_t passQty) {
+  
+  for(uint16_t i = 0; i < passQty; i++) {
+    fFaraabinFunctionEngine_Run();
+  }
+}
+
+/**
+ * @brief Collects the running functions in the order of the engine iteration.
+ * 
+ * @param objects Pointer to the array that receives the objects of the running functions.
+ * @param handles Pointer to the array that receives the handles of the running functions.
+ * @return qty Number of running functions.
+ */
+static uint8_t RunningObjects(uint32_t *objects, uint8_t *handles) {
+  
+  uint8_t qty = 0U;
+  uint8_t handle = FB_FENGINE_INVALID_HANDLE;
+  uint32_t fn;
+  uint32_t obj;
+  
+  while(fFaraabinFunctionEngine_GetNextRunningFunction(&handle, &fn, &obj) == 0U) {
+    
+    if(qty < POOL_OBJ_QTY) {
+      objects[qty] = obj;
+      handles[qty] = handle;
+    }
+    qty++;
+  }
+  
+  return qty;
+}
+
+/**
+ * @brief Function group of the engine tests.
+ * 
+ */
+FARAABIN_FUNCTION_GROUP_(EngineTestFn, "help") {
+  
+  FARAABIN_FUNCTION_GROUP_ADD_(EngineTestFn, RR_A);
+  FARAABIN_FUNCTION_GROUP_ADD_(EngineTestFn, RR_B);
+  FARAABIN_FUNCTION_GROUP_ADD_(EngineTestFn, BUSY);
+  FARAABIN_FUNCTION_GROUP_ADD_(EngineTestFn, STEPS);
+}
+
 /**
  * @brief 
  * 
@@ -22,16 +22,47 @@
 /* Includes ------------------------------------------------------------------*/
 #include "faraabin_fobject_var_test.h"
 
+#include <string.h>
+
 #include "unity_fixture.h"
 #include "faraabin.h"
+#include "faraabin_link_buffer.h"
+#include "faraabin_link_serializer.h"
 
 /* Private define ------------------------------------------------------------*/
+#define VAR_TEST_TX_BUFFER_SIZE   (512U)  /*!< Size of the TX buffer that dictionary frames are captured in. */
+#define VAR_TEST_FRAME_SIZE_MAX   (128U)  /*!< Maximum size of a de-escaped frame in TX buffer. */
+#define VAR_TEST_FRAME_QTY_MAX    (8U)    /*!< Maximum number of captured dictionary frames. */
+#define VAR_TEST_STRING_SIZE_MAX  (32U)   /*!< Maximum size of name and path of a captured variable. */
+
+#define VAR_TEST_EOF              (0x7EU) /*!< End of frame byte. */
+#define VAR_TEST_ESC              (0x7DU) /*!< Escape byte. */
+#define VAR_TEST_ESC_XOR          (0x20U) /*!< Value that escaped bytes are XORed with. */
+
 /* Private macro -------------------------------------------------------------*/
 /* Private typedef -----------------------------------------------------------*/
+/**
+ * @brief Fields of a dictionary frame that is captured from TX buffer.
+ * 
+ */
+typedef struct {
+
+  uint16_t TotalSubDicts;               /*!< Number of frames in the dictionary. */
+  uint16_t SubDictIndex;                /*!< Index of the frame in the dictionary. */
+  uint8_t Type;                         /*!< First byte of the payload. */
+  uint32_t VarPtr;                      /*!< Pointer to the variable. Only valid in variable frames. */
+  uint32_t VarTypePtr;                  /*!< Pointer to the var type. Only valid in variable frames. */
+  uint32_t VarArrayQty;                 /*!< Array quantity of the variable. Only valid in variable frames. */
+  char Name[VAR_TEST_STRING_SIZE_MAX];  /*!< Name of the variable. Only valid in variable frames. */
+  char Path[VAR_TEST_STRING_SIZE_MAX];  /*!< Path of the variable. Only valid in variable frames. */
+
+}sVarTestDictFrame;
+
 /* Private variables ---------------------------------------------------------*/
 TEST_GROUP(VarTest);
 
 FARAABIN_DICT_GROUP_DEF_STATIC_(VarTestDg);
+FARAABIN_SECTION_CONTAINER_DEF_STATIC_(VarTestSectionDg);
 
 // Variables christmas tree
 // *
@@ -137,12 +168,24 @@ static float64_t TestF64ArrayWpCb[3];
 // *******************
 // *******************
 
+// Variables registered in faraabin dictionary section
+static uint32_t TestSectionU32;
+static float32_t TestSectionF32Array[3];
+FARAABIN_SECTION_VAR_(VarTestSectionDg, uint32_t, TestSectionU32);
+FARAABIN_SECTION_VAR_ARRAY_WP_(VarTestSectionDg, float32_t, TestSectionF32Array, "TestVar\\Section");
+
+static uint8_t TestTxBuffer[VAR_TEST_TX_BUFFER_SIZE];
+static uint8_t TestFrame[VAR_TEST_FRAME_SIZE_MAX];
+static sVarTestDictFrame TestDictFrames[VAR_TEST_FRAME_QTY_MAX];
+
 /* Private function prototypes -----------------------------------------------*/
 static void RunTests(void);
 static void OneTimeSetup(void);
 static void OneTimeTeardown(void);
 
 static uint8_t VarTestAccessCallback(eFaraabinVarAccessType accessType, uint32_t varPtr, uint8_t *data, uint16_t size);
+static uint16_t CaptureDictFrames(void);
+static uint32_t FrameU32(uint16_t index);
 
 /* Variables -----------------------------------------------------------------*/
 
@@ -183,6 +226,8 @@ int FaraabinFobjectVarTest_Run(int argc, const char* argv[]) {
 TEST_GROUP_RUNNER(VarTest) {
   
   RUN_TEST_CASE(VarTest, TemplateTest);
+  RUN_TEST_CASE(VarTest, SectionVarCount);
+  RUN_TEST_CASE(VarTest, SectionVarDictFrames);
   
 }
 
@@ -208,6 +253,7 @@ TEST_SETUP(VarTest) {
  */
 TEST_TEAR_DOWN(VarTest) {
 
+  fFaraabinLinkBuffer_Init(fFaraabin_GetTxBufferPointer(), fFaraabin_GetTxBufferSize());
 }
 
 /**
@@ -219,6 +265,72 @@ TEST(VarTest, TemplateTest) {
   TEST_ASSERT(true);
 }
 
+/**
+ * @brief Container counts its variable descriptors in faraabin dictionary section.
+ * 
+ */
+TEST(VarTest, SectionVarCount) {
+  
+#ifdef FB_FEATURE_FLAG_SECTION_DICT
+  TEST_ASSERT_EQUAL_UINT16(2U, VarTestSectionDg._sectionVarQty);
+#else
+  TEST_ASSERT_EQUAL_UINT16(0U, VarTestSectionDg._sectionVarQty);
+#endif
+}
+
+/**
+ * @brief Dictionary of a container without container function has one frame for the container and one frame
+ *        for each of its variables in faraabin dictionary section.
+ * 
+ */
+TEST(VarTest, SectionVarDictFrames) {
+
+  fFaraabinLinkBuffer_Init(TestTxBuffer, VAR_TEST_TX_BUFFER_SIZE);
+  fFaraabinLinkBuffer_Clear();
+  fFaraabinLinkSerializer_ResetDictStrings();
+
+  fFaraabinLinkSerializer_SerializeDict((uint32_t)&VarTestSectionDg, 0U, 0U);
+
+  uint16_t frameQty = CaptureDictFrames();
+
+#ifdef FB_FEATURE_FLAG_SECTION_DICT
+  TEST_ASSERT_EQUAL_UINT16(3U, frameQty);
+#else
+  TEST_ASSERT_EQUAL_UINT16(1U, frameQty);
+#endif
+
+  for(uint16_t i = 0; i < frameQty; i++) {
+    TEST_ASSERT_EQUAL_UINT16(frameQty, TestDictFrames[i].TotalSubDicts);
+    TEST_ASSERT_EQUAL_UINT16(i, TestDictFrames[i].SubDictIndex);
+  }
+
+  TEST_ASSERT_EQUAL_UINT8((uint8_t)eFO_TYPE_CONTAINER | 0x80U, TestDictFrames[0].Type);
+
+#ifdef FB_FEATURE_FLAG_SECTION_DICT
+  sVarTestDictFrame *var = &TestDictFrames[1];
+
+  TEST_ASSERT_EQUAL_UINT8((uint8_t)eFO_TYPE_VAR | 0x80U, var->Type);
+  TEST_ASSERT_EQUAL_UINT32((uint32_t)&TestSectionU32, var->VarPtr);
+  TEST_ASSERT_EQUAL_UINT32((uint32_t)&__faraabin_vartype_uint32_t, var->VarTypePtr);
+  TEST_ASSERT_EQUAL_UINT32(1U, var->VarArrayQty);
+  TEST_ASSERT_EQUAL_STRING("TestSectionU32", var->Name);
+
+  var = &TestDictFrames[2];
+
+  TEST_ASSERT_EQUAL_UINT8((uint8_t)eFO_TYPE_VAR | 0x80U, var->Type);
+  TEST_ASSERT_EQUAL_UINT32((uint32_t)&TestSectionF32Array, var->VarPtr);
+  TEST_ASSERT_EQUAL_UINT32((uint32_t)&__faraabin_vartype_float32_t, var->VarTypePtr);
+  TEST_ASSERT_EQUAL_UINT32(3U, var->VarArrayQty);
+  TEST_ASSERT_EQUAL_STRING("TestSectionF32Array", var->Name);
+
+  // Paths are encoded when string table is enabled.
+#ifndef FB_FEATURE_FLAG_DICT_STRING_TABLE
+  TEST_ASSERT_EQUAL_STRING("root", TestDictFrames[1].Path);
+  TEST_ASSERT_EQUAL_STRING("TestVar\\Section", TestDictFrames[2].Path);
+#endif
+#endif
+}
+
 /**
  * @brief Setup that executes before all tests.
  * 
@@ -226,6 +338,7 @@ TEST(VarTest, TemplateTest) {
 static void OneTimeSetup(void) {
 
   FARAABIN_DictGroup_Init_(&VarTestDg);
+  FARAABIN_Container_Init_(&VarTestSectionDg);
   
 }
 
@@ -251,6 +364,105 @@ static uint8_t VarTestAccessCallback(eFaraabinVarAccessType accessType, uint32_t
   return 0;
 }
 
+/**
+ * @brief Decodes the dictionary frames in TX buffer.
+ * 
+ * @note TX buffer is cleared before serializing, so frames start from the beginning of it.
+ * 
+ * @return frameQty Number of valid dictionary frames. Decoding stops at the first malformed frame.
+ */
+static uint16_t CaptureDictFrames(void) {
+
+  uint16_t frameQty = 0U;
+  uint16_t frameSize = 0U;
+  bool isEscaped = false;
+
+  memset(TestDictFrames, 0, sizeof(TestDictFrames));
+
+  for(uint32_t i = 0; (i < FbCircularBuffer._head) && (frameQty < VAR_TEST_FRAME_QTY_MAX); i++) {
+
+    uint8_t c = FbCircularBuffer.Buffer[i];
+
+    if(c != VAR_TEST_EOF) {
+
+      if(frameSize >= VAR_TEST_FRAME_SIZE_MAX) {
+        return frameQty;
+      }
+
+      if(c == VAR_TEST_ESC) {
+        isEscaped = true;
+      } else {
+        TestFrame[frameSize++] = isEscaped ? (c ^ VAR_TEST_ESC_XOR) : c;
+        isEscaped = false;
+      }
+      continue;
+    }
+
+    uint8_t checksum = 0U;
+    for(uint16_t j = 0; j < frameSize; j++) {
+      checksum += TestFrame[j];
+    }
+
+    uByte2 control;
+    control.Byte[0] = TestFrame[0];
+    control.Byte[1] = TestFrame[1];
+    uint16_t propIndex = ((control.U16 & (1U << 14U)) != 0U) ? 14U : 10U;
+
+    if((checksum != 0xFFU) || (frameSize < (propIndex + 9U)) ||
+       (TestFrame[propIndex] != (uint8_t)((uint8_t)eFB_PROP_GROUP_DICT << 5U))) {
+      return frameQty;
+    }
+
+    sVarTestDictFrame *frame = &TestDictFrames[frameQty];
+    uint16_t pos = propIndex + 3U;
+
+    frame->TotalSubDicts = (uint16_t)(TestFrame[pos] | (TestFrame[pos + 1U] << 8U));
+    pos += 2U;
+    frame->SubDictIndex = (uint16_t)(TestFrame[pos] | (TestFrame[pos + 1U] << 8U));
+    pos += 2U;
+    frame->Type = TestFrame[pos++];
+
+    // Variable frames: pointer, var type, array qty, control, name ':' path '\0'.
+    if((frame->Type == ((uint8_t)eFO_TYPE_VAR | 0x80U)) && (frameSize > (pos + 13U))) {
+
+      frame->VarPtr = FrameU32(pos);
+      frame->VarTypePtr = FrameU32(pos + 4U);
+      frame->VarArrayQty = FrameU32(pos + 8U);
+      pos += 13U;
+
+      uint16_t len = 0U;
+      while((pos < frameSize) && (TestFrame[pos] != (uint8_t)':') && (len < (VAR_TEST_STRING_SIZE_MAX - 1U))) {
+        frame->Name[len++] = (char)TestFrame[pos++];
+      }
+      pos++;
+
+      len = 0U;
+      while((pos < frameSize) && (TestFrame[pos] != 0U) && (len < (VAR_TEST_STRING_SIZE_MAX - 1U))) {
+        frame->Path[len++] = (char)TestFrame[pos++];
+      }
+    }
+
+    frameQty++;
+    frameSize = 0U;
+  }
+
+  return frameQty;
+}
+
+/**
+ * @brief Reads a little endian 32-bit value from the captured frame.
+ * 
+ * @param index Index of the first byte in TestFrame.
+ * @return value 
+ */
+static uint32_t FrameU32(uint16_t index) {
+
+  return (uint32_t)TestFrame[index] |
+         ((uint32_t)TestFrame[index + 1U] << 8U) |
+         ((uint32_t)TestFrame[index + 2U] << 16U) |
+         ((uint32_t)TestFrame[index + 3U] << 24U);
+}
+
 /**
  * @brief DictGroup function
  * 
@@ -25,6 +25,8 @@
 #include "unity_fixture.h"
 #include "faraabin.h"
 
+#include <stddef.h>
+
 /* Private define ------------------------------------------------------------*/
 /* Private macro -------------------------------------------------------------*/
 /* Private typedef -----------------------------------------------------------*/
@@ -64,6 +66,18 @@ typedef struct {
 
 }sTypeTestStatic;
 
+/**
+ * @brief 
+ * 
+ */
+typedef struct {
+
+  uint8_t A;
+  uint16_t B[3];
+  float32_t C;
+
+}sTypeTestLayout;
+
 /* Private variables ---------------------------------------------------------*/
 TEST_GROUP(VartypeTest);
 
@@ -74,6 +88,7 @@ FARAABIN_VAR_TYPE_DEF_EXTERN_(sTypeTestStruct);
 FARAABIN_VAR_TYPE_DEF_STATIC_(sTypeTestStatic);
 FARAABIN_VAR_TYPE_DEF_(eTypeTestEnum);
 FARAABIN_VAR_TYPE_DEF_EXTERN_(eTypeTestEnum);
+FARAABIN_VAR_TYPE_LAYOUT_DEF_(sTypeTestLayout);
 
 static sTypeTestStruct TestVarStruct;
 static sTypeTestStruct TestVarStructArray[2];
@@ -126,6 +141,7 @@ int FaraabinFobjectVartypeTest_Run(int argc, const char* argv[]) {
 TEST_GROUP_RUNNER(VartypeTest) {
   
   RUN_TEST_CASE(VartypeTest, TemplateTest);
+  RUN_TEST_CASE(VartypeTest, LayoutTable);
   
 }
 
@@ -162,6 +178,33 @@ TEST(VartypeTest, TemplateTest) {
   TEST_ASSERT(true);
 }
 
+/**
+ * @brief Layout table lookup and snapshot diff.
+ * 
+ */
+TEST(VartypeTest, LayoutTable) {
+  
+  sTypeTestLayout a = {0};
+  sTypeTestLayout b = {0};
+  const sFaraabinFobjectVarType_Member *member;
+  
+  TEST_ASSERT_EQUAL_UINT16(3U, fFaraabinFobjectVarType_GetMemberQty(&__faraabin_vartype_sTypeTestLayout));
+  
+  member = FARAABIN_VAR_TYPE_FIND_MEMBER_(sTypeTestLayout, "B");
+  TEST_ASSERT_NOT_NULL(member);
+  TEST_ASSERT_EQUAL_UINT16(offsetof(sTypeTestLayout, B), member->Offset);
+  TEST_ASSERT_EQUAL_UINT16(sizeof(a.B), member->Size);
+  TEST_ASSERT_EQUAL_UINT16(3U, member->ArrayQty);
+  TEST_ASSERT_EQUAL_UINT8(eVAR_DATA_TYPE_PRIMITIVE_UINT16, member->VarType->PrimitiveId);
+  TEST_ASSERT_NULL(FARAABIN_VAR_TYPE_FIND_MEMBER_(sTypeTestLayout, "D"));
+  
+  TEST_ASSERT_EQUAL_UINT16(FB_VARTYPE_MEMBER_NONE, FARAABIN_VAR_TYPE_NEXT_CHANGED_MEMBER_(sTypeTestLayout, &a, &b, 0U));
+  b.B[2] = 1U;
+  b.C = 1.0f;
+  TEST_ASSERT_EQUAL_UINT16(1U, FARAABIN_VAR_TYPE_NEXT_CHANGED_MEMBER_(sTypeTestLayout, &a, &b, 0U));
+  TEST_ASSERT_EQUAL_UINT16(2U, FARAABIN_VAR_TYPE_NEXT_CHANGED_MEMBER_(sTypeTestLayout, &a, &b, 2U));
+}
+
 /**
  * @brief Setup that executes before all tests.
  * 
@@ -175,6 +218,7 @@ static void OneTimeSetup(void) {
   FARAABIN_VAR_TYPE_ENUM_INIT_(eTypeTestEnum);
   FARAABIN_VAR_TYPE_ENUM_INIT_WP_(eTypeTestEnum, "TestVartype\\Wp");
   FARAABIN_VAR_TYPE_STRUCT_INIT_WP_(sTypeTestStatic, "TestVartype\\Wp");
+  FARAABIN_VAR_TYPE_STRUCT_INIT_(sTypeTestLayout);
 
 }
 
@@ -257,6 +301,22 @@ static FARAABIN_VAR_TYPE_STRUCT_FUNC_(sTypeTestStatic)
   FARAABIN_VAR_TYPE_STRUCT_FUNC_END_(sTypeTestStatic);
 }
 
+/**
+ * @brief 
+ * 
+ */
+FARAABIN_VAR_TYPE_LAYOUT_FUNC_(sTypeTestLayout)
+{
+  FARAABIN_VAR_TYPE_LAYOUT_FUNC_START_(sTypeTestLayout);
+  
+  FARAABIN_VAR_TYPE_LAYOUT_MEMBER_(uint8_t, A, 1);
+  FARAABIN_VAR_TYPE_LAYOUT_MEMBER_(uint16_t, B, 3);
+  FARAABIN_VAR_TYPE_LAYOUT_MEMBER_(float32_t, C, 1);
+  
+  FARAABIN_VAR_TYPE_LAYOUT_FUNC_END_(sTypeTestLayout);
+}
+FARAABIN_VAR_TYPE_LAYOUT_SEND_FUNC_(sTypeTestLayout)
+
 /**
  * @brief 
  * 
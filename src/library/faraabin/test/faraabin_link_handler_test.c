@@ -0,0 +1,587 @@
+/**
+ ******************************************************************************
+ * @file           : faraabin_link_handler_test.c
+ * @brief          :
+ ******************************************************************************
+ * @attention
+ * 
+ * Copyright (c) 2024 FaraabinCo.
+ * All rights reserved.
+ * 
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component
+ * 
+ * https://faraabinco.ir/
+ * https://github.com/FaraabinCo
+ * 
+ ******************************************************************************
+ * @verbatim
+ * @endverbatim
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "faraabin_link_handler_test.h"
+
+#include <string.h>
+
+#include "unity_fixture.h"
+#include "faraabin.h"
+#include "faraabin_database.h"
+#include "faraabin_link_buffer.h"
+#include "faraabin_link_deserializer.h"
+#include "faraabin_link_handler.h"
+#include "faraabin_link_serializer.h"
+
+/* Private define ------------------------------------------------------------*/
+#define LINK_TEST_TX_BUFFER_SIZE  (512U)  /*!< Size of the small TX buffer that dictionary transfer is tested with. */
+#define LINK_TEST_FRAME_SIZE_MAX  (256U)  /*!< Maximum size of a de-escaped frame in TX buffer. */
+#define LINK_TEST_RUN_QTY_MAX     (500U)  /*!< Maximum number of link handler runs for a whole dictionary transfer. */
+#define LINK_TEST_REQ_SEQ         (1U)    /*!< Request sequence of the client frames sent by the test. */
+
+#define LINK_TEST_EOF             (0x7EU) /*!< End of frame byte. */
+#define LINK_TEST_ESC             (0x7DU) /*!< Escape byte. */
+#define LINK_TEST_ESC_XOR         (0x20U) /*!< Value that escaped bytes are XORed with. */
+
+#define LINK_TEST_DICT_PROP       ((uint8_t)((uint8_t)eFB_PROP_GROUP_DICT << 5U)) /*!< Property byte of dictionary frames. */
+#define LINK_TEST_EVENT_LIB_PROP  ((uint8_t)((uint8_t)eFB_PROP_GROUP_EVENT << 5U) + (uint8_t)eFB_COMMON_PROP_ID_EVENT_LIB) /*!< Property byte of system events. */
+#define LINK_TEST_UPDATE_END_PARAM_SIZE (10U) /*!< Size of the parameters of eMCU_EVENT_INFO_DICT_UPDATE_END. */
+
+/* Private macro -------------------------------------------------------------*/
+/* Private typedef -----------------------------------------------------------*/
+/**
+ * @brief Position of the dictionary frame that is expected next in the transfer.
+ * 
+ */
+typedef struct {
+
+  uint16_t DictIndex;       /*!< Index of the dictionary that the next frame belongs to. */
+  uint16_t SubDictIndex;    /*!< Index of the next frame in its dictionary. */
+  uint16_t RunDictFrameQty; /*!< Number of dictionary frames in TX buffer after the last run. */
+  uint32_t RunDictBytes;    /*!< Number of bytes of dictionary frames in TX buffer after the last run. */
+  bool IsOk;                /*!< Flag for indicating that all frames so far are valid and in order. */
+  bool IsUpdateEnd;         /*!< Flag for indicating that eMCU_EVENT_INFO_DICT_UPDATE_END is received. */
+  uint8_t UpdateEndParam[LINK_TEST_UPDATE_END_PARAM_SIZE]; /*!< Parameters of the last eMCU_EVENT_INFO_DICT_UPDATE_END. */
+
+}sDictCheck;
+
+/* Private variables ---------------------------------------------------------*/
+TEST_GROUP(LinkHandlerTest);
+
+FARAABIN_DICT_GROUP_DEF_STATIC_(LinkTestDg);
+
+static uint32_t LinkTestVar[24];
+
+FARAABIN_EVENT_GROUP_DEF_STATIC_(LinkTestLateEg);
+FARAABIN_EVENT_GROUP_DEF_STATIC_(LinkTestOfflineEg);
+
+static uint8_t TestTxBuffer[LINK_TEST_TX_BUFFER_SIZE];
+static uint8_t TestFrame[LINK_TEST_FRAME_SIZE_MAX];
+
+/* Private function prototypes -----------------------------------------------*/
+static void RunTests(void);
+static void OneTimeSetup(void);
+static void OneTimeTeardown(void);
+static void SendClientFrame(uint8_t prop, uint8_t *payload, uint16_t payloadSize);
+static void SendAllDictRequest(void);
+static void SendLiveRequest(void);
+static uint16_t RunUntilDictIndex(sDictCheck *check, uint16_t dictIndex, uint16_t dictQty);
+static uint32_t ParamU32(const uint8_t *param);
+static void CheckDictFrames(sDictCheck *check, uint16_t dictQty);
+
+/* Variables -----------------------------------------------------------------*/
+
+/*
+╔══════════════════════════════════════════════════════════════════════════════════╗
+║                          ##### Exported Functions #####                          ║
+╚══════════════════════════════════════════════════════════════════════════════════╝
+*/
+
+/**
+ * @brief Function that runs all unit tests and returns the result
+ * 
+ * @param argc 
+ * @param argv 
+ * @return int 
+ */
+int FaraabinLinkHandlerTest_Run(int argc, const char* argv[]) {
+
+  OneTimeSetup();
+
+  int testsFailed = UnityMain(argc, argv, RunTests);
+
+  OneTimeTeardown();
+
+  return testsFailed;
+}
+
+/*
+╔══════════════════════════════════════════════════════════════════════════════════╗
+║                            ##### Private Functions #####                         ║
+╚══════════════════════════════════════════════════════════════════════════════════╝
+*/
+
+/**
+ * @brief Test group runner.
+ * 
+ */
+TEST_GROUP_RUNNER(LinkHandlerTest) {
+
+  RUN_TEST_CASE(LinkHandlerTest, TemplateTest);
+  RUN_TEST_CASE(LinkHandlerTest, DictPipelineSendsEachFrameOnce);
+  RUN_TEST_CASE(LinkHandlerTest, DictAddedDuringTransferIsSentAsUpdate);
+  RUN_TEST_CASE(LinkHandlerTest, NewDictClearedOnlyWhenHostIsInSync);
+
+}
+
+/**
+ * @brief Run all tests in test group.
+ * 
+ */
+static void RunTests(void) {
+  RUN_TEST_GROUP(LinkHandlerTest);
+}
+
+/**
+ * @brief Unit test setup.
+ * 
+ */
+TEST_SETUP(LinkHandlerTest) {
+
+  fFaraabinLinkBuffer_Init(TestTxBuffer, LINK_TEST_TX_BUFFER_SIZE);
+}
+
+/**
+ * @brief Unit test teardown.
+ * 
+ */
+TEST_TEAR_DOWN(LinkHandlerTest) {
+
+  fFaraabinLinkBuffer_Init(fFaraabin_GetTxBufferPointer(), fFaraabin_GetTxBufferSize());
+}
+
+/**
+ * @brief Template test.
+ * 
+ */
+TEST(LinkHandlerTest, TemplateTest) {
+
+  TEST_ASSERT(true);
+}
+
+/**
+ * @brief Non-blocking dictionary transfer with live events in a small TX buffer sends every dictionary frame
+ *        exactly once and in order, resumes in the middle of a container and keeps the frames of each run
+ *        below the watermark.
+ * 
+ */
+TEST(LinkHandlerTest, DictPipelineSendsEachFrameOnce) {
+
+  uint32_t watermark = (LINK_TEST_TX_BUFFER_SIZE * FB_DICT_TX_WATERMARK_PERCENT) / 100U;
+  uint16_t dictQty = fFaraabinDatabase_GetNumberOfAddedDicts();
+
+  uint16_t containerIndex = dictQty;
+  for(uint16_t i = 0; i < dictQty; i++) {
+    if(fFaraabinDatabase_GetFobjectPointerFromDict(i) == (uint32_t)&LinkTestDg) {
+      containerIndex = i;
+    }
+  }
+  TEST_ASSERT_TRUE(containerIndex < dictQty);
+
+  sDictCheck check = {0};
+  check.IsOk = true;
+  bool isResumedInContainer = false;
+
+  SendAllDictRequest();
+
+  for(uint16_t run = 0; (run < LINK_TEST_RUN_QTY_MAX) && (check.DictIndex < dictQty); run++) {
+
+    FARAABIN_Printf_("live");
+    fFaraabinLinkHandler_Run();
+
+    CheckDictFrames(&check, dictQty);
+    TEST_ASSERT_TRUE(check.IsOk);
+
+    if(check.RunDictFrameQty > 1U) {
+      TEST_ASSERT_LESS_OR_EQUAL_UINT32(watermark, check.RunDictBytes);
+    }
+
+    if((check.DictIndex == containerIndex) && (check.SubDictIndex != 0U)) {
+      isResumedInContainer = true;
+    }
+
+    fFaraabinLinkBuffer_Clear();
+  }
+
+  TEST_ASSERT_EQUAL_UINT16(dictQty, check.DictIndex);
+  TEST_ASSERT_TRUE(isResumedInContainer);
+}
+
+/**
+ * @brief Dict that is added while the whole dictionary is being sent is not part of that transfer. It is pushed
+ *        afterwards as an update that reports the synced generation, the current generation and the number of dicts.
+ * 
+ */
+TEST(LinkHandlerTest, DictAddedDuringTransferIsSentAsUpdate) {
+
+  uint16_t dictQty = fFaraabinDatabase_GetNumberOfAddedDicts();
+  uint32_t generation = fFaraabinDatabase_GetGeneration();
+
+  sDictCheck check = {0};
+  check.IsOk = true;
+
+  SendLiveRequest();
+  SendAllDictRequest();
+
+  fFaraabinLinkHandler_Run();
+  CheckDictFrames(&check, dictQty);
+  fFaraabinLinkBuffer_Clear();
+  TEST_ASSERT_TRUE(check.IsOk);
+  TEST_ASSERT_TRUE(check.DictIndex < dictQty);
+
+  FARAABIN_EventGroup_Init_WithPath_(&LinkTestLateEg, "LinkHandlerTest\\Update");
+  TEST_ASSERT_EQUAL_UINT16(dictQty + 1U, fFaraabinDatabase_GetNumberOfAddedDicts());
+  TEST_ASSERT_EQUAL_UINT32(1U, FaraabinFlags.Status.Bitfield.NewDict);
+
+  // Frames of the new dict are rejected by the check until the whole dictionary is sent.
+  RunUntilDictIndex(&check, dictQty, dictQty);
+  TEST_ASSERT_TRUE(check.IsOk);
+  TEST_ASSERT_EQUAL_UINT16(dictQty, check.DictIndex);
+  TEST_ASSERT_FALSE(check.IsUpdateEnd);
+  TEST_ASSERT_EQUAL_UINT32(1U, FaraabinFlags.Status.Bitfield.NewDict);
+
+  RunUntilDictIndex(&check, dictQty + 1U, dictQty + 1U);
+  TEST_ASSERT_TRUE(check.IsOk);
+  TEST_ASSERT_EQUAL_UINT16(dictQty + 1U, check.DictIndex);
+  TEST_ASSERT_TRUE(check.IsUpdateEnd);
+
+  TEST_ASSERT_EQUAL_UINT32(generation, ParamU32(&check.UpdateEndParam[0]));
+  TEST_ASSERT_EQUAL_UINT32(generation + 1U, ParamU32(&check.UpdateEndParam[4]));
+  TEST_ASSERT_EQUAL_UINT16(dictQty + 1U, (uint16_t)(check.UpdateEndParam[8] | (check.UpdateEndParam[9] << 8U)));
+  TEST_ASSERT_EQUAL_UINT32(0U, FaraabinFlags.Status.Bitfield.NewDict);
+
+  // Nothing more is sent once host is in sync.
+  check.IsUpdateEnd = false;
+  fFaraabinLinkHandler_Run();
+  CheckDictFrames(&check, dictQty + 1U);
+  fFaraabinLinkBuffer_Clear();
+  TEST_ASSERT_EQUAL_UINT16(0U, check.RunDictFrameQty);
+  TEST_ASSERT_FALSE(check.IsUpdateEnd);
+}
+
+/**
+ * @brief NewDict is cleared at the end of a transfer only if host has every dict. Dicts added while host is not
+ *        connected are not pushed as updates and wait for the next request of the whole dictionary.
+ * 
+ */
+TEST(LinkHandlerTest, NewDictClearedOnlyWhenHostIsInSync) {
+
+  uint16_t dictQty = fFaraabinDatabase_GetNumberOfAddedDicts();
+
+  sDictCheck check = {0};
+  check.IsOk = true;
+
+  FaraabinFlags.Status.Bitfield.NewDict = 1U;
+
+  SendLiveRequest();
+  SendAllDictRequest();
+  RunUntilDictIndex(&check, dictQty, dictQty);
+  TEST_ASSERT_TRUE(check.IsOk);
+  TEST_ASSERT_EQUAL_UINT16(dictQty, check.DictIndex);
+  TEST_ASSERT_EQUAL_UINT32(0U, FaraabinFlags.Status.Bitfield.NewDict);
+
+  fFaraabinFobjectMcu_GetFobject()->_isHostConnected = false;
+  FARAABIN_EventGroup_Init_WithPath_(&LinkTestOfflineEg, "LinkHandlerTest\\Update");
+  TEST_ASSERT_EQUAL_UINT32(1U, FaraabinFlags.Status.Bitfield.NewDict);
+
+  for(uint16_t run = 0; run < 3U; run++) {
+    fFaraabinLinkHandler_Run();
+    CheckDictFrames(&check, dictQty + 1U);
+    fFaraabinLinkBuffer_Clear();
+    TEST_ASSERT_EQUAL_UINT16(0U, check.RunDictFrameQty);
+  }
+
+  // Host that comes back doesn't get updates on top of a dictionary that may be stale.
+  SendLiveRequest();
+  for(uint16_t run = 0; run < 3U; run++) {
+    fFaraabinLinkHandler_Run();
+    CheckDictFrames(&check, dictQty + 1U);
+    fFaraabinLinkBuffer_Clear();
+    TEST_ASSERT_EQUAL_UINT16(0U, check.RunDictFrameQty);
+  }
+  TEST_ASSERT_FALSE(check.IsUpdateEnd);
+  TEST_ASSERT_EQUAL_UINT32(1U, FaraabinFlags.Status.Bitfield.NewDict);
+
+  memset(&check, 0, sizeof(check));
+  check.IsOk = true;
+
+  SendAllDictRequest();
+  RunUntilDictIndex(&check, dictQty + 1U, dictQty + 1U);
+  TEST_ASSERT_TRUE(check.IsOk);
+  TEST_ASSERT_EQUAL_UINT16(dictQty + 1U, check.DictIndex);
+  TEST_ASSERT_EQUAL_UINT32(0U, FaraabinFlags.Status.Bitfield.NewDict);
+}
+
+/**
+ * @brief Setup that executes before all tests.
+ * 
+ */
+static void OneTimeSetup(void) {
+
+  FARAABIN_DictGroup_Init_(&LinkTestDg);
+
+}
+
+/**
+ * @brief Teardown that executes after all tests (or in case of a test failure).
+ * 
+ */
+static void OneTimeTeardown(void) {
+
+}
+
+/**
+ * @brief Serializes a client frame to the MCU fobject and feeds it to the link handler byte by byte.
+ * 
+ * @param prop Property byte of the frame.
+ * @param payload Pointer to the payload.
+ * @param payloadSize Size of the payload.
+ */
+static void SendClientFrame(uint8_t prop, uint8_t *payload, uint16_t payloadSize) {
+
+  uint8_t frame[6U + 8U + 1U];
+  uint16_t frameSize = 0U;
+
+  frame[frameSize++] = ClientFrame_GenerateControlByte_(LINK_TEST_REQ_SEQ, 0U, 0U);
+  frame[frameSize++] = prop;
+  for(uint8_t i = 0; i < 4U; i++) {
+    frame[frameSize++] = 0xFFU;
+  }
+  for(uint16_t i = 0; i < payloadSize; i++) {
+    frame[frameSize++] = payload[i];
+  }
+
+  uint8_t checksum = 0U;
+  for(uint16_t i = 0; i < frameSize; i++) {
+    checksum += frame[i];
+  }
+  frame[frameSize++] = (uint8_t)(0xFFU - checksum);
+
+  for(uint16_t i = 0; i < frameSize; i++) {
+    if((frame[i] == LINK_TEST_EOF) || (frame[i] == LINK_TEST_ESC)) {
+      fFaraabinLinkHandler_CharReceived(LINK_TEST_ESC);
+      fFaraabinLinkHandler_CharReceived(frame[i] ^ LINK_TEST_ESC_XOR);
+    } else {
+      fFaraabinLinkHandler_CharReceived(frame[i]);
+    }
+  }
+  fFaraabinLinkHandler_CharReceived(LINK_TEST_EOF);
+}
+
+/**
+ * @brief Requests the whole dictionary in non-blocking mode.
+ * 
+ */
+static void SendAllDictRequest(void) {
+
+  uint8_t payload[3] = {0U, 0U, 0U};
+
+  SendClientFrame(
+    (uint8_t)((uint8_t)eFB_PROP_GROUP_COMMAND << 5U) + (uint8_t)eFB_MCU_PROP_ID_COMMAND_SEND_ALL_DICT,
+    payload,
+    sizeof(payload));
+}
+
+/**
+ * @brief Requests live status, so MCU considers host as connected.
+ * 
+ * @note Link handler keeps one received frame at a time, so the request is handled before returning.
+ * 
+ */
+static void SendLiveRequest(void) {
+
+  SendClientFrame(
+    (uint8_t)((uint8_t)eFB_PROP_GROUP_COMMAND << 5U) + (uint8_t)eFB_MCU_PROP_ID_COMMAND_SEND_LIVE,
+    NULL,
+    0U);
+
+  fFaraabinLinkHandler_Run();
+  fFaraabinLinkBuffer_Clear();
+}
+
+/**
+ * @brief Runs link handler and checks its dictionary frames until the given dict is reached.
+ * 
+ * @note The run that sends the last frame of a transfer or update also finishes it.
+ * 
+ * @param check Pointer to the position of the expected dictionary frame.
+ * @param dictIndex Index of the dict that running stops at.
+ * @param dictQty Number of dicts that frames are accepted for.
+ * @return runQty Number of runs.
+ */
+static uint16_t RunUntilDictIndex(sDictCheck *check, uint16_t dictIndex, uint16_t dictQty) {
+
+  uint16_t run = 0U;
+
+  for(; (run < LINK_TEST_RUN_QTY_MAX) && (check->DictIndex < dictIndex) && check->IsOk; run++) {
+
+    fFaraabinLinkHandler_Run();
+    CheckDictFrames(check, dictQty);
+    fFaraabinLinkBuffer_Clear();
+  }
+
+  return run;
+}
+
+/**
+ * @brief Reads a little endian 32-bit event parameter.
+ * 
+ * @param param Pointer to the first byte of the parameter.
+ * @return value 
+ */
+static uint32_t ParamU32(const uint8_t *param) {
+
+  return (uint32_t)param[0] |
+         ((uint32_t)param[1] << 8U) |
+         ((uint32_t)param[2] << 16U) |
+         ((uint32_t)param[3] << 24U);
+}
+
+/**
+ * @brief Decodes the frames that the last run put in TX buffer and checks the dictionary frames among them.
+ * 
+ * @note TX buffer is cleared before each run, so frames start from the beginning of it and whatever is already
+ *       sent to the port is still in the buffer.
+ * 
+ * @param check Pointer to the position of the expected dictionary frame. It is advanced by each valid frame.
+ * @param dictQty Number of dictionaries in the transfer.
+ */
+static void CheckDictFrames(sDictCheck *check, uint16_t dictQty) {
+
+  uint16_t frameSize = 0U;
+  uint32_t rawSize = 0U;
+  bool isEscaped = false;
+
+  check->RunDictFrameQty = 0U;
+  check->RunDictBytes = 0U;
+
+  for(uint32_t i = 0; i < FbCircularBuffer._head; i++) {
+
+    uint8_t c = FbCircularBuffer.Buffer[i];
+    rawSize++;
+
+    if(c != LINK_TEST_EOF) {
+
+      if(frameSize >= LINK_TEST_FRAME_SIZE_MAX) {
+        check->IsOk = false;
+        return;
+      }
+
+      if(c == LINK_TEST_ESC) {
+        isEscaped = true;
+      } else {
+        TestFrame[frameSize++] = isEscaped ? (c ^ LINK_TEST_ESC_XOR) : c;
+        isEscaped = false;
+      }
+      continue;
+    }
+
+    uint8_t checksum = 0U;
+    for(uint16_t j = 0; j < frameSize; j++) {
+      checksum += TestFrame[j];
+    }
+
+    uByte2 control;
+    control.Byte[0] = TestFrame[0];
+    control.Byte[1] = TestFrame[1];
+    uint16_t propIndex = ((control.U16 & (1U << 14U)) != 0U) ? 14U : 10U;
+
+    if((checksum != 0xFFU) || (frameSize <= propIndex)) {
+      check->IsOk = false;
+      return;
+    }
+
+    if(TestFrame[propIndex] == LINK_TEST_DICT_PROP) {
+
+      if(frameSize < (propIndex + 8U)) {
+        check->IsOk = false;
+        return;
+      }
+
+      uByte2 dictIndex;
+      dictIndex.Byte[0] = TestFrame[propIndex + 1U];
+      dictIndex.Byte[1] = TestFrame[propIndex + 2U];
+      uByte2 totalSubDicts;
+      totalSubDicts.Byte[0] = TestFrame[propIndex + 3U];
+      totalSubDicts.Byte[1] = TestFrame[propIndex + 4U];
+      uByte2 subDictIndex;
+      subDictIndex.Byte[0] = TestFrame[propIndex + 5U];
+      subDictIndex.Byte[1] = TestFrame[propIndex + 6U];
+
+      if((check->DictIndex >= dictQty) ||
+         (dictIndex.U16 != check->DictIndex) ||
+         (subDictIndex.U16 != check->SubDictIndex) ||
+         (subDictIndex.U16 >= totalSubDicts.U16)) {
+        check->IsOk = false;
+        return;
+      }
+
+      check->SubDictIndex++;
+      if(check->SubDictIndex == totalSubDicts.U16) {
+        check->DictIndex++;
+        check->SubDictIndex = 0U;
+      }
+
+      check->RunDictFrameQty++;
+      check->RunDictBytes += rawSize;
+
+    } else if((TestFrame[propIndex] == LINK_TEST_EVENT_LIB_PROP) &&
+              (frameSize == (propIndex + 4U + LINK_TEST_UPDATE_END_PARAM_SIZE + 1U)) &&
+              (TestFrame[propIndex + 2U] == (uint8_t)eMCU_EVENT_INFO_DICT_UPDATE_END) &&
+              (TestFrame[propIndex + 3U] == 0U)) {
+
+      check->IsUpdateEnd = true;
+      for(uint16_t j = 0; j < LINK_TEST_UPDATE_END_PARAM_SIZE; j++) {
+        check->UpdateEndParam[j] = TestFrame[propIndex + 4U + j];
+      }
+    }
+
+    frameSize = 0U;
+    rawSize = 0U;
+  }
+}
+
+/**
+ * @brief DictGroup function
+ * 
+ */
+FARAABIN_DICT_GROUP_FUNC_(LinkTestDg) {
+
+  FARAABIN_VAR_U32_DICT_WP_(LinkTestVar[0], "LinkHandlerTest\\Pipeline\\Vars");
+  FARAABIN_VAR_U32_DICT_WP_(LinkTestVar[1], "LinkHandlerTest\\Pipeline\\Vars");
+  FARAABIN_VAR_U32_DICT_WP_(LinkTestVar[2], "LinkHandlerTest\\Pipeline\\Vars");
+  FARAABIN_VAR_U32_DICT_WP_(LinkTestVar[3], "LinkHandlerTest\\Pipeline\\Vars");
+  FARAABIN_VAR_U32_DICT_WP_(LinkTestVar[4], "LinkHandlerTest\\Pipeline\\Vars");
+  FARAABIN_VAR_U32_DICT_WP_(LinkTestVar[5], "LinkHandlerTest\\Pipeline\\Vars");
+  FARAABIN_VAR_U32_DICT_WP_(LinkTestVar[6], "LinkHandlerTest\\Pipeline\\Vars");
+  FARAABIN_VAR_U32_DICT_WP_(LinkTestVar[7], "LinkHandlerTest\\Pipeline\\Vars");
+  FARAABIN_VAR_U32_DICT_WP_(LinkTestVar[8], "LinkHandlerTest\\Pipeline\\Vars");
+  FARAABIN_VAR_U32_DICT_WP_(LinkTestVar[9], "LinkHandlerTest\\Pipeline\\Vars");
+  FARAABIN_VAR_U32_DICT_WP_(LinkTestVar[10], "LinkHandlerTest\\Pipeline\\Vars");
+  FARAABIN_VAR_U32_DICT_WP_(LinkTestVar[11], "LinkHandlerTest\\Pipeline\\Vars");
+  FARAABIN_VAR_U32_DICT_WP_(LinkTestVar[12], "LinkHandlerTest\\Pipeline\\Vars");
+  FARAABIN_VAR_U32_DICT_WP_(LinkTestVar[13], "LinkHandlerTest\\Pipeline\\Vars");
+  FARAABIN_VAR_U32_DICT_WP_(LinkTestVar[14], "LinkHandlerTest\\Pipeline\\Vars");
+  FARAABIN_VAR_U32_DICT_WP_(LinkTestVar[15], "LinkHandlerTest\\Pipeline\\Vars");
+  FARAABIN_VAR_U32_DICT_WP_(LinkTestVar[16], "LinkHandlerTest\\Pipeline\\Vars");
+  FARAABIN_VAR_U32_DICT_WP_(LinkTestVar[17], "LinkHandlerTest\\Pipeline\\Vars");
+  FARAABIN_VAR_U32_DICT_WP_(LinkTestVar[18], "LinkHandlerTest\\Pipeline\\Vars");
+  FARAABIN_VAR_U32_DICT_WP_(LinkTestVar[19], "LinkHandlerTest\\Pipeline\\Vars");
+  FARAABIN_VAR_U32_DICT_WP_(LinkTestVar[20], "LinkHandlerTest\\Pipeline\\Vars");
+  FARAABIN_VAR_U32_DICT_WP_(LinkTestVar[21], "LinkHandlerTest\\Pipeline\\Vars");
+  FARAABIN_VAR_U32_DICT_WP_(LinkTestVar[22], "LinkHandlerTest\\Pipeline\\Vars");
+  FARAABIN_VAR_U32_DICT_WP_(LinkTestVar[23], "LinkHandlerTest\\Pipeline\\Vars");
+
+  FARAABIN_DICT_GROUP_FUNC_END_;
+}
+
+/************************ © COPYRIGHT FaraabinCo *****END OF FILE****/
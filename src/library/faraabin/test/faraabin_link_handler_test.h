@@ -0,0 +1,48 @@
+/**
+ ******************************************************************************
+ * @file           : faraabin_link_handler_test.h
+ * @brief          :
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2024 FaraabinCo.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component
+ * 
+ * https://faraabinco.ir/
+ * https://github.com/FaraabinCo
+ *
+ ******************************************************************************
+ * @verbatim
+ * @endverbatim
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef faraabin_link_handler_test_H
+#define faraabin_link_handler_test_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported defines ----------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* Exported functions prototypes ---------------------------------------------*/
+int FaraabinLinkHandlerTest_Run(int argc, const char* argv[]);
+
+/* Exported variables --------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FARAABIN_LINK_HANDLER_TEST_H */
+
+/************************ © COPYRIGHT FaraabinCo *****END OF FILE****/
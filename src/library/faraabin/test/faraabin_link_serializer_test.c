@@ -0,0 +1,533 @@
+/**
+ ******************************************************************************
+ * @file           : faraabin_link_serializer_test.c
+ * @brief          :
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2024 FaraabinCo.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component
+ *
+ * https://faraabinco.ir/
+ * https://github.com/FaraabinCo
+ *
+ ******************************************************************************
+ * @verbatim
+ * @endverbatim
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "faraabin_link_serializer_test.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "unity_fixture.h"
+#include "faraabin.h"
+#include "faraabin_database.h"
+#include "faraabin_link_buffer.h"
+#include "faraabin_link_serializer.h"
+
+/* Private define ------------------------------------------------------------*/
+#define STR_TEST_TX_BUFFER_SIZE   (4096U) /*!< Size of the TX buffer that holds the frames of one container. */
+#define STR_TEST_FRAME_SIZE_MAX   (256U)  /*!< Maximum size of a de-escaped frame in TX buffer. */
+#define STR_TEST_STRING_SIZE_MAX  (64U)   /*!< Maximum size of a decoded string including the null terminator. */
+
+#define STR_TEST_CONTAINER_QTY    (50U)   /*!< Number of containers of the synthetic dictionary. */
+#define STR_TEST_VAR_QTY          (20U)   /*!< Number of variables in each container. */
+#define STR_TEST_BLOCK_QTY        (4U)    /*!< Number of paths that variables of each container are spread over. */
+
+#define STR_TEST_BAUDRATE         (115200U) /*!< Baudrate that the transfer time of the dictionary is reported for. */
+
+#define STR_TEST_EOF              (0x7EU) /*!< End of frame byte. */
+#define STR_TEST_ESC              (0x7DU) /*!< Escape byte. */
+#define STR_TEST_ESC_XOR          (0x20U) /*!< Value that escaped bytes are XORed with. */
+
+#define STR_TEST_DICT_PROP        ((uint8_t)((uint8_t)eFB_PROP_GROUP_DICT << 5U)) /*!< Property byte of dictionary frames. */
+
+#define STR_TEST_REF              (0x01U) /*!< Marker of a string that starts with an interned string. */
+#define STR_TEST_DEF              (0x02U) /*!< Marker of a string that is interned by the host. */
+#define STR_TEST_ID_BASE          (0x80U) /*!< Offset of the string ids on the link. */
+
+/* Private macro -------------------------------------------------------------*/
+/**
+ * @brief Applies a macro to the index of every container of the synthetic dictionary.
+ *
+ */
+#define STR_TEST_CONTAINER_LIST_(x_) \
+  x_(0) x_(1) x_(2) x_(3) x_(4) x_(5) x_(6) x_(7) x_(8) x_(9) \
+  x_(10) x_(11) x_(12) x_(13) x_(14) x_(15) x_(16) x_(17) x_(18) x_(19) \
+  x_(20) x_(21) x_(22) x_(23) x_(24) x_(25) x_(26) x_(27) x_(28) x_(29) \
+  x_(30) x_(31) x_(32) x_(33) x_(34) x_(35) x_(36) x_(37) x_(38) x_(39) \
+  x_(40) x_(41) x_(42) x_(43) x_(44) x_(45) x_(46) x_(47) x_(48) x_(49)
+
+#define STR_TEST_CONTAINER_DEF_(n_)   FARAABIN_DICT_GROUP_DEF_STATIC_(StrTestDg##n_);
+#define STR_TEST_CONTAINER_PTR_(n_)   &StrTestDg##n_,
+#define STR_TEST_CONTAINER_FUNC_(n_)  FARAABIN_DICT_GROUP_FUNC_(StrTestDg##n_) { AddContainerVars(n_, reqSeq); FARAABIN_DICT_GROUP_FUNC_END_; }
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+ * @brief Size of a dictionary transfer.
+ *
+ */
+typedef struct {
+
+  uint32_t FrameQty;        /*!< Number of dictionary frames. */
+  uint32_t Bytes;           /*!< Number of bytes on the link. */
+  uint32_t StringRawBytes;  /*!< Number of path and filename bytes without string table. */
+  uint32_t StringSentBytes; /*!< Number of path and filename bytes that are sent. */
+
+}sDictSize;
+
+/* Private variables ---------------------------------------------------------*/
+TEST_GROUP(LinkSerializerTest);
+
+STR_TEST_CONTAINER_LIST_(STR_TEST_CONTAINER_DEF_)
+
+static sFaraabinFobjectContainer *const StrTestContainers[STR_TEST_CONTAINER_QTY] = {
+  STR_TEST_CONTAINER_LIST_(STR_TEST_CONTAINER_PTR_)
+};
+
+static uint32_t StrTestVar[STR_TEST_CONTAINER_QTY][STR_TEST_VAR_QTY];
+
+/**
+ * @brief Paths of the synthetic dictionary. Index 0 is the path of the container and the rest are paths of
+ *        its variables, one level below it. They are kept for the whole test, because string table only keeps pointers.
+ *
+ */
+static char StrTestPaths[STR_TEST_CONTAINER_QTY][STR_TEST_BLOCK_QTY + 1U][STR_TEST_STRING_SIZE_MAX];
+
+static uint8_t TestTxBuffer[STR_TEST_TX_BUFFER_SIZE];
+static uint8_t TestFrame[STR_TEST_FRAME_SIZE_MAX];
+
+/**
+ * @brief String table of the host side of the link.
+ *
+ */
+static char HostStrings[FB_DICT_STRING_TABLE_QTY][STR_TEST_STRING_SIZE_MAX];
+static uint32_t HostDefQty;
+
+/* Private function prototypes -----------------------------------------------*/
+static void RunTests(void);
+static void OneTimeSetup(void);
+static void OneTimeTeardown(void);
+static void AddContainerVars(uint8_t index, uint8_t reqSeq);
+static void ResetHostStrings(void);
+static bool DecodeString(uint16_t *pos, uint16_t frameSize, char terminator, char *str);
+static bool CheckContainerFrame(uint16_t index, uint16_t payloadIndex, uint16_t frameSize);
+static bool DecodeContainerFrames(uint16_t index, sDictSize *size);
+static void PrintDictSize(const char *name, sDictSize *size);
+
+/* Variables -----------------------------------------------------------------*/
+
+/*
+╔══════════════════════════════════════════════════════════════════════════════════╗
+║                          ##### Exported Functions #####                          ║
+╚══════════════════════════════════════════════════════════════════════════════════╝
+*/
+
+/**
+ * @brief Function that runs all unit tests and returns the result
+ *
+ * @param argc
+ * @param argv
+ * @return int
+ */
+int FaraabinLinkSerializerTest_Run(int argc, const char* argv[]) {
+
+  OneTimeSetup();
+
+  int testsFailed = UnityMain(argc, argv, RunTests);
+
+  OneTimeTeardown();
+
+  return testsFailed;
+}
+
+/*
+╔══════════════════════════════════════════════════════════════════════════════════╗
+║                            ##### Private Functions #####                         ║
+╚══════════════════════════════════════════════════════════════════════════════════╝
+*/
+
+/**
+ * @brief Test group runner.
+ *
+ */
+TEST_GROUP_RUNNER(LinkSerializerTest) {
+
+  RUN_TEST_CASE(LinkSerializerTest, TemplateTest);
+  RUN_TEST_CASE(LinkSerializerTest, DictStringsDecodeToOriginal);
+  RUN_TEST_CASE(LinkSerializerTest, DictSizeReport);
+
+}
+
+/**
+ * @brief Run all tests in test group.
+ *
+ */
+static void RunTests(void) {
+  RUN_TEST_GROUP(LinkSerializerTest);
+}
+
+/**
+ * @brief Unit test setup.
+ *
+ */
+TEST_SETUP(LinkSerializerTest) {
+
+  fFaraabinLinkBuffer_Init(TestTxBuffer, STR_TEST_TX_BUFFER_SIZE);
+  fFaraabinLinkBuffer_Clear();
+  fFaraabinLinkSerializer_ResetDictStrings();
+  ResetHostStrings();
+}
+
+/**
+ * @brief Unit test teardown.
+ *
+ */
+TEST_TEAR_DOWN(LinkSerializerTest) {
+
+  fFaraabinLinkSerializer_ResetDictStrings();
+  fFaraabinLinkBuffer_Init(fFaraabin_GetTxBufferPointer(), fFaraabin_GetTxBufferSize());
+}
+
+/**
+ * @brief Template test.
+ *
+ */
+TEST(LinkSerializerTest, TemplateTest) {
+
+  TEST_ASSERT(true);
+}
+
+/**
+ * @brief Paths and filenames of 1000 variables in 50 containers decode back to the original strings.
+ *        Paths share their parent levels and there are many more distinct strings than entries in the string table,
+ *        so ids are reused while the transfer goes on.
+ *
+ */
+TEST(LinkSerializerTest, DictStringsDecodeToOriginal) {
+
+  sDictSize size = {0};
+
+  for(uint16_t i = 0; i < STR_TEST_CONTAINER_QTY; i++) {
+    TEST_ASSERT_TRUE(DecodeContainerFrames(i, &size));
+  }
+
+  TEST_ASSERT_EQUAL_UINT32(STR_TEST_CONTAINER_QTY * (STR_TEST_VAR_QTY + 1U), size.FrameQty);
+
+#ifdef FB_FEATURE_FLAG_DICT_STRING_TABLE
+  TEST_ASSERT_GREATER_THAN_UINT32(FB_DICT_STRING_TABLE_QTY, HostDefQty);
+  TEST_ASSERT_LESS_THAN_UINT32(size.StringRawBytes, size.StringSentBytes);
+#else
+  TEST_ASSERT_EQUAL_UINT32(0U, HostDefQty);
+#endif
+}
+
+/**
+ * @brief Reports the size of the dictionary of the synthetic project and of the whole database of the test
+ *        with and without string table. Dictionaries are serialized in the order of a whole dictionary transfer.
+ *
+ */
+TEST(LinkSerializerTest, DictSizeReport) {
+
+  sDictSize size = {0};
+
+  for(uint16_t i = 0; i < STR_TEST_CONTAINER_QTY; i++) {
+    TEST_ASSERT_TRUE(DecodeContainerFrames(i, &size));
+  }
+
+  PrintDictSize("synthetic 1000 vars", &size);
+
+  fFaraabinLinkSerializer_ResetDictStrings();
+  memset(&size, 0, sizeof(size));
+
+  uint16_t dictQty = fFaraabinDatabase_GetNumberOfAddedDicts();
+
+  for(uint16_t i = 0; i < dictQty; i++) {
+
+    fFaraabinLinkBuffer_Clear();
+    fFaraabinLinkSerializer_SerializeDict(fFaraabinDatabase_GetFobjectPointerFromDict(i), i, 0U);
+
+    for(uint32_t j = 0; j < FbCircularBuffer._head; j++) {
+      if(FbCircularBuffer.Buffer[j] == STR_TEST_EOF) {
+        size.FrameQty++;
+      }
+    }
+    size.Bytes += FbCircularBuffer._head;
+  }
+
+  fFaraabinLinkSerializer_GetDictStringStats(&size.StringRawBytes, &size.StringSentBytes);
+
+  PrintDictSize("database", &size);
+
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(size.StringRawBytes, size.StringSentBytes);
+}
+
+/**
+ * @brief Setup that executes before all tests.
+ *
+ */
+static void OneTimeSetup(void) {
+
+  for(uint8_t i = 0; i < STR_TEST_CONTAINER_QTY; i++) {
+
+    snprintf(StrTestPaths[i][0], STR_TEST_STRING_SIZE_MAX, "StringTableTest\\Module%02u", i);
+
+    for(uint8_t j = 1; j <= STR_TEST_BLOCK_QTY; j++) {
+      snprintf(StrTestPaths[i][j], STR_TEST_STRING_SIZE_MAX, "StringTableTest\\Module%02u\\Block%u", i, j);
+    }
+
+    FARAABIN_DictGroup_Init_WithPath_(StrTestContainers[i], StrTestPaths[i][0]);
+  }
+}
+
+/**
+ * @brief Teardown that executes after all tests (or in case of a test failure).
+ *
+ */
+static void OneTimeTeardown(void) {
+
+}
+
+/**
+ * @brief Adds variables of a container of the synthetic dictionary.
+ *
+ * @param index Index of the container.
+ * @param reqSeq Request sequence of the dictionary.
+ */
+static void AddContainerVars(uint8_t index, uint8_t reqSeq) {
+
+  for(uint8_t i = 0; i < STR_TEST_VAR_QTY; i++) {
+    FARAABIN_VAR_U32_DICT_WP_(StrTestVar[index][i], StrTestPaths[index][1U + ((i * STR_TEST_BLOCK_QTY) / STR_TEST_VAR_QTY)]);
+  }
+}
+
+/**
+ * @brief Empties the string table of the host side.
+ *
+ */
+static void ResetHostStrings(void) {
+
+  memset(HostStrings, 0, sizeof(HostStrings));
+  HostDefQty = 0U;
+}
+
+/**
+ * @brief Decodes a path or filename string of a dictionary frame the way the host does.
+ *
+ * @param pos Pointer to the position of the string in the frame. It is moved after the terminator.
+ * @param frameSize Size of the frame.
+ * @param terminator Character that ends the string.
+ * @param str Pointer to the decoded string. It must be at least STR_TEST_STRING_SIZE_MAX bytes.
+ * @return isOk Returns false if the string is malformed.
+ */
+static bool DecodeString(uint16_t *pos, uint16_t frameSize, char terminator, char *str) {
+
+  uint16_t p = *pos;
+  bool isDef = false;
+  uint8_t defId = 0U;
+  uint16_t len = 0U;
+
+  if(((p + 1U) < frameSize) && (TestFrame[p] == STR_TEST_DEF)) {
+    isDef = true;
+    defId = (uint8_t)(TestFrame[p + 1U] - STR_TEST_ID_BASE);
+    if(defId >= FB_DICT_STRING_TABLE_QTY) {
+      return false;
+    }
+    p += 2U;
+  }
+
+  if(((p + 1U) < frameSize) && (TestFrame[p] == STR_TEST_REF)) {
+
+    uint8_t refId = (uint8_t)(TestFrame[p + 1U] - STR_TEST_ID_BASE);
+    if(refId >= FB_DICT_STRING_TABLE_QTY) {
+      return false;
+    }
+
+    len = (uint16_t)strlen(HostStrings[refId]);
+    memcpy(str, HostStrings[refId], len);
+    p += 2U;
+  }
+
+  while((p < frameSize) && (TestFrame[p] != (uint8_t)terminator)) {
+
+    if(len >= (STR_TEST_STRING_SIZE_MAX - 1U)) {
+      return false;
+    }
+    str[len++] = (char)TestFrame[p++];
+  }
+
+  if(p >= frameSize) {
+    return false;
+  }
+  str[len] = '\0';
+  *pos = p + 1U;
+
+  if(isDef) {
+    strcpy(HostStrings[defId], str);
+    HostDefQty++;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Checks the payload of a dictionary frame of a container of the synthetic dictionary.
+ *
+ * @param index Index of the container.
+ * @param payloadIndex Index of the payload in TestFrame after the dictionary iterator.
+ * @param frameSize Size of the frame without checksum.
+ * @return isOk Returns false if the payload doesn't match the container.
+ */
+static bool CheckContainerFrame(uint16_t index, uint16_t payloadIndex, uint16_t frameSize) {
+
+  static uint16_t varIndex;
+  char str[STR_TEST_STRING_SIZE_MAX];
+  uint16_t pos = payloadIndex + 1U;
+
+  if(TestFrame[payloadIndex] == ((uint8_t)eFO_TYPE_CONTAINER | 0x80U)) {
+
+    varIndex = 0U;
+    pos += 4U;
+
+    if(!DecodeString(&pos, frameSize, ':', str) || (strcmp(str, StrTestContainers[index]->Name) != 0)) {
+      return false;
+    }
+    if(!DecodeString(&pos, frameSize, ':', str) || (strcmp(str, StrTestPaths[index][0]) != 0)) {
+      return false;
+    }
+    if(!DecodeString(&pos, frameSize, '\0', str) || (strcmp(str, StrTestContainers[index]->Filename) != 0)) {
+      return false;
+    }
+
+    return true;
+  }
+
+  if((TestFrame[payloadIndex] != ((uint8_t)eFO_TYPE_VAR | 0x80U)) || (varIndex >= STR_TEST_VAR_QTY)) {
+    return false;
+  }
+
+  // Pointer, type, array qty and control byte.
+  pos += 13U;
+
+  if(!DecodeString(&pos, frameSize, ':', str)) {
+    return false;
+  }
+  if(!DecodeString(&pos, frameSize, '\0', str) ||
+     (strcmp(str, StrTestPaths[index][1U + ((varIndex * STR_TEST_BLOCK_QTY) / STR_TEST_VAR_QTY)]) != 0)) {
+    return false;
+  }
+
+  varIndex++;
+
+  return true;
+}
+
+/**
+ * @brief Serializes the dictionary of a container of the synthetic dictionary and decodes its frames.
+ *
+ * @param index Index of the container.
+ * @param size Pointer to the size of the transfer. Size of this container is added to it.
+ * @return isOk Returns false if a frame is malformed or doesn't decode to the original strings.
+ */
+static bool DecodeContainerFrames(uint16_t index, sDictSize *size) {
+
+  uint16_t frameSize = 0U;
+  bool isEscaped = false;
+
+  fFaraabinLinkBuffer_Clear();
+  fFaraabinLinkSerializer_SerializeDict((uint32_t)StrTestContainers[index], index, 0U);
+
+  for(uint32_t i = 0; i < FbCircularBuffer._head; i++) {
+
+    uint8_t c = FbCircularBuffer.Buffer[i];
+
+    if(c != STR_TEST_EOF) {
+
+      if(frameSize >= STR_TEST_FRAME_SIZE_MAX) {
+        return false;
+      }
+
+      if(c == STR_TEST_ESC) {
+        isEscaped = true;
+      } else {
+        TestFrame[frameSize++] = isEscaped ? (c ^ STR_TEST_ESC_XOR) : c;
+        isEscaped = false;
+      }
+      continue;
+    }
+
+    uint8_t checksum = 0U;
+    for(uint16_t j = 0; j < frameSize; j++) {
+      checksum += TestFrame[j];
+    }
+
+    uByte2 control;
+    control.Byte[0] = TestFrame[0];
+    control.Byte[1] = TestFrame[1];
+    uint16_t propIndex = ((control.U16 & (1U << 14U)) != 0U) ? 14U : 10U;
+
+    if((checksum != 0xFFU) || (frameSize < (propIndex + 8U)) || (TestFrame[propIndex] != STR_TEST_DICT_PROP)) {
+      return false;
+    }
+
+    uByte2 dictIndex;
+    dictIndex.Byte[0] = TestFrame[propIndex + 1U];
+    dictIndex.Byte[1] = TestFrame[propIndex + 2U];
+
+    if((dictIndex.U16 != index) || !CheckContainerFrame(index, propIndex + 7U, frameSize - 1U)) {
+      return false;
+    }
+
+    size->FrameQty++;
+    frameSize = 0U;
+  }
+
+  size->Bytes += FbCircularBuffer._head;
+
+  uint32_t raw = 0U;
+  uint32_t sent = 0U;
+  fFaraabinLinkSerializer_GetDictStringStats(&raw, &sent);
+  size->StringRawBytes = raw;
+  size->StringSentBytes = sent;
+
+  return true;
+}
+
+/**
+ * @brief Prints the size of a dictionary transfer and the size that it would have without string table.
+ *
+ * @param name Name of the dictionary.
+ * @param size Pointer to the size of the transfer.
+ */
+static void PrintDictSize(const char *name, sDictSize *size) {
+
+  // Markers and plain text of strings are never escaped, so the difference of string bytes is the whole difference.
+  uint32_t rawBytes = size->Bytes + size->StringRawBytes - size->StringSentBytes;
+
+  UnityPrint(name);
+  UnityPrint(": frames=");
+  UnityPrintNumberUnsigned(size->FrameQty);
+  UnityPrint(" strings ");
+  UnityPrintNumberUnsigned(size->StringRawBytes);
+  UnityPrint("->");
+  UnityPrintNumberUnsigned(size->StringSentBytes);
+  UnityPrint(" dict ");
+  UnityPrintNumberUnsigned(rawBytes);
+  UnityPrint("->");
+  UnityPrintNumberUnsigned(size->Bytes);
+  UnityPrint(" bytes, ms@115200 ");
+  UnityPrintNumberUnsigned(((uint64_t)rawBytes * 10000U) / STR_TEST_BAUDRATE);
+  UnityPrint("->");
+  UnityPrintNumberUnsigned(((uint64_t)size->Bytes * 10000U) / STR_TEST_BAUDRATE);
+  UNITY_PRINT_EOL();
+}
+
+STR_TEST_CONTAINER_LIST_(STR_TEST_CONTAINER_FUNC_)
+
+/************************ © COPYRIGHT FaraabinCo *****END OF FILE****/
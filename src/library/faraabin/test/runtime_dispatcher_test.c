@@ -0,0 +1,332 @@
+/**
+ ******************************************************************************
+ * @file           : runtime_dispatcher_test.c
+ * @brief          :
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2024 FaraabinCo.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component
+ *
+ * https://faraabinco.ir/
+ * https://github.com/FaraabinCo
+ *
+ ******************************************************************************
+ * @verbatim
+ * @endverbatim
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "runtime_dispatcher_test.h"
+
+#include "unity_fixture.h"
+#include "add_on/runtime_scaler/runtime_dispatcher.h"
+
+/* Private define ------------------------------------------------------------*/
+#define FAST_INTERVAL_US  (1000U)
+#define SLOW_INTERVAL_MS  (50U)
+#define FAST_BODY_US      (200U)
+#define TOLERANCE_US      (50U)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private typedef -----------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+TEST_GROUP(RuntimeDispatcherTest);
+
+/* Private function prototypes -----------------------------------------------*/
+static void RunTests(void);
+static void OneTimeSetup(void);
+static void OneTimeTeardown(void);
+
+/* Variables -----------------------------------------------------------------*/
+
+/**
+ * @brief Block that keeps the CPU for FAST_BODY_US in each run.
+ *
+ */
+RUN_EVERY_REGISTER_US_(DispatcherTestFast, FAST_INTERVAL_US) {
+
+  fChrono_DelayUs(FAST_BODY_US);
+}
+
+/**
+ * @brief Block with a long interval that bounds the time until the next deadline.
+ *
+ */
+RUN_EVERY_REGISTER_MS_(DispatcherTestSlow, SLOW_INTERVAL_MS) {
+
+}
+
+/**
+ * @brief Block that is disabled in all tests.
+ *
+ */
+RUN_EVERY_REGISTER_US_(DispatcherTestOff, 100U) {
+
+}
+
+/*
+╔══════════════════════════════════════════════════════════════════════════════════╗
+║                          ##### Exported Functions #####                          ║
+╚══════════════════════════════════════════════════════════════════════════════════╝
+*/
+
+/**
+ * @brief Function that runs all unit tests and returns the result
+ *
+ * @param argc
+ * @param argv
+ * @return int
+ */
+int RuntimeDispatcherTest_Run(int argc, const char* argv[]) {
+
+  OneTimeSetup();
+
+  int testsFailed = UnityMain(argc, argv, RunTests);
+
+  OneTimeTeardown();
+
+  return testsFailed;
+}
+
+/*
+╔══════════════════════════════════════════════════════════════════════════════════╗
+║                            ##### Private Functions #####                         ║
+╚══════════════════════════════════════════════════════════════════════════════════╝
+*/
+
+/**
+ * @brief Test group runner.
+ *
+ */
+TEST_GROUP_RUNNER(RuntimeDispatcherTest) {
+
+  RUN_TEST_CASE(RuntimeDispatcherTest, SectionHoldsRegisteredBlocks);
+  RUN_TEST_CASE(RuntimeDispatcherTest, FindReturnsBlockByName);
+  RUN_TEST_CASE(RuntimeDispatcherTest, FirstRunStartsEnabledBlocks);
+  RUN_TEST_CASE(RuntimeDispatcherTest, DueBlockRunsAndUpdatesStatistics);
+  RUN_TEST_CASE(RuntimeDispatcherTest, SetIntervalAppliesImmediately);
+  RUN_TEST_CASE(RuntimeDispatcherTest, ZeroIntervalOrDisableStopsBlock);
+  RUN_TEST_CASE(RuntimeDispatcherTest, LongIntervalIsClamped);
+
+}
+
+/**
+ * @brief Run all tests in test group.
+ *
+ */
+static void RunTests(void) {
+  RUN_TEST_GROUP(RuntimeDispatcherTest);
+}
+
+/**
+ * @brief Unit test setup.
+ *
+ * @note Stops all the blocks and restores their registered settings, so every test starts with a first run.
+ *
+ */
+TEST_SETUP(RuntimeDispatcherTest) {
+
+  DispatcherTestFast.Enable = FALSE;
+  DispatcherTestSlow.Enable = FALSE;
+  DispatcherTestOff.Enable = FALSE;
+  (void)fRuntimeDispatcher_Run();
+
+  DispatcherTestFast.IntervalUs = FAST_INTERVAL_US;
+  DispatcherTestSlow.IntervalUs = SLOW_INTERVAL_MS * 1000U;
+  DispatcherTestFast.Enable = TRUE;
+  DispatcherTestSlow.Enable = TRUE;
+
+  fRuntimeDispatcher_ResetStatistics(&DispatcherTestFast);
+  fRuntimeDispatcher_ResetStatistics(&DispatcherTestSlow);
+  fRuntimeDispatcher_ResetStatistics(&DispatcherTestOff);
+}
+
+/**
+ * @brief Unit test teardown.
+ *
+ */
+TEST_TEAR_DOWN(RuntimeDispatcherTest) {
+
+}
+
+/**
+ * @brief Every registered block has one descriptor in the section with its name, object and body.
+ *
+ */
+TEST(RuntimeDispatcherTest, SectionHoldsRegisteredBlocks) {
+
+  uint32_t foundQty = 0U;
+  const sRunEveryDict *end = fRuntimeDispatcher_GetEnd();
+
+  for(const sRunEveryDict *dict = fRuntimeDispatcher_GetBegin(); dict < end; dict++) {
+    TEST_ASSERT_NOT_NULL(dict->Name);
+    TEST_ASSERT_NOT_NULL(dict->Block);
+    TEST_ASSERT_NOT_NULL(dict->fpRun);
+
+    if((dict->Block == &DispatcherTestFast) || (dict->Block == &DispatcherTestSlow) || (dict->Block == &DispatcherTestOff)) {
+      foundQty++;
+    }
+  }
+
+  TEST_ASSERT_EQUAL_UINT32(3U, foundQty);
+}
+
+/**
+ * @brief Blocks are found by the name that is given to the register macro.
+ *
+ */
+TEST(RuntimeDispatcherTest, FindReturnsBlockByName) {
+
+  TEST_ASSERT_EQUAL(&DispatcherTestFast, fRuntimeDispatcher_Find("DispatcherTestFast"));
+  TEST_ASSERT_EQUAL(&DispatcherTestOff, fRuntimeDispatcher_Find("DispatcherTestOff"));
+  TEST_ASSERT_NULL(fRuntimeDispatcher_Find("DispatcherTestNone"));
+  TEST_ASSERT_NULL(fRuntimeDispatcher_Find(NULL));
+}
+
+/**
+ * @brief The first run starts the enabled blocks without running them and returns the time until the nearest deadline.
+ *
+ */
+TEST(RuntimeDispatcherTest, FirstRunStartsEnabledBlocks) {
+
+  timeUs_t nextUs = fRuntimeDispatcher_Run();
+
+  TEST_ASSERT_UINT32_WITHIN(TOLERANCE_US, FAST_INTERVAL_US, nextUs);
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(FAST_INTERVAL_US, nextUs);
+
+  TEST_ASSERT_TRUE(DispatcherTestFast._run);
+  TEST_ASSERT_TRUE(DispatcherTestSlow._run);
+  TEST_ASSERT_FALSE(DispatcherTestOff._run);
+  TEST_ASSERT_EQUAL_UINT32(0U, DispatcherTestFast.RunQty);
+}
+
+/**
+ * @brief A due block runs once, and its lateness and execution time are measured from its deadline and its body.
+ *
+ */
+TEST(RuntimeDispatcherTest, DueBlockRunsAndUpdatesStatistics) {
+
+  const timeUs_t lateUs = 300U;
+
+  (void)fRuntimeDispatcher_Run();
+  fChrono_DelayUs(FAST_INTERVAL_US + lateUs);
+  timeUs_t nextUs = fRuntimeDispatcher_Run();
+
+  TEST_ASSERT_EQUAL_UINT32(1U, DispatcherTestFast.RunQty);
+  TEST_ASSERT_EQUAL_UINT32(0U, DispatcherTestSlow.RunQty);
+  TEST_ASSERT_UINT32_WITHIN(TOLERANCE_US, lateUs, DispatcherTestFast.LateUs);
+  TEST_ASSERT_EQUAL_UINT32(DispatcherTestFast.LateUs, DispatcherTestFast.LateMaxUs);
+  TEST_ASSERT_UINT32_WITHIN(TOLERANCE_US, FAST_BODY_US, DispatcherTestFast.ExecutionUs);
+  TEST_ASSERT_EQUAL_UINT32(DispatcherTestFast.ExecutionUs, DispatcherTestFast.ExecutionMaxUs);
+
+  /* The next deadline is one interval after the missed one, not after this run. */
+  TEST_ASSERT_UINT32_WITHIN(TOLERANCE_US * 2U, FAST_INTERVAL_US - lateUs - FAST_BODY_US, nextUs);
+
+  fRuntimeDispatcher_ResetStatistics(&DispatcherTestFast);
+
+  TEST_ASSERT_EQUAL_UINT32(0U, DispatcherTestFast.RunQty);
+  TEST_ASSERT_EQUAL_UINT32(0U, DispatcherTestFast.LateMaxUs);
+  TEST_ASSERT_EQUAL_UINT32(0U, DispatcherTestFast.ExecutionMaxUs);
+}
+
+/**
+ * @brief fRuntimeDispatcher_SetIntervalUs() restarts the block with the new interval, while writing IntervalUs waits for the deadline.
+ *
+ */
+TEST(RuntimeDispatcherTest, SetIntervalAppliesImmediately) {
+
+  (void)fRuntimeDispatcher_Run();
+
+  fRuntimeDispatcher_SetIntervalUs(&DispatcherTestFast, 3000U);
+  timeUs_t nextUs = fRuntimeDispatcher_Run();
+
+  TEST_ASSERT_EQUAL_UINT32(3000U, DispatcherTestFast.IntervalUs);
+  TEST_ASSERT_UINT32_WITHIN(TOLERANCE_US, 3000U, nextUs);
+
+  DispatcherTestFast.IntervalUs = 2000U;
+  nextUs = fRuntimeDispatcher_Run();
+
+  TEST_ASSERT_GREATER_THAN_UINT32(2000U + TOLERANCE_US, nextUs);
+
+  fRuntimeDispatcher_SetIntervalMs(&DispatcherTestFast, 2U);
+  nextUs = fRuntimeDispatcher_Run();
+
+  TEST_ASSERT_EQUAL_UINT32(2000U, DispatcherTestFast.IntervalUs);
+  TEST_ASSERT_UINT32_WITHIN(TOLERANCE_US, 2000U, nextUs);
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(2000U, nextUs);
+}
+
+/**
+ * @brief A zero interval or a disabled block stops the block, and it starts over when it is enabled again.
+ *
+ */
+TEST(RuntimeDispatcherTest, ZeroIntervalOrDisableStopsBlock) {
+
+  (void)fRuntimeDispatcher_Run();
+
+  fRuntimeDispatcher_SetIntervalUs(&DispatcherTestFast, 0U);
+  timeUs_t nextUs = fRuntimeDispatcher_Run();
+
+  TEST_ASSERT_FALSE(DispatcherTestFast._run);
+  TEST_ASSERT_GREATER_THAN_UINT32(FAST_INTERVAL_US, nextUs);
+
+  DispatcherTestSlow.Enable = FALSE;
+  nextUs = fRuntimeDispatcher_Run();
+
+  TEST_ASSERT_FALSE(DispatcherTestSlow._run);
+  TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, nextUs);
+
+  fRuntimeDispatcher_SetIntervalUs(&DispatcherTestFast, FAST_INTERVAL_US);
+  nextUs = fRuntimeDispatcher_Run();
+
+  TEST_ASSERT_TRUE(DispatcherTestFast._run);
+  TEST_ASSERT_UINT32_WITHIN(TOLERANCE_US, FAST_INTERVAL_US, nextUs);
+  TEST_ASSERT_EQUAL_UINT32(0U, DispatcherTestFast.RunQty);
+}
+
+/**
+ * @brief Intervals longer than the tick generator can measure are clamped, including overflowing millisecond intervals.
+ *
+ */
+TEST(RuntimeDispatcherTest, LongIntervalIsClamped) {
+
+  timeUs_t maxUs = fChrono_GetMaxMeasurableTimeUs();
+
+  (void)fRuntimeDispatcher_Run();
+
+  fRuntimeDispatcher_SetIntervalMs(&DispatcherTestSlow, UINT32_MAX);
+  TEST_ASSERT_EQUAL_UINT32(maxUs, DispatcherTestSlow.IntervalUs);
+
+  fRuntimeDispatcher_SetIntervalUs(&DispatcherTestSlow, UINT32_MAX);
+  TEST_ASSERT_EQUAL_UINT32(maxUs, DispatcherTestSlow.IntervalUs);
+
+  DispatcherTestFast.Enable = FALSE;
+  timeUs_t nextUs = fRuntimeDispatcher_Run();
+
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(maxUs, nextUs);
+  TEST_ASSERT_GREATER_THAN_UINT32(maxUs - TOLERANCE_US, nextUs);
+}
+
+/**
+ * @brief Setup that executes before all tests.
+ *
+ */
+static void OneTimeSetup(void) {
+
+  fRuntimeDispatcher_Init();
+
+}
+
+/**
+ * @brief Teardown that executes after all tests (or in case of a test failure).
+ *
+ */
+static void OneTimeTeardown(void) {
+
+}
+
+/************************ © COPYRIGHT FaraabinCo *****END OF FILE****/
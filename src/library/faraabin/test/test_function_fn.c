@@ -73,6 +73,30 @@ FARAABIN_FUNCTION_LOOP_(TestFunctionFn, WHILE, "help") {
   FARAABIN_FUNCTION_END_();
 }
 
+/**
+ * @brief 
+ * 
+ */
+FARAABIN_FUNCTION_(TestFunctionFn, COROUTINE, "help") {
+  
+  static int step;
+  
+  FARAABIN_Function_SetSchedule_(1, 200);
+  
+  FARAABIN_Function_CoroutineBegin_();
+  
+  for(step = 0; step < 10; step++) {
+    
+    FARAABIN_PrintfToFunction_("\r\nTestCoroutine: %u", step);
+    
+    FARAABIN_Function_Yield_();
+  }
+  
+  FARAABIN_Function_CoroutineEnd_();
+  
+  FARAABIN_FUNCTION_END_();
+}
+
 /*
 ╔══════════════════════════════════════════════════════════════════════════════════╗
 ║                           ##### Private Functions #####                          ║
@@ -86,6 +110,7 @@ FARAABIN_FUNCTION_GROUP_(TestFunctionFn, "help") {
   
   FARAABIN_FUNCTION_GROUP_ADD_(TestFunctionFn, LOOP_BACK);
   FARAABIN_FUNCTION_GROUP_ADD_(TestFunctionFn, WHILE);
+  FARAABIN_FUNCTION_GROUP_ADD_(TestFunctionFn, COROUTINE);
 
 }
 